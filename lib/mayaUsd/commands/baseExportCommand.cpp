@@ -127,6 +127,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kLegacyMaterialScopeFlag,
         UsdMayaJobExportArgsTokens->legacyMaterialScope.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kMergeIdenticalMaterialsFlag,
+        UsdMayaJobExportArgsTokens->mergeIdenticalMaterials.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kStripNamespacesFlag,
         UsdMayaJobExportArgsTokens->stripNamespaces.GetText(),
@@ -236,6 +240,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kStaticSingleSample,
         UsdMayaJobExportArgsTokens->staticSingleSample.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kValueClipChunkSize,
+        UsdMayaJobExportArgsTokens->valueClipChunkSize.GetText(),
+        MSyntax::kDouble);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
 
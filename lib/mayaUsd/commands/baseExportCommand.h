@@ -48,6 +48,7 @@ public:
     static constexpr auto kExportMaterialsFlag = "mat";
     static constexpr auto kExportAssignedMaterialsFlag = "ama";
     static constexpr auto kLegacyMaterialScopeFlag = "lms";
+    static constexpr auto kMergeIdenticalMaterialsFlag = "mim";
     static constexpr auto kExportUVsFlag = "uvs";
     static constexpr auto kExportRelativeTexturesFlag = "rtx";
     static constexpr auto kEulerFilterFlag = "ef";
@@ -93,6 +94,7 @@ public:
     static constexpr auto kPythonPostCallbackFlag = "ppc";
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
+    static constexpr auto kValueClipChunkSize = "vcc";
     static constexpr auto kGeomSidednessFlag = "gs";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
@@ -18,8 +18,9 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-FlexibleSparseValueWriter::FlexibleSparseValueWriter(bool writeDefaults)
+FlexibleSparseValueWriter::FlexibleSparseValueWriter(bool writeDefaults, bool sparseTimeSamples)
     : _writeDefaults(writeDefaults)
+    , _sparseTimeSamples(sparseTimeSamples)
 {
 }
 
@@ -32,6 +33,8 @@ bool FlexibleSparseValueWriter::SetAttribute(
     // then write the value directly on the attribute, skipping the sparse writer.
     if (_writeDefaults && time.IsDefault()) {
         return attr.Set(value, time);
+    } else if (!_sparseTimeSamples && !time.IsDefault()) {
+        return attr.Set(value, time);
     } else {
         return _sparseWriter.SetAttribute(attr, value, time);
     }
@@ -46,6 +49,8 @@ bool FlexibleSparseValueWriter::SetAttribute(
     // then write the value directly on the attribute, skipping the sparse writer.
     if (_writeDefaults && time.IsDefault()) {
         return attr.Set(*value, time);
+    } else if (!_sparseTimeSamples && !time.IsDefault()) {
+        return attr.Set(*value, time);
     } else {
         return _sparseWriter.SetAttribute(attr, value, time);
     }
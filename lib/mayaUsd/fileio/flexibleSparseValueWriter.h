@@ -32,11 +32,15 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// This is necessary in some cases, for example to author a layer that will override
 /// a value back to its default. Another example is during edit-as-Maya / merge-to-USD
 /// where we need to author default values in case the original value was not the default.
+///
+/// Time samples can also be written densely, one per call, for example when every chunk
+/// of an export streamed into value clips must hold the samples of all its frames.
 class MAYAUSD_CORE_PUBLIC FlexibleSparseValueWriter
 {
 public:
-    /// Constructor taking a flag to decide if default values at default time should be written.
-    FlexibleSparseValueWriter(bool writeDefaults = true);
+    /// Constructor taking a flag to decide if default values at default time should be written,
+    /// and a flag to decide if redundant time samples should be skipped.
+    FlexibleSparseValueWriter(bool writeDefaults = true, bool sparseTimeSamples = true);
 
     FlexibleSparseValueWriter(const FlexibleSparseValueWriter&) = delete;
     FlexibleSparseValueWriter& operator=(const FlexibleSparseValueWriter&) = delete;
@@ -79,6 +83,7 @@ public:
 private:
     UsdUtilsSparseValueWriter _sparseWriter;
     bool                      _writeDefaults;
+    bool                      _sparseTimeSamples;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
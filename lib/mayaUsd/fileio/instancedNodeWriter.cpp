@@ -27,42 +27,30 @@
 #include <maya/MDagPath.h>
 #include <maya/MDagPathArray.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MObjectHandle.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-/// Assuming that \p instance1 and \p instance2 are instances of one another,
-/// replaces the prefix \p instance1 in \p dagPath with \p instance2.
-static MDagPath _ReplaceInstancePrefix(
-    const MDagPath& dagPath,
-    const MDagPath& instance1,
-    const MDagPath& instance2)
+/// Computes the index of each path component of \p dagPath under its parent,
+/// from the child of \p root down to \p dagPath. Returns \c false if
+/// \p dagPath is not a descendant of \p root.
+static bool _GetChildIndices(
+    const MDagPath&            dagPath,
+    const MDagPath&            root,
+    std::vector<unsigned int>* indices)
 {
-    // Early out if the prefixes are the same (no replacement necessary).
-    if (instance1 == instance2) {
-        return dagPath;
-    }
-
-    if (instance1.node() != instance2.node()) {
-        TF_CODING_ERROR(
-            "'%s' and '%s' are not instances of one another",
-            instance1.fullPathName().asChar(),
-            instance2.fullPathName().asChar());
-        return MDagPath();
-    }
-
-    // Find the index of each path component under its parent component,
-    // starting from dagPath all the way up to instance1.
-    std::vector<unsigned int> indices;
-    for (MDagPath curPath = dagPath; !(curPath == instance1); curPath.pop()) {
+    indices->clear();
+    for (MDagPath curPath = dagPath; !(curPath == root); curPath.pop()) {
         if (!curPath.isValid() || !curPath.length()) {
             TF_CODING_ERROR(
                 "'%s' is not a descendant of '%s'",
                 dagPath.fullPathName().asChar(),
-                instance1.fullPathName().asChar());
-            return MDagPath();
+                root.fullPathName().asChar());
+            return false;
         }
 
         MDagPath parentPath(curPath);
@@ -71,25 +59,30 @@ static MDagPath _ReplaceInstancePrefix(
         bool found = false;
         for (unsigned int i = 0u; i < parentPath.childCount(); ++i) {
             if (parentPath.child(i) == curPath.node()) {
-                indices.push_back(i);
+                indices->push_back(i);
                 found = true;
                 break;
             }
         }
         if (!found) {
             TF_CODING_ERROR("Couldn't find '%s' under its parent", curPath.fullPathName().asChar());
-            return MDagPath();
+            return false;
         }
     }
 
-    // Apply the indices in reverse order to instance2.
-    // We assume that the structure underneath instance1 and instance2 must
-    // be identical, down to the node order, since they are instances of one
-    // another. Thus, applying the same path indices should give us the
-    // corresponding node.
-    MDagPath curPath = instance2;
-    for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
-        const unsigned int i = *it;
+    std::reverse(indices->begin(), indices->end());
+    return true;
+}
+
+/// Applies the child \p indices computed by _GetChildIndices() to \p instance.
+/// We assume that the structure underneath all the instances of a node must be
+/// identical, down to the node order, since they are instances of one another.
+/// Thus, applying the same path indices should give us the corresponding node.
+static MDagPath
+_ApplyChildIndices(const MDagPath& instance, const std::vector<unsigned int>& indices)
+{
+    MDagPath curPath = instance;
+    for (const unsigned int i : indices) {
         if (i >= curPath.childCount()) {
             TF_CODING_ERROR(
                 "Child index %u is invalid for '%s'", i, curPath.fullPathName().asChar());
@@ -136,6 +129,34 @@ UsdMaya_InstancedNodeWriter::UsdMaya_InstancedNodeWriter(
     _usdPrim.GetReferences().AddReference(SdfReference(std::string(), referencePath));
     _usdPrim.SetInstanceable(true);
 
+    // The data of the master is the same for all of its instances, only
+    // gather it for the first one.
+    const MObjectHandle handle(mayaInstancePath.node());
+    auto                masterInfoIt = ctx._objectsToMasterInfo.find(handle);
+    if (masterInfoIt == ctx._objectsToMasterInfo.end()) {
+        masterInfoIt
+            = ctx._objectsToMasterInfo.emplace(handle, _GatherMasterInfo(mayaInstancePath)).first;
+    }
+    const UsdMayaWriteJobContext::_InstanceMasterInfo& masterInfo = masterInfoIt->second;
+
+    _exportsGprims = masterInfo.exportsGprims;
+    _modelPaths = masterInfo.modelPaths;
+
+    // Re-anchor the DAG-USD path mapping of the master under this instance.
+    for (const auto& entry : masterInfo.dagToUsdPaths) {
+        const MDagPath dagProxyPath = _ApplyChildIndices(mayaInstancePath, entry.first);
+        if (!dagProxyPath.isValid()) {
+            continue;
+        }
+        _dagToUsdPaths[dagProxyPath] = entry.second.ReplacePrefix(referencePath, usdInstancePath);
+    }
+}
+
+UsdMayaWriteJobContext::_InstanceMasterInfo
+UsdMaya_InstancedNodeWriter::_GatherMasterInfo(const MDagPath& mayaInstancePath) const
+{
+    UsdMayaWriteJobContext::_InstanceMasterInfo masterInfo;
+
     // Get the Maya DAG path corresponding to our "instance master" root.
     // We used the 0th instance to write out the USD instance master.
     MDagPathArray allInstances;
@@ -143,43 +164,44 @@ UsdMaya_InstancedNodeWriter::UsdMaya_InstancedNodeWriter(
     if (allInstances.length() == 0) {
         TF_CODING_ERROR(
             "'%s' should have at least one path", mayaInstancePath.fullPathName().asChar());
-        return;
+        return masterInfo;
     }
     const MDagPath dagMasterRootPath = allInstances[0];
 
     // Loop through our prim writers and compute cached data.
     std::vector<UsdMayaPrimWriterSharedPtr>::const_iterator begin;
     std::vector<UsdMayaPrimWriterSharedPtr>::const_iterator end;
-    const MDagPath                                          path = GetDagPath();
-    if (_writeJobCtx._GetInstanceMasterPrimWriters(path, &begin, &end)) {
-        for (auto it = begin; it != end; ++it) {
-            const UsdMayaPrimWriterSharedPtr writer = *it;
-
-            // We export gprims if any of the subtree writers does.
-            if (writer->ExportsGprims()) {
-                _exportsGprims = true;
-            }
+    if (!_writeJobCtx._GetInstanceMasterPrimWriters(mayaInstancePath, &begin, &end)) {
+        return masterInfo;
+    }
+
+    std::vector<unsigned int> indices;
+    for (auto it = begin; it != end; ++it) {
+        const UsdMayaPrimWriterSharedPtr writer = *it;
 
-            // All of the subtree model paths are our model paths.
-            const SdfPathVector& writerModelPaths = writer->GetModelPaths();
-            _modelPaths.insert(
-                _modelPaths.begin(), writerModelPaths.begin(), writerModelPaths.end());
-
-            // Replace prefixes to obtain DAG-USD path mapping.
-            const UsdMayaUtil::MDagPathMap<SdfPath>& writerMapping
-                = writer->GetDagToUsdPathMapping();
-            for (const auto& pair : writerMapping) {
-                const MDagPath& dagPathInMaster = pair.first;
-                const SdfPath&  usdPathInMaster = pair.second;
-
-                const MDagPath& dagProxyPath
-                    = _ReplaceInstancePrefix(dagPathInMaster, dagMasterRootPath, mayaInstancePath);
-                const SdfPath& usdProxyPath
-                    = usdPathInMaster.ReplacePrefix(referencePath, usdInstancePath);
-                _dagToUsdPaths[dagProxyPath] = usdProxyPath;
+        // We export gprims if any of the subtree writers does.
+        if (writer->ExportsGprims()) {
+            masterInfo.exportsGprims = true;
+        }
+
+        // All of the subtree model paths are our model paths.
+        const SdfPathVector& writerModelPaths = writer->GetModelPaths();
+        masterInfo.modelPaths.insert(
+            masterInfo.modelPaths.begin(), writerModelPaths.begin(), writerModelPaths.end());
+
+        // Record where each DAG path is under the master root, so that it can
+        // be found under any instance.
+        const UsdMayaUtil::MDagPathMap<SdfPath>& writerMapping = writer->GetDagToUsdPathMapping();
+        for (const auto& pair : writerMapping) {
+            const MDagPath& dagPathInMaster = pair.first;
+            const SdfPath&  usdPathInMaster = pair.second;
+            if (_GetChildIndices(dagPathInMaster, dagMasterRootPath, &indices)) {
+                masterInfo.dagToUsdPaths.emplace_back(indices, usdPathInMaster);
             }
         }
     }
+
+    return masterInfo;
 }
 
 /* virtual */
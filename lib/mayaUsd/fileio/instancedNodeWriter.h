@@ -47,6 +47,11 @@ public:
     void                                     Write(const UsdTimeCode& usdTime) override;
 
 private:
+    /// Gathers the data of the instance master of \p mayaInstancePath from
+    /// the master's prim writers.
+    UsdMayaWriteJobContext::_InstanceMasterInfo
+    _GatherMasterInfo(const MDagPath& mayaInstancePath) const;
+
     UsdMayaWriteJobContext::_ExportAndRefPaths _masterPaths;
 
     // All of the data below is cached when we construct/obtain prim writers.
@@ -133,6 +133,14 @@ double _ExtractMetersPerUnit(const VtDictionary& userArgs)
     return value;
 }
 
+// The chunk size is passed as a double, since the argument parser has no integer type.
+size_t _ExtractValueClipChunkSize(const VtDictionary& userArgs)
+{
+    const double value
+        = extractDouble(userArgs, UsdMayaJobExportArgsTokens->valueClipChunkSize, 0.0);
+    return value >= 1.0 ? static_cast<size_t>(value) : 0;
+}
+
 std::map<std::string, std::string> _UVSetRemaps(const VtDictionary& userArgs, const TfToken& key)
 {
     const std::vector<std::vector<VtValue>> uvRemaps
@@ -604,6 +612,8 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
     , exportAssignedMaterials(
           extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportAssignedMaterials))
     , legacyMaterialScope(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->legacyMaterialScope))
+    , mergeIdenticalMaterials(
+          extractBoolean(userArgs, UsdMayaJobExportArgsTokens->mergeIdenticalMaterials))
     , exportDefaultCameras(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->defaultCameras))
     , exportDisplayColor(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportDisplayColor))
     , exportDistanceUnit(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportDistanceUnit))
@@ -685,6 +695,7 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->convertMaterialsTo))
     , verbose(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->verbose))
     , staticSingleSample(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->staticSingleSample))
+    , valueClipChunkSize(_ExtractValueClipChunkSize(userArgs))
     , geomSidedness(extractToken(
           userArgs,
           UsdMayaJobExportArgsTokens->geomSidedness,
@@ -733,6 +744,8 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "exportAssignedMaterials: " << TfStringify(exportArgs.exportAssignedMaterials)
         << std::endl
         << "legacyMaterialScope: " << TfStringify(exportArgs.legacyMaterialScope) << std::endl
+        << "mergeIdenticalMaterials: " << TfStringify(exportArgs.mergeIdenticalMaterials)
+        << std::endl
         << "exportDefaultCameras: " << TfStringify(exportArgs.exportDefaultCameras) << std::endl
         << "exportDisplayColor: " << TfStringify(exportArgs.exportDisplayColor) << std::endl
         << "exportDistanceUnit: " << TfStringify(exportArgs.exportDistanceUnit) << std::endl
@@ -787,6 +800,7 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "worldspace: " << TfStringify(exportArgs.worldspace) << std::endl
         << "timeSamples: " << exportArgs.timeSamples.size() << " sample(s)" << std::endl
         << "staticSingleSample: " << TfStringify(exportArgs.staticSingleSample) << std::endl
+        << "valueClipChunkSize: " << exportArgs.valueClipChunkSize << std::endl
         << "geomSidedness: " << TfStringify(exportArgs.geomSidedness) << std::endl
         << "usdModelRootOverridePath: " << exportArgs.usdModelRootOverridePath << std::endl;
 
@@ -1025,6 +1039,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->exportMaterials] = true;
         d[UsdMayaJobExportArgsTokens->exportAssignedMaterials] = true;
         d[UsdMayaJobExportArgsTokens->legacyMaterialScope] = false;
+        d[UsdMayaJobExportArgsTokens->mergeIdenticalMaterials] = false;
         d[UsdMayaJobExportArgsTokens->exportDisplayColor] = false;
         d[UsdMayaJobExportArgsTokens->exportDistanceUnit] = true;
         d[UsdMayaJobExportArgsTokens->exportInstances] = true;
@@ -1075,6 +1090,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = false;
         d[UsdMayaJobExportArgsTokens->verbose] = false;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = false;
+        d[UsdMayaJobExportArgsTokens->valueClipChunkSize] = 0.0;
         d[UsdMayaJobExportArgsTokens->geomSidedness]
             = UsdMayaJobExportArgsTokens->derived.GetString();
         d[UsdMayaJobExportArgsTokens->customLayerData] = std::vector<VtValue>();
@@ -1131,6 +1147,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->exportMaterials] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportAssignedMaterials] = _boolean;
         d[UsdMayaJobExportArgsTokens->legacyMaterialScope] = _boolean;
+        d[UsdMayaJobExportArgsTokens->mergeIdenticalMaterials] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportDisplayColor] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportDistanceUnit] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportInstances] = _boolean;
@@ -1176,6 +1193,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = _boolean;
         d[UsdMayaJobExportArgsTokens->verbose] = _boolean;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = _boolean;
+        d[UsdMayaJobExportArgsTokens->valueClipChunkSize] = _double;
         d[UsdMayaJobExportArgsTokens->geomSidedness] = _string;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = _stringVector;
         d[UsdMayaJobExportArgsTokens->defaultPrim] = _string;
@@ -73,6 +73,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (exportMaterials) \
     (exportAssignedMaterials) \
     (legacyMaterialScope) \
+    (mergeIdenticalMaterials) \
     (exportDisplayColor) \
     (exportDistanceUnit) \
     (exportInstances) \
@@ -116,6 +117,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (stripNamespaces) \
     (verbose) \
     (staticSingleSample) \
+    (valueClipChunkSize) \
     (geomSidedness)   \
     (worldspace) \
     (writeDefaults) \
@@ -212,6 +214,7 @@ struct UsdMayaJobExportArgs
     const bool        exportMaterials;
     const bool        exportAssignedMaterials;
     const bool        legacyMaterialScope;
+    const bool        mergeIdenticalMaterials;
     const bool        exportDefaultCameras;
     const bool        exportDisplayColor;
     const bool        exportDistanceUnit;
@@ -266,6 +269,9 @@ struct UsdMayaJobExportArgs
     const TfToken::Set allMaterialConversions;
     const bool         verbose;
     const bool         staticSingleSample;
+    // Number of time samples per value clip, or zero to write all the time
+    // samples into the exported layer.
+    const size_t       valueClipChunkSize;
     const TfToken      geomSidedness;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
@@ -19,6 +19,7 @@
 #include <mayaUsd/fileio/primReaderRegistry.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
+#include <mayaUsd/fileio/utils/meshReadUtils.h>
 #include <mayaUsd/fileio/utils/readUtil.h>
 #include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItemMuting.h>
@@ -41,6 +42,7 @@
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usd/zipFile.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
@@ -649,7 +651,17 @@ bool UsdMaya_ReadJob::_DoImport(
             : UsdPrimRange::PreAndPostVisit(
                 rootPrim, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate));
 
-        const int                     loopSize = std::distance(range.begin(), range.end());
+        // Gather the meshes of the subtree while counting its prims, so that
+        // their USD data can be read in parallel ahead of their creation.
+        int                      loopSize = 0;
+        std::vector<UsdGeomMesh> meshes;
+        for (auto primIt = range.begin(); primIt != range.end(); ++primIt, ++loopSize) {
+            if (!primIt.IsPostVisit() && primIt->IsA<UsdGeomMesh>()) {
+                meshes.emplace_back(*primIt);
+            }
+        }
+        UsdMayaMeshReadUtils::MeshPrefetchScope meshPrefetch(meshes, mArgs.timeInterval);
+
         MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
         for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
             const UsdPrim&           prim = *primIt;
@@ -15,17 +15,23 @@
 //
 #include "writeJob.h"
 
+#include <pxr/base/gf/vec2d.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/hash.h>
 #include <pxr/base/tf/hashset.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/sdf/schema.h>
 
 #include <maya/MAnimControl.h>
 #include <maya/MComputation.h>
@@ -59,6 +65,7 @@
 
 #include <pxr/usd/sdf/variantSetSpec.h>
 #include <pxr/usd/sdf/variantSpec.h>
+#include <pxr/usd/usd/clipsAPI.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/primRange.h>
@@ -139,6 +146,11 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
             MGlobal::viewFrame(t);
             progressBar.advance();
 
+            if (_useValueClips && !_PrepareValueClip(t)) {
+                MGlobal::viewFrame(oldCurTime);
+                return false;
+            }
+
             // Process per frame data.
             if (!_WriteFrame(t)) {
                 MGlobal::viewFrame(oldCurTime);
@@ -153,6 +165,10 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 
         // Set the time back.
         MGlobal::viewFrame(oldCurTime);
+
+        if (_useValueClips && !(_EndValueClip() && _WriteValueClipMetadata())) {
+            return false;
+        }
     }
 
     // Finalize the export, close the stage.
@@ -294,6 +310,16 @@ bool UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         _fileName = fileNameWithExt;
         _packageName = std::string();
     }
+
+    _useValueClips = mJobCtx.mArgs.valueClipChunkSize > 0 && !mJobCtx.mArgs.timeSamples.empty();
+    if (_useValueClips
+        && (append || !_packageName.empty() || SdfLayer::IsAnonymousLayerIdentifier(_fileName))) {
+        TF_WARN(
+            "Value clips cannot be exported when appending, packaging or exporting to an "
+            "anonymous layer. Writing all the time samples to '%s'.",
+            _fileName.c_str());
+        _useValueClips = false;
+    }
     progressBar.advance();
 
     TF_STATUS("Opening layer '%s' for writing", _fileName.c_str());
@@ -683,6 +709,253 @@ bool UsdMaya_WriteJob::_FinishWriting()
     return true;
 }
 
+/// Returns the name of the value clip of the given index for the exported file
+/// of the given stem.
+static std::string _GetValueClipName(const std::string& stem, size_t index)
+{
+    return TfStringPrintf(
+        "%s.clip%zu.%s",
+        stem.c_str(),
+        index,
+        UsdMayaTranslatorTokens->UsdFileExtensionCrate.GetText());
+}
+
+/// Creates a new layer at \p layerPath. A layer of a previous export may still
+/// be open, in which case it is cleared and reused, as the exported layer is.
+static SdfLayerRefPtr _CreateOrClearLayer(const std::string& layerPath)
+{
+    if (SdfLayerRefPtr existingLayer = SdfLayer::Find(layerPath)) {
+        existingLayer->Clear();
+        return existingLayer;
+    }
+    return SdfLayer::CreateNew(layerPath);
+}
+
+/// Moves the opinions of \p clipLayer that are not time samples to \p layer,
+/// as value clips only provide time samples.
+static void _MoveNonTimeSampleOpinions(const SdfLayerHandle& clipLayer, const SdfLayerHandle& layer)
+{
+    std::vector<SdfPath> paths;
+    clipLayer->Traverse(
+        SdfPath::AbsoluteRootPath(), [&paths](const SdfPath& path) { paths.push_back(path); });
+
+    const SdfSchemaBase& schema = clipLayer->GetSchema();
+    SdfChangeBlock       changeBlock;
+    for (const SdfPath& path : paths) {
+        const SdfSpecType specType = clipLayer->GetSpecType(path);
+        const bool        isPrim = specType == SdfSpecTypePrim;
+        const bool        isProperty
+            = specType == SdfSpecTypeAttribute || specType == SdfSpecTypeRelationship;
+
+        // The specifier, type and variability of the properties are needed for
+        // the time samples and are also authored in the manifest.
+        std::vector<TfToken> fields;
+        for (const TfToken& field : clipLayer->ListFields(path)) {
+            if (field == SdfFieldKeys->TimeSamples || schema.HoldsChildren(field)
+                || (isPrim && field == SdfFieldKeys->Specifier
+                    && clipLayer->GetFieldAs<SdfSpecifier>(path, field) == SdfSpecifierOver)
+                || (isProperty
+                    && (field == SdfFieldKeys->TypeName || field == SdfFieldKeys->Custom
+                        || field == SdfFieldKeys->Variability))) {
+                continue;
+            }
+            fields.push_back(field);
+        }
+        if (fields.empty()) {
+            continue;
+        }
+
+        if (!isPrim && !isProperty && specType != SdfSpecTypePseudoRoot) {
+            TF_WARN(
+                "Opinions authored at <%s> while exporting value clips are not exported",
+                path.GetText());
+            continue;
+        }
+
+        if (isPrim) {
+            SdfCreatePrimInLayer(layer, path);
+        } else if (isProperty && !layer->HasSpec(path)) {
+            const SdfPrimSpecHandle primSpec = SdfCreatePrimInLayer(layer, path.GetPrimPath());
+            if (specType == SdfSpecTypeAttribute) {
+                const SdfAttributeSpecHandle attr = clipLayer->GetAttributeAtPath(path);
+                SdfAttributeSpec::New(
+                    primSpec,
+                    path.GetName(),
+                    attr->GetTypeName(),
+                    attr->GetVariability(),
+                    attr->IsCustom());
+            } else {
+                const SdfRelationshipSpecHandle rel = clipLayer->GetRelationshipAtPath(path);
+                SdfRelationshipSpec::New(
+                    primSpec, path.GetName(), rel->IsCustom(), rel->GetVariability());
+            }
+        }
+
+        for (const TfToken& field : fields) {
+            layer->SetField(path, field, clipLayer->GetField(path, field));
+            if (field == SdfFieldKeys->Specifier) {
+                clipLayer->SetField(path, field, VtValue(SdfSpecifierOver));
+            } else {
+                clipLayer->EraseField(path, field);
+            }
+        }
+    }
+}
+
+bool UsdMaya_WriteJob::_PrepareValueClip(double iFrame)
+{
+    _valueClips.endTime = iFrame;
+
+    if (_valueClips.clipLayer && _valueClips.clipSampleCount < mJobCtx.mArgs.valueClipChunkSize) {
+        ++_valueClips.clipSampleCount;
+        return true;
+    }
+
+    if (!_EndValueClip()) {
+        return false;
+    }
+
+    // The clips and their manifest are written next to the exported file and
+    // referenced relative to it.
+    const std::string dir = TfGetPathName(_fileName);
+    const std::string stem = TfStringGetBeforeSuffix(TfGetBaseName(_fileName));
+
+    if (!_valueClips.manifest) {
+        const std::string manifestName = TfStringPrintf(
+            "%s.manifest.%s",
+            stem.c_str(),
+            UsdMayaTranslatorTokens->UsdFileExtensionASCII.GetText());
+        _valueClips.manifest = _CreateOrClearLayer(dir + manifestName);
+        if (!_valueClips.manifest) {
+            TF_RUNTIME_ERROR("Could not create the value clip manifest '%s'", manifestName.c_str());
+            return false;
+        }
+        _valueClips.manifestAssetPath = "./" + manifestName;
+    }
+
+    const std::string clipName = _GetValueClipName(stem, _valueClips.assetPaths.size() + 1);
+    SdfLayerRefPtr    clipLayer = _CreateOrClearLayer(dir + clipName);
+    if (!clipLayer) {
+        TF_RUNTIME_ERROR("Could not create the value clip '%s'", clipName.c_str());
+        return false;
+    }
+
+    _valueClips.clipLayer = clipLayer;
+    _valueClips.clipSampleCount = 1;
+    _valueClips.assetPaths.push_back("./" + clipName);
+    _valueClips.startTimes.push_back(iFrame);
+
+    // The edit target must be in the layer stack of the stage, so the clip is
+    // a sublayer of the exported layer until it is full.
+    mJobCtx.mStage->GetRootLayer()->InsertSubLayerPath(clipLayer->GetIdentifier(), 0);
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(clipLayer));
+    return true;
+}
+
+bool UsdMaya_WriteJob::_EndValueClip()
+{
+    if (!_valueClips.clipLayer) {
+        return true;
+    }
+
+    SdfLayerRefPtr clipLayer = _valueClips.clipLayer;
+    _valueClips.clipLayer = SdfLayerRefPtr();
+
+    const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+    mJobCtx.mStage->SetEditTarget(UsdEditTarget(rootLayer));
+    const size_t index = rootLayer->GetSubLayerPaths().Find(clipLayer->GetIdentifier());
+    if (index != size_t(-1)) {
+        rootLayer->RemoveSubLayerPath(static_cast<int>(index));
+    }
+
+    // Writers and chasers may author more than time samples while the clip is
+    // the edit target.
+    _MoveNonTimeSampleOpinions(clipLayer, rootLayer);
+
+    // The manifest declares every attribute that has samples in any clip.
+    const SdfLayerRefPtr& manifest = _valueClips.manifest;
+    clipLayer->Traverse(SdfPath::AbsoluteRootPath(), [&clipLayer, &manifest](const SdfPath& path) {
+        if (!path.IsPrimPropertyPath() || manifest->GetAttributeAtPath(path)) {
+            return;
+        }
+        const SdfAttributeSpecHandle attr = clipLayer->GetAttributeAtPath(path);
+        if (!attr || clipLayer->GetNumTimeSamplesForPath(path) == 0) {
+            return;
+        }
+        SdfAttributeSpec::New(
+            SdfCreatePrimInLayer(manifest, path.GetPrimPath()),
+            path.GetName(),
+            attr->GetTypeName(),
+            attr->GetVariability(),
+            attr->IsCustom());
+    });
+
+    for (const SdfPrimSpecHandle& rootPrim : clipLayer->GetRootPrims()) {
+        _valueClips.rootPaths.insert(rootPrim->GetPath());
+    }
+
+    if (!clipLayer->Save()) {
+        TF_RUNTIME_ERROR("Could not save the value clip '%s'", clipLayer->GetIdentifier().c_str());
+        return false;
+    }
+    return true;
+}
+
+bool UsdMaya_WriteJob::_WriteValueClipMetadata()
+{
+    // Remove the clips of a previous export of the same file into more clips,
+    // which are no longer referenced.
+    const std::string dir = TfGetPathName(_fileName);
+    const std::string stem = TfStringGetBeforeSuffix(TfGetBaseName(_fileName));
+    for (size_t index = _valueClips.assetPaths.size() + 1;; ++index) {
+        const std::string clipPath = dir + _GetValueClipName(stem, index);
+        if (!TfIsFile(clipPath) || !TfDeleteFile(clipPath)) {
+            break;
+        }
+    }
+
+    if (_valueClips.assetPaths.empty()) {
+        return true;
+    }
+
+    if (!_valueClips.manifest->Save()) {
+        TF_RUNTIME_ERROR(
+            "Could not save the value clip manifest '%s'",
+            _valueClips.manifest->GetIdentifier().c_str());
+        return false;
+    }
+
+    VtArray<SdfAssetPath> assetPaths;
+    VtVec2dArray          active;
+    for (size_t i = 0; i < _valueClips.assetPaths.size(); ++i) {
+        assetPaths.push_back(SdfAssetPath(_valueClips.assetPaths[i]));
+        active.push_back(GfVec2d(_valueClips.startTimes[i], static_cast<double>(i)));
+    }
+
+    // The clips hold their samples at the stage times.
+    const double startTime = _valueClips.startTimes.front();
+    VtVec2dArray times { GfVec2d(startTime, startTime) };
+    if (_valueClips.endTime > startTime) {
+        times.push_back(GfVec2d(_valueClips.endTime, _valueClips.endTime));
+    }
+
+    const SdfAssetPath manifestPath(_valueClips.manifestAssetPath);
+    for (const SdfPath& rootPath : _valueClips.rootPaths) {
+        UsdClipsAPI clipsAPI(mJobCtx.mStage->GetPrimAtPath(rootPath));
+        if (!clipsAPI) {
+            continue;
+        }
+        clipsAPI.SetClipPrimPath(rootPath.GetString());
+        clipsAPI.SetClipAssetPaths(assetPaths);
+        clipsAPI.SetClipActive(active);
+        clipsAPI.SetClipTimes(times);
+        clipsAPI.SetClipManifestAssetPath(manifestPath);
+    }
+
+    _valueClips = _ValueClips();
+    return true;
+}
+
 TfToken UsdMaya_WriteJob::_WriteVariants(const UsdPrim& usdRootPrim)
 {
     // Some notes about the expected structure that this function will create:
@@ -23,10 +23,13 @@
 
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <maya/MObjectHandle.h>
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -74,6 +77,19 @@ private:
     /// to disk.
     bool _FinishWriting();
 
+    /// Makes the samples at the given time go into the current value clip,
+    /// starting a new one when the current one is full.
+    bool _PrepareValueClip(double iFrame);
+
+    /// Saves the current value clip, adds its attributes to the clip manifest
+    /// and removes it from the stage, so that its samples no longer use memory.
+    /// Its opinions that are not time samples are moved to the exported layer.
+    bool _EndValueClip();
+
+    /// Saves the clip manifest and authors the value clips on the root prims.
+    /// The clips left over by a previous export of the same file are removed.
+    bool _WriteValueClipMetadata();
+
     /// Writes the root prim variants based on the Maya render layers.
     TfToken _WriteVariants(const UsdPrim& usdRootPrim);
 
@@ -94,6 +110,23 @@ private:
     // Name of destination packaged archive.
     std::string _packageName;
 
+    // Value clips the time samples are streamed into when the export args give
+    // a chunk size. The exported layer holds everything else, the clips only
+    // hold time samples.
+    struct _ValueClips
+    {
+        SdfLayerRefPtr           clipLayer;
+        size_t                   clipSampleCount { 0 };
+        SdfLayerRefPtr           manifest;
+        std::string              manifestAssetPath;
+        std::vector<std::string> assetPaths;
+        std::vector<double>      startTimes;
+        double                   endTime { 0.0 };
+        SdfPathSet               rootPaths;
+    };
+    bool        _useValueClips { false };
+    _ValueClips _valueClips;
+
     // Name of current layer since it should be restored after looping over them
     MString mCurrentRenderLayerName;
 
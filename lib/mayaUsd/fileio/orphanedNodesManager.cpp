@@ -46,6 +46,16 @@ OrphanedNodesManager::Memento::Memento(PulledPrims&& pulledPrims)
 {
 }
 
+OrphanedNodesManager::Memento::Memento(
+    const Ufe::Path&   changedPath,
+    PullVariantInfos&& previousInfos)
+    : _pulledPrims()
+    , _isEntireState(false)
+    , _changedPath(changedPath)
+    , _previousInfos(std::move(previousInfos))
+{
+}
+
 OrphanedNodesManager::Memento::Memento()
     : _pulledPrims()
 {
@@ -53,12 +63,18 @@ OrphanedNodesManager::Memento::Memento()
 
 OrphanedNodesManager::Memento::Memento(Memento&& rhs)
     : _pulledPrims(std::move(rhs._pulledPrims))
+    , _isEntireState(rhs._isEntireState)
+    , _changedPath(std::move(rhs._changedPath))
+    , _previousInfos(std::move(rhs._previousInfos))
 {
 }
 
 OrphanedNodesManager::Memento& OrphanedNodesManager::Memento::operator=(Memento&& rhs)
 {
     _pulledPrims = std::move(rhs._pulledPrims);
+    _isEntireState = rhs._isEntireState;
+    _changedPath = std::move(rhs._changedPath);
+    _previousInfos = std::move(rhs._previousInfos);
     return *this;
 }
 
@@ -277,8 +293,10 @@ void OrphanedNodesManager::add(const Ufe::Path& pulledPath, const MDagPath& edit
 OrphanedNodesManager::Memento
 OrphanedNodesManager::remove(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot)
 {
-    Memento             oldPulledPrims(preserve());
+    // Only the pull information of the removed path changes, so it is all
+    // that is needed to undo the removal.
     PulledPrimNode::Ptr node = _pulledPrims.find(pulledPath);
+    Memento oldPulledPrims(pulledPath, node ? PullVariantInfos(node->data()) : PullVariantInfos());
     if (node) {
         PullVariantInfos infos = node->data();
         for (size_t i = infos.size() - 1; i != size_t(0) - size_t(1); --i) {
@@ -463,7 +481,25 @@ OrphanedNodesManager::Memento OrphanedNodesManager::preserve() const
     return Memento(deepCopy(_pulledPrims));
 }
 
-void OrphanedNodesManager::restore(Memento&& previous) { _pulledPrims = previous.release(); }
+void OrphanedNodesManager::restore(Memento&& previous)
+{
+    if (previous._isEntireState) {
+        _pulledPrims = previous.release();
+        return;
+    }
+
+    // The path had no pull information before the change: remove() did not
+    // modify the trie.
+    if (previous._previousInfos.empty())
+        return;
+
+    PulledPrimNode::Ptr node = _pulledPrims.find(previous._changedPath);
+    if (node) {
+        node->setData(std::move(previous._previousInfos));
+    } else {
+        _pulledPrims.add(previous._changedPath, std::move(previous._previousInfos));
+    }
+}
 
 bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot)
     const
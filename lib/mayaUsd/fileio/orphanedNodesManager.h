@@ -101,7 +101,12 @@ public:
     using PulledPrims = Ufe::Trie<PullVariantInfos>;
     using PulledPrimNode = Ufe::TrieNode<PullVariantInfos>;
 
-    /// \brief Entire state of the OrphanedNodesManager at a point in time, used for undo/redo.
+    /// \brief State of the OrphanedNodesManager at a point in time, used for undo/redo.
+    ///
+    /// A memento either holds the entire state, as returned by preserve(), or
+    /// only the pull information of the single path changed by remove(). The
+    /// latter keeps undo of a merge proportional to the changed path instead of
+    /// to the number of pulled prims.
     class MAYAUSD_CORE_PUBLIC Memento
     {
     public:
@@ -115,7 +120,9 @@ public:
         Memento(const Memento&) = delete;
         Memento& operator=(const Memento&) = delete;
 
+        // Only the entire state can be converted to JSON.
         static std::string convertToJson(const Memento&);
+        static std::string convertToJson(const PulledPrims&);
         static Memento     convertFromJson(const std::string&);
 
     private:
@@ -123,10 +130,17 @@ public:
         friend class OrphanedNodesManager;
 
         Memento(PulledPrims&& pulledPrims);
+        Memento(const Ufe::Path& changedPath, PullVariantInfos&& previousInfos);
 
         PulledPrims release();
 
         PulledPrims _pulledPrims;
+
+        // When the memento only holds a single changed path, its pull
+        // information before the change.
+        bool             _isEntireState { true };
+        Ufe::Path        _changedPath;
+        PullVariantInfos _previousInfos;
     };
 
     // Construct an empty orphan manager.
@@ -149,13 +163,16 @@ public:
 
     // Remove the pulled path from the trie of pulled prims.  Asserts that the
     // path is in the trie.  Returns a memento (see Memento Pattern) for undo
-    // purposes, to be used as argument to restore().
+    // purposes, to be used as argument to restore().  The memento only holds
+    // the previous pull information of the removed path.
     Memento remove(const Ufe::Path& pulledPath, const MDagPath& editedAsMayaRoot);
 
     // Preserve the trie of pulled prims into a memento.
     Memento preserve() const;
 
     // Restore the trie of pulled prims to the content of the argument memento.
+    // A memento returned by remove() must be restored in the state remove()
+    // left the trie in, as is the case when undoing.
     void restore(Memento&& previous);
 
     // Clear all pulled paths from the trie of pulled prims.
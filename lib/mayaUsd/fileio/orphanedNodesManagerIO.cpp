@@ -26,6 +26,8 @@
 #include <ufe/pathString.h>
 #include <ufe/trie.imp.h>
 
+#include <sstream>
+
 namespace MAYAUSD_NS_DEF {
 
 namespace {
@@ -96,113 +98,185 @@ using Memento = OrphanedNodesManager::Memento;
 
 ////////////////////////////////////////////////////////////////////////////
 //
-// Conversion functions to and from JSON for orphaned nodes types.
+// Conversion functions to JSON for orphaned nodes types.
+//
+// The pull information is streamed to the JSON writer while traversing the
+// trie, so that no intermediate JSON object tree is built.
 
-using MayaUsd::convertToArray;
-using MayaUsd::convertToObject;
 using MayaUsd::convertToValue;
 
-PXR_NS::JsArray  convertToArray(const VariantSelection& variantSel);
-PXR_NS::JsObject convertToObject(const VariantSetDesc& variantDesc);
-PXR_NS::JsArray  convertToArray(const std::list<VariantSetDesc>& allVariantDesc);
-PXR_NS::JsObject convertToObject(const PullVariantInfo& pullInfo);
-PXR_NS::JsObject convertToObject(const PullVariantInfos& pullInfos);
-PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNode);
-PXR_NS::JsObject convertToObject(const PullInfoTrie& allPulledInfo);
-
-VariantSelection   convertToVariantSelection(const PXR_NS::JsArray& variantSelJson);
-VariantSetDesc     convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson);
-VariantSetDescList convertToVariantSetDescList(const PXR_NS::JsArray& allVariantDescJson);
-PullVariantInfo    convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson);
-PullVariantInfos   convertToPullVariantInfos(const PXR_NS::JsObject& pullInfoJson);
-void         convertToPullInfoTrieNodePtr(const PXR_NS::JsObject&, PullInfoTrieNode::Ptr intoRoot);
-PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPulledInfoJson);
-
-PXR_NS::JsArray convertToArray(const VariantSelection& variantSel)
+void writeVariantSelection(PXR_NS::JsWriter& writer, const VariantSelection& variantSel)
 {
-    PXR_NS::JsArray variantSelJson;
+    writer.BeginArray();
+    writer.WriteValue(variantSel.variantSetName);
+    writer.WriteValue(variantSel.variantSelection);
+    writer.EndArray();
+}
 
-    variantSelJson.push_back(convertToValue(variantSel.variantSetName));
-    variantSelJson.push_back(convertToValue(variantSel.variantSelection));
+void writeVariantSetDescriptor(PXR_NS::JsWriter& writer, const VariantSetDesc& variantDesc)
+{
+    writer.BeginObject();
 
-    return variantSelJson;
+    writer.WriteKey(pathJsonKey);
+    PXR_NS::JsWriteValue(&writer, convertToValue(variantDesc.path));
+
+    writer.WriteKey(variantSelKey);
+    writer.BeginArray();
+    for (const auto& variantSel : variantDesc.variantSelections)
+        writeVariantSelection(writer, variantSel);
+    writer.EndArray();
+
+    writer.EndObject();
 }
 
-VariantSelection convertToVariantSelection(const PXR_NS::JsArray& variantSelJson)
+// Writes the members of the pull information, without the enclosing braces,
+// so that the first pull information and the trie node share the same object.
+void writePullVariantInfoMembers(PXR_NS::JsWriter& writer, const PullVariantInfo& pullInfo)
 {
-    VariantSelection variantSel;
+    writer.WriteKey(editedAsMayaRootJsonKey);
+    PXR_NS::JsWriteValue(&writer, convertToValue(pullInfo.editedAsMayaRoot));
+
+    writer.WriteKey(variantSetDescriptorsJsonKey);
+    writer.BeginArray();
+    for (const auto& variantDesc : pullInfo.variantSetDescriptors)
+        writeVariantSetDescriptor(writer, variantDesc);
+    writer.EndArray();
+}
 
-    if (variantSelJson.size() < 2)
-        throw std::runtime_error(invalidJson);
+void writePullVariantInfos(PXR_NS::JsWriter& writer, const PullVariantInfos& pullInfos)
+{
+    writer.BeginObject();
 
-    variantSel.variantSetName = convertToString(variantSelJson[0]);
-    variantSel.variantSelection = convertToString(variantSelJson[1]);
+    if (pullInfos.size() > 0) {
+        writePullVariantInfoMembers(writer, pullInfos[0]);
+    }
 
-    return variantSel;
+    if (pullInfos.size() > 1) {
+        writer.WriteKey(morePullInfoJsonKey);
+        writer.BeginArray();
+        for (size_t i = 1; i < pullInfos.size(); ++i) {
+            writer.BeginObject();
+            writePullVariantInfoMembers(writer, pullInfos[i]);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+
+    writer.EndObject();
 }
 
-PXR_NS::JsObject convertToObject(const VariantSetDesc& variantDesc)
+bool hasPullInfo(const PullInfoTrieNode& pullInfoNode)
 {
-    PXR_NS::JsObject variantDescJson;
+    return pullInfoNode.hasData() && pullInfoNode.data().size() > 0;
+}
 
-    variantDescJson[pathJsonKey] = convertToValue(variantDesc.path);
+// Returns true if the node or one of its descendants has pull information.
+// Empty sub-tries are not written.
+bool containsPullInfo(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
+{
+    if (!pullInfoNodePtr)
+        return false;
 
-    PXR_NS::JsArray selections;
+    if (hasPullInfo(*pullInfoNodePtr))
+        return true;
 
-    for (const auto& variantSel : variantDesc.variantSelections) {
-        selections.emplace_back(convertToArray(variantSel));
+    for (const auto& child : pullInfoNodePtr->childrenComponents()) {
+        if (containsPullInfo((*pullInfoNodePtr)[child]))
+            return true;
     }
 
-    variantDescJson[variantSelKey] = selections;
+    return false;
+}
 
-    return variantDescJson;
+void writePullInfoTrieNode(PXR_NS::JsWriter& writer, const PullInfoTrieNode::Ptr& pullInfoNodePtr)
+{
+    writer.BeginObject();
+
+    if (pullInfoNodePtr) {
+        const PullInfoTrieNode& pullInfoNode = *pullInfoNodePtr;
+
+        if (hasPullInfo(pullInfoNode)) {
+            writer.WriteKey(pullInfoJsonKey);
+            writePullVariantInfos(writer, pullInfoNode.data());
+        }
+
+        for (const auto& child : pullInfoNode.childrenComponents()) {
+            const PullInfoTrieNode::Ptr childNode = pullInfoNode[child];
+            if (!containsPullInfo(childNode))
+                continue;
+            writer.WriteKey(ufeComponentPrefix + child.string());
+            writePullInfoTrieNode(writer, childNode);
+        }
+    }
+
+    writer.EndObject();
 }
 
-VariantSetDesc convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson)
+////////////////////////////////////////////////////////////////////////////
+//
+// Conversion functions from JSON for orphaned nodes types.
+//
+// The parsed JSON is only accessed by reference, so that the nested objects
+// of the trie are not copied at each level.
+
+const PXR_NS::JsObject& objectRef(const PXR_NS::JsValue& value)
 {
-    VariantSetDesc variantDesc;
+    if (!value.IsObject())
+        throw std::runtime_error(invalidJson);
 
-    variantDesc.path = convertToUfePath(convertJsonKeyToValue(variantDescJson, pathJsonKey));
+    return value.GetJsObject();
+}
 
-    PXR_NS::JsArray variantSelectionsJson
-        = convertToArray(convertJsonKeyToValue(variantDescJson, variantSelKey));
+const PXR_NS::JsArray& arrayRef(const PXR_NS::JsValue& value)
+{
+    if (!value.IsArray())
+        throw std::runtime_error(invalidJson);
 
-    for (const PXR_NS::JsValue& value : variantSelectionsJson)
-        variantDesc.variantSelections.emplace_back(
-            convertToVariantSelection(convertToArray(value)));
+    return value.GetJsArray();
+}
 
-    return variantDesc;
+const PXR_NS::JsValue& keyValueRef(const PXR_NS::JsObject& object, const std::string& key)
+{
+    const auto pos = object.find(key);
+    if (pos == object.end())
+        throw std::runtime_error(invalidJson);
+
+    return pos->second;
 }
 
-PXR_NS::JsArray convertToArray(const std::list<VariantSetDesc>& allVariantDesc)
+VariantSelection convertToVariantSelection(const PXR_NS::JsArray& variantSelJson)
 {
-    PXR_NS::JsArray allVariantDescJson;
+    VariantSelection variantSel;
 
-    for (const auto& variantDesc : allVariantDesc) {
-        allVariantDescJson.emplace_back(convertToObject(variantDesc));
-    }
+    if (variantSelJson.size() < 2)
+        throw std::runtime_error(invalidJson);
+
+    variantSel.variantSetName = convertToString(variantSelJson[0]);
+    variantSel.variantSelection = convertToString(variantSelJson[1]);
 
-    return allVariantDescJson;
+    return variantSel;
 }
 
-VariantSetDescList convertToVariantSetDescList(const PXR_NS::JsArray& allVariantDescJson)
+VariantSetDesc convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson)
 {
-    VariantSetDescList allVariantDesc;
+    VariantSetDesc variantDesc;
 
-    for (const PXR_NS::JsValue& value : allVariantDescJson)
-        allVariantDesc.emplace_back(convertToVariantSetDescriptor(convertToObject(value)));
+    variantDesc.path = convertToUfePath(keyValueRef(variantDescJson, pathJsonKey));
 
-    return allVariantDesc;
+    for (const PXR_NS::JsValue& value : arrayRef(keyValueRef(variantDescJson, variantSelKey)))
+        variantDesc.variantSelections.emplace_back(convertToVariantSelection(arrayRef(value)));
+
+    return variantDesc;
 }
 
-PXR_NS::JsObject convertToObject(const PullVariantInfo& pullInfo)
+VariantSetDescList convertToVariantSetDescList(const PXR_NS::JsArray& allVariantDescJson)
 {
-    PXR_NS::JsObject pullInfoJson;
+    VariantSetDescList allVariantDesc;
 
-    pullInfoJson[editedAsMayaRootJsonKey] = convertToValue(pullInfo.editedAsMayaRoot);
-    pullInfoJson[variantSetDescriptorsJsonKey] = convertToArray(pullInfo.variantSetDescriptors);
+    for (const PXR_NS::JsValue& value : allVariantDescJson)
+        allVariantDesc.emplace_back(convertToVariantSetDescriptor(objectRef(value)));
 
-    return pullInfoJson;
+    return allVariantDesc;
 }
 
 PullVariantInfo convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson)
@@ -210,33 +284,13 @@ PullVariantInfo convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson)
     PullVariantInfo pullInfo;
 
     pullInfo.editedAsMayaRoot
-        = convertToDagPath(convertJsonKeyToValue(pullInfoJson, editedAsMayaRootJsonKey));
+        = convertToDagPath(keyValueRef(pullInfoJson, editedAsMayaRootJsonKey));
     pullInfo.variantSetDescriptors = convertToVariantSetDescList(
-        convertToArray(convertJsonKeyToValue(pullInfoJson, variantSetDescriptorsJsonKey)));
+        arrayRef(keyValueRef(pullInfoJson, variantSetDescriptorsJsonKey)));
 
     return pullInfo;
 }
 
-PXR_NS::JsObject convertToObject(const PullVariantInfos& pullInfos)
-{
-    PXR_NS::JsObject pullInfoJson;
-
-    if (pullInfos.size() > 0) {
-        pullInfoJson = convertToObject(pullInfos[0]);
-    }
-
-    if (pullInfos.size() > 1) {
-        PXR_NS::JsArray morePullInfoJson;
-        for (size_t i = 1; i < pullInfos.size(); ++i) {
-            PXR_NS::JsObject moreInfoJson = convertToObject(pullInfos[i]);
-            morePullInfoJson.emplace_back(moreInfoJson);
-        }
-        pullInfoJson[morePullInfoJsonKey] = morePullInfoJson;
-    }
-
-    return pullInfoJson;
-}
-
 PullVariantInfos convertToPullVariantInfos(const PXR_NS::JsObject& pullInfoJson)
 {
     PullVariantInfos pullInfos;
@@ -245,42 +299,18 @@ PullVariantInfos convertToPullVariantInfos(const PXR_NS::JsObject& pullInfoJson)
         pullInfos.emplace_back(convertToPullVariantInfo(pullInfoJson));
     }
 
-    if (pullInfoJson.count(morePullInfoJsonKey)) {
-        PXR_NS::JsArray morePullInfoJson
-            = convertToArray(convertJsonKeyToValue(pullInfoJson, morePullInfoJsonKey));
-        for (const PXR_NS::JsValue& value : morePullInfoJson) {
-            pullInfos.emplace_back(convertToPullVariantInfo(convertToObject(value)));
+    const auto morePullInfo = pullInfoJson.find(morePullInfoJsonKey);
+    if (morePullInfo != pullInfoJson.end()) {
+        for (const PXR_NS::JsValue& value : arrayRef(morePullInfo->second)) {
+            pullInfos.emplace_back(convertToPullVariantInfo(objectRef(value)));
         }
     }
     return pullInfos;
 }
 
-PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
-{
-    if (!pullInfoNodePtr)
-        return {};
-
-    const PullInfoTrieNode& pullInfoNode = *pullInfoNodePtr;
-
-    PXR_NS::JsObject pullInfoNodeJson;
-
-    if (pullInfoNode.hasData() && pullInfoNode.data().size() > 0) {
-        pullInfoNodeJson[pullInfoJsonKey] = convertToObject(pullInfoNode.data());
-    }
-
-    for (const auto& child : pullInfoNode.childrenComponents()) {
-        PXR_NS::JsObject childJson = convertToObject(pullInfoNode[child]);
-        if (childJson.empty())
-            continue;
-        pullInfoNodeJson[ufeComponentPrefix + child.string()] = childJson;
-    }
-
-    return pullInfoNodeJson;
-}
-
 void convertToPullInfoTrieNodePtr(
-    const PXR_NS::JsObject& pullInfoNodeJson,
-    PullInfoTrieNode::Ptr   intoRoot)
+    const PXR_NS::JsObject&      pullInfoNodeJson,
+    const PullInfoTrieNode::Ptr& intoRoot)
 {
     for (const auto& keyValue : pullInfoNodeJson) {
         const std::string&     key = keyValue.first;
@@ -288,26 +318,21 @@ void convertToPullInfoTrieNodePtr(
         if (key.size() <= 0) {
             continue;
         } else if (key == pullInfoJsonKey) {
-            intoRoot->setData(convertToPullVariantInfos(convertToObject(value)));
+            intoRoot->setData(convertToPullVariantInfos(objectRef(value)));
 
         } else if (key[0] == '/') {
             PullInfoTrieNode::Ptr child = std::make_shared<PullInfoTrieNode>(key.substr(1));
             intoRoot->add(child);
-            convertToPullInfoTrieNodePtr(convertToObject(value), child);
+            convertToPullInfoTrieNodePtr(objectRef(value), child);
         }
     }
 }
 
-PXR_NS::JsObject convertToObject(const PullInfoTrie& allPullInfo)
-{
-    return convertToObject(allPullInfo.root());
-}
-
-PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
+PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPulledInfoJson)
 {
     PullInfoTrie allPullInfo;
 
-    convertToPullInfoTrieNodePtr(allPullInfoJson, allPullInfo.root());
+    convertToPullInfoTrieNodePtr(allPulledInfoJson, allPullInfo.root());
 
     return allPullInfo;
 }
@@ -319,9 +344,24 @@ PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 // Conversion of OrphanedNodesManager::Memento to and from JSON.
 
 std::string Memento::convertToJson(const Memento& memento)
+{
+    if (!memento._isEntireState) {
+        // Note: the TF_CODING_ERROR macro needs to be used within the PXR_NS.
+        PXR_NAMESPACE_USING_DIRECTIVE
+        TF_CODING_ERROR("Only the entire orphaned nodes manager state can be converted to JSON.");
+        return {};
+    }
+
+    return convertToJson(memento._pulledPrims);
+}
+
+std::string Memento::convertToJson(const PulledPrims& pulledPrims)
 {
     try {
-        return PXR_NS::JsWriteToString(convertToObject(memento._pulledPrims));
+        std::ostringstream stream;
+        PXR_NS::JsWriter   writer(stream, PXR_NS::JsWriter::Style::Compact);
+        writePullInfoTrieNode(writer, pulledPrims.root());
+        return stream.str();
     } catch (const std::exception& e) {
         // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
         PXR_NAMESPACE_USING_DIRECTIVE
@@ -337,7 +377,8 @@ Memento Memento::convertFromJson(const std::string& json)
     Memento memento;
 
     try {
-        memento._pulledPrims = convertToPullInfoTrie(convertToObject(PXR_NS::JsParseString(json)));
+        const PXR_NS::JsValue parsed = PXR_NS::JsParseString(json);
+        memento._pulledPrims = convertToPullInfoTrie(objectRef(parsed));
     } catch (const std::exception& e) {
         // Note: the TF_RUNTIME_ERROR macro needs to be used within the PXR_NS.
         PXR_NAMESPACE_USING_DIRECTIVE
@@ -64,8 +64,12 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/trie.imp.h>
 
+#include <deque>
 #include <functional>
+#include <memory>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 using UpdaterFactoryFn = UsdMayaPrimUpdaterRegistry::UpdaterFactoryFn;
 using namespace MayaUsd;
@@ -561,11 +565,31 @@ struct PushExportResult
     std::vector<SdfPath>                 materialPaths;
 };
 
-PushExportResult pushExport(const MObject& mayaObject, const UsdMayaPrimUpdaterContext& context)
+// State of one pulled prim during a merge to USD.
+struct MergeToUsdItem
+{
+    Ufe::Path    pulledPath;
+    Ufe::Path    mayaPath;
+    MObject      mayaObject;
+    MDagPath     mayaDagPath;
+    MDagPath     pullParentPath;
+    VtDictionary ctxArgs;
+    UsdTimeCode  time;
+
+    std::unique_ptr<UsdMayaPrimUpdaterContext> context;
+
+    UsdStageRefPtr   srcStage;
+    PushExportResult exportResult;
+};
+
+PushExportResult pushExport(
+    const MObject&                   mayaObject,
+    const UsdMayaPrimUpdaterContext& context,
+    const UsdStageRefPtr&            stage = UsdStageRefPtr())
 {
     MayaUsd::ProgressBarScope progressBar(3);
 
-    UsdStageRefPtr srcStage = UsdStage::CreateInMemory();
+    UsdStageRefPtr srcStage = stage ? stage : UsdStage::CreateInMemory();
     SdfLayerRefPtr srcLayer = srcStage->GetRootLayer();
 
     PushExportResult result;
@@ -998,6 +1022,42 @@ void executeAdditionalCommands(const UsdMayaPrimUpdaterContext& context)
     UfeCommandUndoItem::execute("Additional final commands", cmds);
 }
 
+// Caches, per prim type, the updater factory to use for auto-edit. Types whose
+// updater does not support auto-pull map to an empty factory, so that most
+// prims of a scan are rejected with a single hash lookup instead of a registry
+// lookup. Each type is still looked up in the registry the first time it is
+// seen, so that plugins providing updaters keep being loaded on demand.
+class AutoEditTypeFilter
+{
+public:
+    // Returns the factory of the updater of the given type if it supports
+    // auto-pull, null otherwise.
+    const UpdaterFactoryFn* findAutoPullFactory(const TfToken& typeName)
+    {
+        // Untyped prims use the fallback updater, which never auto-edits.
+        if (typeName.IsEmpty())
+            return nullptr;
+
+        auto iter = _factories.find(typeName);
+        if (iter == _factories.end()) {
+            auto registryItem = UsdMayaPrimUpdaterRegistry::FindOrFallback(typeName);
+            auto supports = std::get<UsdMayaPrimUpdater::Supports>(registryItem);
+
+            UpdaterFactoryFn factory;
+            if ((supports & UsdMayaPrimUpdater::Supports::AutoPull)
+                == UsdMayaPrimUpdater::Supports::AutoPull)
+                factory = std::get<UpdaterFactoryFn>(registryItem);
+
+            iter = _factories.emplace(typeName, std::move(factory)).first;
+        }
+
+        return iter->second ? &iter->second : nullptr;
+    }
+
+private:
+    std::unordered_map<TfToken, UpdaterFactoryFn, TfToken::HashFunctor> _factories;
+};
+
 } // namespace
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -1035,13 +1095,19 @@ bool PrimUpdaterManager::mergeToUsd(
     const Ufe::Path&         pulledPath,
     const VtDictionary&      userArgs)
 {
-    MayaUsdProxyShapeBase* proxyShape = MayaUsd::ufe::getProxyShape(pulledPath);
-    if (!proxyShape) {
+    MDagPath dagPath;
+    if (MDagPath::getAPathTo(depNodeFn.object(), dagPath) != MS::kSuccess) {
         return false;
     }
 
-    auto pulledPrim = MayaUsd::ufe::ufePathToPrim(pulledPath);
-    if (!pulledPrim) {
+    return mergeToUsd(PulledPrimPaths { { pulledPath, dagPath } }, userArgs);
+}
+
+bool PrimUpdaterManager::mergeToUsd(
+    const PulledPrimPaths& pulledPrims,
+    const VtDictionary&    userArgs)
+{
+    if (pulledPrims.empty()) {
         return false;
     }
 
@@ -1050,51 +1116,90 @@ bool PrimUpdaterManager::mergeToUsd(
         VtDictionaryIsHolding<std::string>(userArgs, MayaUsdEditRoutingTokens->DestinationPrimName)
             ? "Caching to USD"
             : "Merging to USD");
-    MayaUsd::ProgressBarScope progressBar(11, progStr);
+    MayaUsd::ProgressBarScope progressBar(4, progStr);
     PushPullScope             scopeIt(_inPushPull);
 
-    auto ctxArgs = VtDictionaryOver(userArgs, UsdMayaJobExportArgs::GetDefaultDictionary());
+    auto baseArgs = VtDictionaryOver(userArgs, UsdMayaJobExportArgs::GetDefaultDictionary());
 
     // Note: when merging to USD, we don't want to automatically authors a USD kind
     //       on the root prim.
-    ctxArgs[UsdMayaJobExportArgsTokens->disableModelKindProcessor] = true;
+    baseArgs[UsdMayaJobExportArgsTokens->disableModelKindProcessor] = true;
 
-    auto       updaterArgs = UsdMayaPrimUpdaterArgs::createFromDictionary(ctxArgs);
-    auto       mayaPath = usdToMaya(pulledPath);
-    auto       mayaDagPath = MayaUsd::ufe::ufeToDagPath(mayaPath);
-    MDagPath   pullParentPath;
+    const auto updaterArgs = UsdMayaPrimUpdaterArgs::createFromDictionary(baseArgs);
     const bool isCopy = updaterArgs._copyOperation;
-    if (!isCopy) {
-        // The pull parent is simply the parent of the pulled path.
-        pullParentPath = MayaUsd::ufe::ufeToDagPath(mayaPath.pop());
-        if (!TF_VERIFY(pullParentPath.isValid())) {
-            return false;
-        }
-        if (!LockNodesUndoItem::lock("Merge to USD node unlocking", pullParentPath, false)) {
-            return false;
-        }
-    }
-    progressBar.advance();
 
-    // If the user-provided argument does *not* contain an animation key, then
-    // automatically infer if we should merge animations.
-    if (!VtDictionaryIsHolding<bool>(userArgs, UsdMayaJobExportArgsTokens->animation)) {
-        const bool isAnimated = PXR_NS::UsdMayaPrimUpdater::isAnimated(mayaDagPath);
-        GfInterval timeInterval = isAnimated
-            ? GfInterval(MAnimControl::minTime().value(), MAnimControl::maxTime().value())
-            : GfInterval();
-
-        ctxArgs[UsdMayaJobExportArgsTokens->animation] = isAnimated;
-        ctxArgs[UsdMayaJobExportArgsTokens->frameStride] = 1.0;
-        ctxArgs[UsdMayaJobExportArgsTokens->startTime] = timeInterval.GetMin();
-        ctxArgs[UsdMayaJobExportArgsTokens->endTime] = timeInterval.GetMax();
-    } else if (ctxArgs[UsdMayaJobExportArgsTokens->animation] == true) {
-        // If user asked for animation but there is no animation, skip the exportation of animation.
-        const bool isAnimated = PXR_NS::UsdMayaPrimUpdater::isAnimated(mayaDagPath);
-        if (!isAnimated)
-            ctxArgs[UsdMayaJobExportArgsTokens->animation] = false;
+    // Validate every pulled prim and prepare its merge context before
+    // modifying anything. The items are kept in a deque because the context
+    // refers to the item time and arguments.
+    std::deque<MergeToUsdItem> items;
+    {
+        std::unordered_set<Ufe::Path> seenPaths;
+
+        MayaUsd::ProgressBarLoopScope prepareLoop(pulledPrims.size());
+        for (const auto& pulledPrim : pulledPrims) {
+            const Ufe::Path& pulledPath = pulledPrim.first;
+            if (!seenPaths.insert(pulledPath).second) {
+                prepareLoop.loopAdvance();
+                continue;
+            }
+
+            MayaUsdProxyShapeBase* proxyShape = MayaUsd::ufe::getProxyShape(pulledPath);
+            if (!proxyShape) {
+                return false;
+            }
+
+            if (!MayaUsd::ufe::ufePathToPrim(pulledPath)) {
+                return false;
+            }
+
+            items.emplace_back();
+            MergeToUsdItem& item = items.back();
+            item.pulledPath = pulledPath;
+            item.mayaObject = pulledPrim.second.node();
+            item.mayaPath = usdToMaya(pulledPath);
+            item.mayaDagPath = MayaUsd::ufe::ufeToDagPath(item.mayaPath);
+            item.ctxArgs = baseArgs;
+
+            if (!isCopy) {
+                // The pull parent is simply the parent of the pulled path.
+                item.pullParentPath = MayaUsd::ufe::ufeToDagPath(item.mayaPath.pop());
+                if (!TF_VERIFY(item.pullParentPath.isValid())) {
+                    return false;
+                }
+                if (!LockNodesUndoItem::lock(
+                        "Merge to USD node unlocking", item.pullParentPath, false)) {
+                    return false;
+                }
+            }
+
+            // If the user-provided argument does *not* contain an animation key, then
+            // automatically infer if we should merge animations.
+            VtDictionary& ctxArgs = item.ctxArgs;
+            if (!VtDictionaryIsHolding<bool>(userArgs, UsdMayaJobExportArgsTokens->animation)) {
+                const bool isAnimated = PXR_NS::UsdMayaPrimUpdater::isAnimated(item.mayaDagPath);
+                GfInterval timeInterval = isAnimated
+                    ? GfInterval(MAnimControl::minTime().value(), MAnimControl::maxTime().value())
+                    : GfInterval();
+
+                ctxArgs[UsdMayaJobExportArgsTokens->animation] = isAnimated;
+                ctxArgs[UsdMayaJobExportArgsTokens->frameStride] = 1.0;
+                ctxArgs[UsdMayaJobExportArgsTokens->startTime] = timeInterval.GetMin();
+                ctxArgs[UsdMayaJobExportArgsTokens->endTime] = timeInterval.GetMax();
+            } else if (ctxArgs[UsdMayaJobExportArgsTokens->animation] == true) {
+                // If user asked for animation but there is no animation, skip the exportation
+                // of animation.
+                const bool isAnimated = PXR_NS::UsdMayaPrimUpdater::isAnimated(item.mayaDagPath);
+                if (!isAnimated)
+                    ctxArgs[UsdMayaJobExportArgsTokens->animation] = false;
+            }
+
+            item.time = proxyShape->getTime();
+            item.context = std::make_unique<UsdMayaPrimUpdaterContext>(
+                item.time, proxyShape->usdPrim().GetStage(), item.ctxArgs);
+
+            prepareLoop.loopAdvance();
+        }
     }
-    progressBar.advance();
 
     // Reset the selection, otherwise it will keep a reference to a deleted node
     // and crash later on.
@@ -1103,29 +1208,28 @@ bool PrimUpdaterManager::mergeToUsd(
         return false;
     }
 
-    UsdStageRefPtr            proxyStage = proxyShape->usdPrim().GetStage();
-    UsdMayaPrimUpdaterContext context(proxyShape->getTime(), proxyStage, ctxArgs);
-
-    auto  ufeMayaItem = Ufe::Hierarchy::createItem(mayaPath);
     auto& scene = Ufe::Scene::instance();
-    if (!isCopy && TF_VERIFY(ufeMayaItem))
-        scene.notify(Ufe::ObjectPreDelete(ufeMayaItem));
-    progressBar.advance();
-
-    // Remove the pulled path from the orphan node manager *before* exporting
-    // and merging into the original USD. Otherwise, the orphan manager can
-    // receive notification mid-way through the merge process, while the variants
-    // have not all been authored and think the variant set has changed back
-    // to the correct variant and thus decide to deactivate the USD prim again,
-    // thinking the Maya data shoudl be shown again...
+    for (const MergeToUsdItem& item : items) {
+        auto ufeMayaItem = Ufe::Hierarchy::createItem(item.mayaPath);
+        if (!isCopy && TF_VERIFY(ufeMayaItem))
+            scene.notify(Ufe::ObjectPreDelete(ufeMayaItem));
+
+        // Remove the pulled path from the orphan node manager *before* exporting
+        // and merging into the original USD. Otherwise, the orphan manager can
+        // receive notification mid-way through the merge process, while the variants
+        // have not all been authored and think the variant set has changed back
+        // to the correct variant and thus decide to deactivate the USD prim again,
+        // thinking the Maya data shoudl be shown again...
 #ifdef HAS_ORPHANED_NODES_MANAGER
-    if (_orphanedNodesManager) {
-        if (!TF_VERIFY(RemovePullVariantInfoUndoItem::execute(
-                _orphanedNodesManager, pulledPath, mayaDagPath))) {
-            return false;
+        if (_orphanedNodesManager) {
+            if (!TF_VERIFY(RemovePullVariantInfoUndoItem::execute(
+                    _orphanedNodesManager, item.pulledPath, item.mayaDagPath))) {
+                return false;
+            }
         }
-    }
 #endif
+    }
+    progressBar.advance();
 
     // Record all USD modifications in an undo block and item.
     UsdUfe::UsdUndoBlock undoBlock(
@@ -1135,98 +1239,123 @@ bool PrimUpdaterManager::mergeToUsd(
     // 1) Perform the export into a temporary layer.
     // 2) Traverse the layer and call the prim updater for each prim, for
     //    per-prim customization.
+    //
+    // Both stages run one pulled prim at a time: the export reads Maya data,
+    // and the customization merges into the shared destination layer through
+    // prim updaters that are allowed to modify the Maya scene.
+    auto mergeItem = [this, isCopy](MergeToUsdItem& item) {
+        const Ufe::Path&           pulledPath = item.pulledPath;
+        const MDagPath&            mayaDagPath = item.mayaDagPath;
+        UsdMayaPrimUpdaterContext& context = *item.context;
+
+        // 1) Perform the export to the temporary layer.
+        item.srcStage = UsdStage::CreateInMemory();
+        item.exportResult = pushExport(item.mayaObject, context, item.srcStage);
+        const PushExportResult& pushExportResult = item.exportResult;
 
-    // 1) Perform the export to the temporary layer.
-    PushExportResult pushExportResult = pushExport(depNodeFn.object(), context);
-    progressBar.advance();
+        if (TF_VERIFY(pushExportResult.usdToDag)) {
+            const auto dstRootPath
+                = getDstSdfPath(pulledPath, pushExportResult.srcRootPath, isCopy);
+            processPushExtras(
+                context._pushExtras,
+                *pushExportResult.usdToDag,
+                pushExportResult.srcRootPath,
+                dstRootPath);
+        }
 
-    if (TF_VERIFY(pushExportResult.usdToDag)) {
-        const auto dstRootPath = getDstSdfPath(pulledPath, pushExportResult.srcRootPath, isCopy);
-        processPushExtras(
-            context._pushExtras,
-            *pushExportResult.usdToDag,
-            pushExportResult.srcRootPath,
-            dstRootPath);
-    }
+        // 2) Traverse the in-memory layer, creating a prim updater for each prim,
+        // and call Push for each updater.  Build a new context with the USD path
+        // to Maya path mapping information.
+        context.SetUsdPathToDagPathMap(pushExportResult.usdToDag);
 
-    // 2) Traverse the in-memory layer, creating a prim updater for each prim,
-    // and call Push for each updater.  Build a new context with the USD path
-    // to Maya path mapping information.
-    context.SetUsdPathToDagPathMap(pushExportResult.usdToDag);
+        if (!isCopy) {
+            if (!FunctionUndoItem::execute(
+                    "Merge to Maya rendering inclusion",
+                    [pulledPath]() {
+                        removeExcludeFromRendering(pulledPath);
+                        return true;
+                    },
+                    [pulledPath]() { return addExcludeFromRendering(pulledPath); })) {
+                TF_WARN("Cannot re-enable original USD data in viewport rendering.");
+                return false;
+            }
+        }
 
-    if (!isCopy) {
-        if (!FunctionUndoItem::execute(
-                "Merge to Maya rendering inclusion",
-                [pulledPath]() {
-                    removeExcludeFromRendering(pulledPath);
-                    return true;
-                },
-                [pulledPath]() { return addExcludeFromRendering(pulledPath); })) {
-            TF_WARN("Cannot re-enable original USD data in viewport rendering.");
+        if (!pushCustomize(pulledPath, pushExportResult, context)) {
             return false;
         }
-    }
-    progressBar.advance();
 
-    if (!pushCustomize(pulledPath, pushExportResult, context)) {
-        return false;
-    }
-    progressBar.advance();
+        if (!isCopy) {
+            if (!FunctionUndoItem::execute(
+                    "Merge to Maya pull info removal",
+                    [pulledPath]() {
+                        removeAllPullInformation(pulledPath);
+                        return true;
+                    },
+                    [pulledPath, mayaDagPath]() {
+                        return writeAllPullInformation(pulledPath, mayaDagPath);
+                    })) {
+                TF_WARN("Cannot remove pull information metadata.");
+                return false;
+            }
+        }
 
-    if (!isCopy) {
-        if (!FunctionUndoItem::execute(
-                "Merge to Maya pull info removal",
-                [pulledPath]() {
-                    removeAllPullInformation(pulledPath);
-                    return true;
-                },
-                [pulledPath, mayaDagPath]() {
-                    return writeAllPullInformation(pulledPath, mayaDagPath);
-                })) {
-            TF_WARN("Cannot remove pull information metadata.");
-            return false;
+        // Discard all pulled Maya nodes.
+        std::vector<MDagPath> toApplyOn
+            = UsdMayaUtil::getDescendantsStartingWithChildren(mayaDagPath);
+        for (const MDagPath& curDagPath : toApplyOn) {
+            MStatus status = NodeDeletionUndoItem::deleteNode(
+                "Merge to USD Maya scene cleanup", curDagPath.fullPathName(), curDagPath.node());
+            if (status != MS::kSuccess) {
+                TF_WARN(
+                    "Merge to USD Maya scene cleanup: cannot delete node \"%s\".",
+                    curDagPath.fullPathName().asChar());
+                return false;
+            }
         }
-    }
-    progressBar.advance();
 
-    // Discard all pulled Maya nodes.
-    std::vector<MDagPath> toApplyOn = UsdMayaUtil::getDescendantsStartingWithChildren(mayaDagPath);
-    MayaUsd::ProgressBarLoopScope toApplyOnLoop(toApplyOn.size());
-    for (const MDagPath& curDagPath : toApplyOn) {
-        MStatus status = NodeDeletionUndoItem::deleteNode(
-            "Merge to USD Maya scene cleanup", curDagPath.fullPathName(), curDagPath.node());
-        if (status != MS::kSuccess) {
-            TF_WARN(
-                "Merge to USD Maya scene cleanup: cannot delete node \"%s\".",
-                curDagPath.fullPathName().asChar());
-            return false;
+        if (!isCopy) {
+            if (!TF_VERIFY(removePullParent(item.pullParentPath, pulledPath))) {
+                return false;
+            }
         }
-        toApplyOnLoop.loopAdvance();
-    }
 
-    if (!isCopy) {
-        if (!TF_VERIFY(removePullParent(pullParentPath, pulledPath))) {
-            return false;
+        context._pushExtras.finalize(MayaUsd::ufe::stagePath(context.GetUsdStage()), {});
+        return true;
+    };
+
+    {
+        MayaUsd::ProgressBarLoopScope mergeLoop(items.size());
+        for (MergeToUsdItem& item : items) {
+            if (!mergeItem(item)) {
+                return false;
+            }
+            mergeLoop.loopAdvance();
         }
     }
     progressBar.advance();
 
-    context._pushExtras.finalize(MayaUsd::ufe::stagePath(context.GetUsdStage()), {});
-    progressBar.advance();
-
     discardPullSetIfEmpty();
 
     // Some updaters (like MayaReference) may be writing and changing the variant during merge.
     // This will change the hierarchy around pulled prim. Grab hierarchy from the parent.
-    auto ufeUsdItem = Ufe::Hierarchy::createItem(pulledPath.pop());
-    auto hier = Ufe::Hierarchy::hierarchy(ufeUsdItem);
-    if (TF_VERIFY(hier)) {
-        scene.notify(Ufe::SubtreeInvalidate(hier->parent()));
+    std::unordered_set<Ufe::Path> invalidatedPaths;
+    for (const MergeToUsdItem& item : items) {
+        auto ufeUsdItem = Ufe::Hierarchy::createItem(item.pulledPath.pop());
+        auto hier = Ufe::Hierarchy::hierarchy(ufeUsdItem);
+        if (TF_VERIFY(hier)) {
+            auto parent = hier->parent();
+            if (parent && invalidatedPaths.insert(parent->path()).second) {
+                scene.notify(Ufe::SubtreeInvalidate(parent));
+            }
+        }
     }
     progressBar.advance();
 
     scopeIt.end();
-    executeAdditionalCommands(context);
+    for (const MergeToUsdItem& item : items) {
+        executeAdditionalCommands(*item.context);
+    }
     progressBar.advance();
 
     return true;
@@ -1756,22 +1885,18 @@ void PrimUpdaterManager::onProxyContentChanged(
 
     auto proxyShapeUfePath = proxyNotice.GetProxyShape().ufePath();
 
-    auto autoEditFn = [this, proxyShapeUfePath](
-                          const UsdMayaPrimUpdaterContext& context, const UsdPrim& prim) -> bool {
-        TfToken typeName = prim.GetTypeName();
-
-        auto registryItem = UsdMayaPrimUpdaterRegistry::FindOrFallback(typeName);
-        auto supports = std::get<UsdMayaPrimUpdater::Supports>(registryItem);
+    AutoEditTypeFilter typeFilter;
 
-        if ((supports & UsdMayaPrimUpdater::Supports::AutoPull)
-            != UsdMayaPrimUpdater::Supports::AutoPull)
+    auto autoEditFn = [this, proxyShapeUfePath, &typeFilter](
+                          const UsdMayaPrimUpdaterContext& context, const UsdPrim& prim) -> bool {
+        const UpdaterFactoryFn* factory = typeFilter.findAutoPullFactory(prim.GetTypeName());
+        if (!factory)
             return false;
 
         const Ufe::PathSegment pathSegment = UsdUfe::usdPathToUfePathSegment(prim.GetPath());
         const Ufe::Path        path = proxyShapeUfePath + pathSegment;
 
-        auto factory = std::get<UpdaterFactoryFn>(registryItem);
-        auto updater = factory(context, MFnDependencyNode(MObject()), path);
+        auto updater = (*factory)(context, MFnDependencyNode(MObject()), path);
 
         if (updater && updater->shouldAutoEdit()) {
             // TODO UNDO: is it okay to throw away the undo info in the change notification?
@@ -1793,10 +1918,21 @@ void PrimUpdaterManager::onProxyContentChanged(
     VtDictionary              userArgs;
     UsdMayaPrimUpdaterContext context(UsdTimeCode::Default(), stage, userArgs);
 
+    // Resynced paths can be nested, for example when a prim and one of its
+    // descendants are both modified in the same change block. Only traverse
+    // the top-most ones, so that no prim is scanned twice.
+    SdfPathVector resyncedPaths;
     for (const auto& changedPath : notice.GetResyncedPaths()) {
+        resyncedPaths.emplace_back(changedPath);
+    }
+    SdfPath::RemoveDescendentPaths(&resyncedPaths);
+
+    for (const auto& changedPath : resyncedPaths) {
         UsdPrim resyncPrim = (changedPath != SdfPath::AbsoluteRootPath())
             ? stage->GetPrimAtPath(changedPath)
             : stage->GetPseudoRoot();
+        if (!resyncPrim)
+            continue;
 
         UsdPrimRange range(resyncPrim, predicate);
 
@@ -1808,12 +1944,24 @@ void PrimUpdaterManager::onProxyContentChanged(
         }
     }
 
+    // Prims under a resynced path have already been scanned, and a prim with
+    // multiple modified properties only needs to be checked once.
+    std::unordered_set<SdfPath, SdfPath::Hash> valueChangedPrimPaths;
+
     auto changedInfoOnlyPaths = notice.GetChangedInfoOnlyPaths();
     for (auto it = changedInfoOnlyPaths.begin(), end = changedInfoOnlyPaths.end(); it != end;
          ++it) {
         const auto& changedPath = *it;
         if (changedPath.IsPrimPropertyPath()) {
-            UsdPrim valueChangedPrim = stage->GetPrimAtPath(changedPath.GetPrimPath());
+            const SdfPath primPath = changedPath.GetPrimPath();
+            if (!valueChangedPrimPaths.insert(primPath).second)
+                continue;
+
+            if (!resyncedPaths.empty()
+                && SdfPathFindLongestPrefix(resyncedPaths, primPath) != resyncedPaths.end())
+                continue;
+
+            UsdPrim valueChangedPrim = stage->GetPrimAtPath(primPath);
             if (valueChangedPrim) {
                 autoEditFn(context, valueChangedPrim);
             }
@@ -2099,8 +2247,9 @@ void PrimUpdaterManager::saveOrphanedNodesManagerData()
     if (pullRoot.isNull())
         return;
 
-    OrphanedNodesManager::Memento memento = _orphanedNodesManager->preserve();
-    const std::string             json = OrphanedNodesManager::Memento::convertToJson(memento);
+    // Write the current state directly, no need to preserve a copy of it first.
+    const std::string json = OrphanedNodesManager::Memento::convertToJson(
+        _orphanedNodesManager->getPulledPrims());
 
     MFnDependencyNode pullRootDepNode(pullRoot);
     MStatus           status
@@ -52,6 +52,18 @@ public:
         const Ufe::Path&         pulledPath,
         const VtDictionary&      userArgs = VtDictionary());
 
+    using PulledPrimPaths = std::vector<std::pair<Ufe::Path, MDagPath>>;
+
+    /// \brief merges several edited Maya hierarchies into their USD stages as
+    ///        a single undoable operation.
+    ///
+    /// Each pair holds the pulled USD path and the root of its edited Maya data.
+    /// The export and merge of each hierarchy run one after the other since
+    /// they read and modify the Maya scene.
+    MAYAUSD_CORE_PUBLIC
+    bool
+    mergeToUsd(const PulledPrimPaths& pulledPrims, const VtDictionary& userArgs = VtDictionary());
+
     /// \brief edit USD data as Maya data.
     MAYAUSD_CORE_PUBLIC
     bool editAsMaya(const Ufe::Path& path, const VtDictionary& userArgs = VtDictionary());
@@ -80,8 +92,6 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool hasPulledPrims() const;
 
-    using PulledPrimPaths = std::vector<std::pair<Ufe::Path, MDagPath>>;
-
     /// \brief Retrieve the UFE path of the edited USD data and the corresponding path of Maya data.
     MAYAUSD_CORE_PUBLIC
     PulledPrimPaths getPulledPrimPaths() const;
@@ -77,7 +77,9 @@ UsdMayaPrimWriter::UsdMayaPrimWriter(
     , _mayaObject(depNodeFn.object())
     , _usdPath(usdPath)
     , _baseDagToUsdPaths(UsdMayaUtil::getDagPathMap(depNodeFn, usdPath))
-    , _valueWriter(jobCtx.GetArgs().writeDefaults)
+    // Each value clip must hold the samples of all its frames, even the ones
+    // held since a previous clip, so clips are written densely.
+    , _valueWriter(jobCtx.GetArgs().writeDefaults, jobCtx.GetArgs().valueClipChunkSize == 0)
     , _exportVisibility(jobCtx.GetArgs().exportVisibility)
     , _hasAnimCurves(_IsAnimated(jobCtx.GetArgs(), depNodeFn.object()))
 {
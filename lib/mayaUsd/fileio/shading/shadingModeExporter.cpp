@@ -33,10 +33,19 @@
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdUtils/authoring.h>
 
+#include <maya/MFnAttribute.h>
+#include <maya/MFnDependencyNode.h>
 #include <maya/MItDependencyNodes.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MStringArray.h>
 
+#include <algorithm>
+#include <deque>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -78,6 +87,123 @@ static SdfPathSet _GetRootPaths(const SdfPathSet& paths)
     return result;
 }
 
+namespace {
+
+/// Builds a description of the shading network upstream of a shading engine
+/// that does not depend on node names: two shading engines get the same
+/// signature when their networks have the same node types, the same
+/// non-default attribute values and the same connections.
+class _ShadingNetworkSignature
+{
+public:
+    std::string compute(const UsdMayaShadingModeExportContext& context)
+    {
+        _nodeIds.clear();
+        _pending.clear();
+        _signature.clear();
+
+        _addRoot("surface", context.GetSurfaceShaderPlug());
+        _addRoot("volume", context.GetVolumeShaderPlug());
+        _addRoot("displacement", context.GetDisplacementShaderPlug());
+
+        while (!_pending.empty()) {
+            const MObject node = _pending.front();
+            _pending.pop_front();
+            _addNode(node);
+        }
+
+        return std::move(_signature);
+    }
+
+private:
+    // Returns the local id of the node, queuing it for description when first seen.
+    size_t _getNodeId(const MObject& node)
+    {
+        const auto inserted = _nodeIds.emplace(MObjectHandle(node), _nodeIds.size());
+        if (inserted.second) {
+            _pending.push_back(node);
+        }
+        return inserted.first->second;
+    }
+
+    void _addSource(const MPlug& srcPlug)
+    {
+        _signature += std::to_string(_getNodeId(srcPlug.node()));
+        _signature += '.';
+        _signature += srcPlug.partialName(false, false, false, false, false, true).asChar();
+    }
+
+    // The shader plugs are on the shading engine, only their sources are described.
+    void _addRoot(const char* name, const MPlug& shaderPlug)
+    {
+        const MPlug srcPlug = shaderPlug.isNull() ? MPlug() : shaderPlug.source();
+        if (srcPlug.isNull()) {
+            return;
+        }
+        _signature += name;
+        _signature += '=';
+        _addSource(srcPlug);
+        _signature += '\n';
+    }
+
+    void _addNode(const MObject& node)
+    {
+        MFnDependencyNode depNode(node);
+        _signature += '#';
+        _signature += depNode.typeName().asChar();
+        _signature += '\n';
+
+        // Attribute values that differ from the defaults. The commands use
+        // relative plug names, so they don't depend on the node name.
+        MStringArray   cmds;
+        const unsigned attrCount = depNode.attributeCount();
+        for (unsigned i = 0; i < attrCount; ++i) {
+            MFnAttribute attr(depNode.attribute(i));
+            if (!attr.parent().isNull() || !attr.isStorable()) {
+                continue;
+            }
+            MPlug plug = depNode.findPlug(attr.object(), true);
+            cmds.clear();
+            plug.getSetAttrCmds(cmds, MPlug::kChanged);
+            for (unsigned c = 0; c < cmds.length(); ++c) {
+                _signature += cmds[c].asChar();
+                _signature += '\n';
+            }
+        }
+
+        // Incoming connections, sorted by destination plug so that the ids of
+        // the upstream nodes are assigned in the same order for identical
+        // networks.
+        MPlugArray connectedPlugs;
+        depNode.getConnections(connectedPlugs);
+        std::vector<std::pair<std::string, MPlug>> sources;
+        MPlugArray                                 srcPlugs;
+        for (unsigned i = 0; i < connectedPlugs.length(); ++i) {
+            const MPlug& dstPlug = connectedPlugs[i];
+            if (!dstPlug.connectedTo(srcPlugs, true, false) || srcPlugs.length() == 0) {
+                continue;
+            }
+            sources.emplace_back(
+                dstPlug.partialName(false, false, false, false, false, true).asChar(), srcPlugs[0]);
+        }
+        std::sort(sources.begin(), sources.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        for (const auto& source : sources) {
+            _signature += source.first;
+            _signature += "<-";
+            _addSource(source.second);
+            _signature += '\n';
+        }
+    }
+
+    UsdMayaUtil::MObjectHandleUnorderedMap<size_t> _nodeIds;
+    std::deque<MObject>                            _pending;
+    std::string                                    _signature;
+};
+
+} // namespace
+
 void UsdMayaShadingModeExporter::DoExport(
     UsdMayaWriteJobContext&                  writeJobContext,
     const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdMap)
@@ -120,13 +246,46 @@ void UsdMayaShadingModeExporter::DoExport(
         MObject shadingEngine(shadingEngineIter.thisNode());
         shadingEngines.emplace_back(shadingEngine);
     }
+
+    // When merging identical materials, the first material exported for a
+    // given network signature is shared by the following ones, which only
+    // reference it. The full signature is the key, so that a hash collision
+    // can never merge two different networks.
+    _ShadingNetworkSignature                          signatureBuilder;
+    std::unordered_map<std::string, UsdShadeMaterial> sharedMaterials;
+
     MayaUsd::ProgressBarLoopScope shadingEngineLoop(shadingEngines.size());
     for (const auto& shadingEngine : shadingEngines) {
         context.SetShadingEngine(shadingEngine);
 
         UsdShadeMaterial mat;
         SdfPathSet       boundPrimPaths;
-        Export(context, &mat, &boundPrimPaths);
+
+        std::string signature;
+        bool        merged = false;
+        if (exportArgs.mergeIdenticalMaterials) {
+            signature = signatureBuilder.compute(context);
+            auto shared = sharedMaterials.find(signature);
+            if (shared != sharedMaterials.end()) {
+                const UsdMayaShadingModeExportContext::AssignmentsInfo assignments
+                    = context.GetAssignments();
+                UsdPrim materialPrim = context.MakeStandardMaterialPrim(assignments);
+                if (materialPrim) {
+                    materialPrim.GetReferences().AddInternalReference(shared->second.GetPath());
+                    context.BindStandardMaterialPrim(
+                        materialPrim, assignments.assignments, &boundPrimPaths);
+                    mat = UsdShadeMaterial(materialPrim);
+                }
+                merged = true;
+            }
+        }
+
+        if (!merged) {
+            Export(context, &mat, &boundPrimPaths);
+            if (mat && exportArgs.mergeIdenticalMaterials) {
+                sharedMaterials.emplace(std::move(signature), mat);
+            }
+        }
 
         if (mat) {
             writeJobContext.AddMaterialPath(mat.GetPath());
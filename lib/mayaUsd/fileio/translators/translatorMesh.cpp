@@ -21,6 +21,7 @@
 #include <mayaUsd/nodes/pointBasedDeformerNode.h>
 #include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItems.h>
+#include <mayaUsd/utils/converter.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/usd/usdGeom/primvarsAPI.h>
@@ -35,7 +36,6 @@
 #include <maya/MFnMesh.h>
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -65,119 +65,34 @@ TranslatorMeshRead::TranslatorMeshRead(
     // ==============================================
     // construct a Maya mesh
     // ==============================================
-    VtIntArray faceVertexCounts;
-    VtIntArray faceVertexIndices;
-
-    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
-    if (fvc.ValueMightBeTimeVarying()) {
-        // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
-        // for the mesh, perhaps?  For now, better to give a more specific error
-        TF_RUNTIME_ERROR(
-            "<%s> is a topologically varying Mesh (has animated "
-            "faceVertexCounts), which isn't currently supported. "
-            "Skipping...",
-            prim.GetPath().GetText());
-    } else {
-        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
-    }
-
-    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
-    if (fvi.ValueMightBeTimeVarying()) {
-        // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
-        // for the mesh, perhaps?  For now, better to give a more specific error
-        TF_RUNTIME_ERROR(
-            "<%s> is a topologically varying Mesh (has animated "
-            "faceVertexIndices), which isn't currently supported. "
-            "Skipping...",
-            prim.GetPath().GetText());
-    } else {
-        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
-    }
-
-    // Sanity Checks. If the vertex arrays are empty, skip this mesh
-    if (faceVertexCounts.empty() || faceVertexIndices.empty()) {
-        TF_RUNTIME_ERROR(
-            "faceVertexCounts or faceVertexIndices array is empty "
-            "[count: %zu, indices:%zu] on Mesh <%s>. Skipping...",
-            faceVertexCounts.size(),
-            faceVertexIndices.size(),
-            prim.GetPath().GetText());
-    }
-
-    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
-    // Fix them to be in right-handed order, as expected by Maya.
-    if (isPrimitiveLeftHanded(mesh)) {
-        size_t firstIndex = 0;
-        for (int vertexCount : faceVertexCounts) {
-            std::reverse(
-                faceVertexIndices.begin() + firstIndex,
-                faceVertexIndices.begin() + firstIndex + vertexCount);
-            firstIndex += vertexCount;
-        }
-    }
-
-    // Gather points and normals
-    // If timeInterval is non-empty, pick the first available sample in the
-    // timeInterval or default.
-    VtVec3fArray        points;
-    VtVec3fArray        normals;
-    TfToken             normalsInterpolation;
-    UsdTimeCode         pointsTimeSample = UsdTimeCode::EarliestTime();
-    UsdTimeCode         normalsTimeSample = UsdTimeCode::EarliestTime();
-    std::vector<double> pointsTimeSamples;
-
-    if (!frameRange.IsEmpty()) {
-        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &pointsTimeSamples);
-        if (!pointsTimeSamples.empty()) {
-            m_pointsNumTimeSamples = pointsTimeSamples.size();
-            pointsTimeSample = pointsTimeSamples.front();
-        }
-
-        std::vector<double> normalsTimeSamples;
-        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
-        if (!normalsTimeSamples.empty()) {
-            normalsTimeSample = normalsTimeSamples.front();
-        }
-    }
-
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
-
-    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
-    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
-
-    if (primvar.HasValue()) {
-        primvar.ComputeFlattened(&normals, normalsTimeSample);
-        normalsInterpolation = primvar.GetInterpolation();
-    } else {
-        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
-        normalsInterpolation = mesh.GetNormalsInterpolation();
+    // The USD data may have been read ahead, in parallel with other meshes,
+    // along with the values of its primvars.
+    UsdMayaMeshReadUtils::MeshData meshData;
+    if (!UsdMayaMeshReadUtils::MeshPrefetchScope::takeMeshData(mesh, frameRange, meshData)) {
+        UsdMayaMeshReadUtils::readMeshData(mesh, frameRange, meshData);
     }
-
-    if (points.empty()) {
-        TF_RUNTIME_ERROR(
-            "points array is empty on Mesh <%s>. Skipping...", prim.GetPath().GetText());
+    for (const std::string& error : meshData.errors) {
+        TF_RUNTIME_ERROR("%s", error.c_str());
     }
-
-    std::string reason;
-    if (!UsdGeomMesh::ValidateTopology(
-            faceVertexIndices, faceVertexCounts, points.size(), &reason)) {
-        TF_RUNTIME_ERROR(
-            "Skipping Mesh <%s> with invalid topology: %s",
-            prim.GetPath().GetText(),
-            reason.c_str());
+    if (!meshData.topology) {
         *status = MS::kFailure;
         return;
     }
 
+    const UsdMayaMeshReadUtils::MeshTopology& topology = *meshData.topology;
+    const VtVec3fArray&                       normals = meshData.normals;
+    const std::vector<double>&                pointsTimeSamples = meshData.pointsTimeSamples;
+    m_pointsNumTimeSamples = pointsTimeSamples.size();
+    m_primvarData = std::move(meshData.primvars);
+
     // == Convert data to Maya ( vertices, faces, indices )
-    const size_t mayaNumVertices = points.size();
-    MPointArray  mayaPoints(mayaNumVertices);
-    for (size_t i = 0u; i < mayaNumVertices; ++i) {
-        mayaPoints.set(i, points[i][0], points[i][1], points[i][2]);
-    }
+    const size_t mayaNumVertices = meshData.points.size();
+    MPointArray  mayaPoints;
+    TypedConverter<MPointArray, VtVec3fArray>::convert(meshData.points, mayaPoints);
 
-    MIntArray polygonCounts(faceVertexCounts.cdata(), faceVertexCounts.size());
-    MIntArray polygonConnects(faceVertexIndices.cdata(), faceVertexIndices.size());
+    MIntArray polygonCounts(topology.faceVertexCounts.cdata(), topology.faceVertexCounts.size());
+    MIntArray polygonConnects(
+        topology.faceVertexIndices.cdata(), topology.faceVertexIndices.size());
 
     // == Create Mesh Shape Node
     MFnMesh meshFn;
@@ -221,17 +136,13 @@ TranslatorMeshRead::TranslatorMeshRead(
     // Set normals if supplied
     MIntArray normalsFaceIds;
     if (normals.size() == static_cast<size_t>(meshFn.numFaceVertices())) {
-        for (size_t i = 0u; i < polygonCounts.length(); ++i) {
-            for (int j = 0; j < polygonCounts[i]; ++j) {
-                normalsFaceIds.append(i);
-            }
-        }
+        normalsFaceIds = MIntArray(
+            topology.faceVertexFaces.cdata(),
+            static_cast<unsigned int>(topology.faceVertexFaces.size()));
 
         if (normalsFaceIds.length() == static_cast<size_t>(meshFn.numFaceVertices())) {
-            MVectorArray mayaNormals(normals.size());
-            for (size_t i = 0u; i < normals.size(); ++i) {
-                mayaNormals.set(MVector(normals[i][0u], normals[i][1u], normals[i][2u]), i);
-            }
+            MVectorArray mayaNormals;
+            TypedConverter<MVectorArray, VtVec3fArray>::convert(normals, mayaNormals);
 
             meshFn.setFaceVertexNormals(mayaNormals, normalsFaceIds, polygonConnects);
         }
@@ -243,7 +154,7 @@ TranslatorMeshRead::TranslatorMeshRead(
     TfToken subdScheme;
     if (mesh.GetSubdivisionSchemeAttr().Get(&subdScheme) && subdScheme == UsdGeomTokens->none) {
         if (normals.size() == static_cast<size_t>(meshFn.numFaceVertices())
-            && normalsInterpolation == UsdGeomTokens->faceVarying) {
+            && meshData.normalsInterpolation == UsdGeomTokens->faceVarying) {
             UsdMayaMeshReadUtils::setEmitNormalsTag(meshFn, true);
         }
     } else {
@@ -274,18 +185,20 @@ TranslatorMeshRead::TranslatorMeshRead(
     }
 
     // Use blendShapeDeformer so that all the points for a frame are contained in a single node.
-    MPointArray mayaAnimPoints(mayaNumVertices);
+    MPointArray mayaAnimPoints;
     MObject     meshAnimObj;
 
     MFnBlendShapeDeformer blendFn;
     m_meshBlendObj = blendFn.create(m_meshObj);
 
+    VtVec3fArray points;
+    VtVec3fArray animNormals;
     for (unsigned int ti = 0u; ti < m_pointsNumTimeSamples; ++ti) {
         mesh.GetPointsAttr().Get(&points, pointsTimeSamples[ti]);
-
-        for (unsigned int i = 0u; i < mayaNumVertices; ++i) {
-            mayaAnimPoints.set(i, points[i][0], points[i][1], points[i][2]);
+        if (points.size() != mayaNumVertices) {
+            continue;
         }
+        TypedConverter<MPointArray, VtVec3fArray>::convert(points, mayaAnimPoints);
 
         // == Create Mesh Shape Node
         MFnMesh meshFn;
@@ -313,13 +226,11 @@ TranslatorMeshRead::TranslatorMeshRead(
         // NOTE: This normal information is not propagated through the blendShapes, only the
         // controlPoints.
         //
-        mesh.GetNormalsAttr().Get(&normals, pointsTimeSamples[ti]);
-        if (normals.size() == static_cast<size_t>(meshFn.numFaceVertices())
+        mesh.GetNormalsAttr().Get(&animNormals, pointsTimeSamples[ti]);
+        if (animNormals.size() == static_cast<size_t>(meshFn.numFaceVertices())
             && normalsFaceIds.length() == static_cast<size_t>(meshFn.numFaceVertices())) {
-            MVectorArray mayaNormals(normals.size());
-            for (size_t i = 0; i < normals.size(); ++i) {
-                mayaNormals.set(MVector(normals[i][0u], normals[i][1u], normals[i][2u]), i);
-            }
+            MVectorArray mayaNormals;
+            TypedConverter<MVectorArray, VtVec3fArray>::convert(animNormals, mayaNormals);
 
             meshFn.setFaceVertexNormals(mayaNormals, normalsFaceIds, polygonConnects);
         }
@@ -363,16 +274,6 @@ TranslatorMeshRead::TranslatorMeshRead(
     *status = stat;
 }
 
-bool TranslatorMeshRead::isPrimitiveLeftHanded(const UsdGeomGprim& prim)
-{
-    TfToken orientation;
-    if (!prim.GetOrientationAttr().Get(&orientation)) {
-        return false;
-    }
-
-    return orientation == UsdGeomTokens->leftHanded;
-}
-
 MStatus TranslatorMeshRead::setPointBasedDeformerForMayaNode(
     const MObject& mayaObj,
     const MObject& stageNode,
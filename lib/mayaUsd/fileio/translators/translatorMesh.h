@@ -21,6 +21,7 @@
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/primReaderRegistry.h>
+#include <mayaUsd/fileio/utils/meshReadUtils.h>
 
 #include <pxr/pxr.h>
 #include <pxr/usd/usdGeom/mesh.h>
@@ -60,11 +61,12 @@ public:
 
     SdfPath shapePath() const;
 
+    /// Values of the UV set and color set primvars, read with the mesh.
+    const UsdMayaMeshReadUtils::PrimvarDataMap& primvarData() const { return m_primvarData; }
+
 private:
     MStatus setPointBasedDeformerForMayaNode(const MObject&, const MObject&, const UsdPrim&);
 
-    static bool isPrimitiveLeftHanded(const UsdGeomGprim& prim);
-
 private:
     MObject m_meshObj;
     MObject m_meshBlendObj;
@@ -74,6 +76,8 @@ private:
     size_t  m_pointsNumTimeSamples;
 
     SdfPath m_shapePath;
+
+    UsdMayaMeshReadUtils::PrimvarDataMap m_primvarData;
 };
 
 class MAYAUSD_CORE_PUBLIC TranslatorMeshWrite
@@ -46,6 +46,15 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -173,12 +182,82 @@ struct _MayaTokensData
 
 TfStaticData<_MayaTokensData> _MayaTokens;
 
+/// Keys holding the same value as both of their neighbours, within this
+/// tolerance, are redundant and are not added to the anim curves.
+constexpr double _kRedundantKeyTolerance = 1e-9;
+
+/// Number of joints whose animation is decomposed before their anim curves
+/// are created. Bounds the memory used by the decomposed channels.
+constexpr size_t _kJointBatchSize = 64;
+
+/// Number of time samples decomposed by a single task.
+constexpr size_t _kTimeGrainSize = 256;
+
+/// Translate, rotate and scale channels of one node, at every time sample.
+struct _TransformAnimChannels
+{
+    std::vector<double> translates[3];
+    std::vector<double> rotates[3];
+    std::vector<double> scales[3];
+};
+
+/// Size \p channels for \p numSamples samples, defaulting to the identity.
+void _ResizeTransformAnimChannels(size_t numSamples, _TransformAnimChannels* channels)
+{
+    for (int c = 0; c < 3; ++c) {
+        channels->translates[c].assign(numSamples, 0.0);
+        channels->rotates[c].assign(numSamples, 0.0);
+        channels->scales[c].assign(numSamples, 1.0);
+    }
+}
+
+/// Decompose \p xform into sample \p i of \p channels.
+/// This does not touch any Maya node, so it can run on any thread.
+void _DecomposeTransform(const GfMatrix4d& xform, size_t i, _TransformAnimChannels* channels)
+{
+    GfVec3d t, r, s;
+    if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
+        for (int c = 0; c < 3; ++c) {
+            channels->translates[c][i] = t[c];
+            channels->rotates[c][i] = r[c];
+            channels->scales[c][i] = s[c];
+        }
+    }
+}
+
+/// Make each rotation of \p channels the closest solution to the previous one.
+void _ApplyEulerFilter(MEulerRotation::RotationOrder order, _TransformAnimChannels* channels)
+{
+    std::vector<double>(&rotates)[3] = channels->rotates;
+    if (rotates[0].empty())
+        return;
+
+    MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], order);
+    for (size_t i = 1; i < rotates[0].size(); ++i) {
+        MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], order);
+        current.setToClosestSolution(last);
+        rotates[0][i] = current[0];
+        rotates[1][i] = current[1];
+        rotates[2][i] = current[2];
+        last = current;
+    }
+}
+
+/// Rotation order of \p transformNode, used to Euler filter its rotations.
+MEulerRotation::RotationOrder _GetRotationOrder(const MFnDependencyNode& transformNode)
+{
+    MPlug rotOrder = transformNode.findPlug("rotateOrder");
+    return static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
+}
+
 /// Set keyframes on \p depNode using \p values keyed at \p times.
+/// Keys that are redundant with both of their neighbours are skipped, and the
+/// curve is kept flat between the keys around them.
 bool _SetAnimPlugData(
     MFnDependencyNode&              depNode,
     const MString&                  attr,
-    MDoubleArray&                   values,
-    MTimeArray&                     times,
+    const std::vector<double>&      values,
+    const MTimeArray&               times,
     const UsdMayaPrimReaderContext* context)
 {
     MStatus status;
@@ -191,14 +270,43 @@ bool _SetAnimPlugData(
         CHECK_MSTATUS_AND_RETURN(status, false);
     }
 
+    const size_t numSamples = values.size();
+    MDoubleArray keyValues;
+    MTimeArray   keyTimes;
+    keyValues.setSizeIncrement(static_cast<unsigned int>(numSamples));
+    keyTimes.setSizeIncrement(static_cast<unsigned int>(numSamples));
+    // Keys followed by skipped keys.
+    std::vector<unsigned int> holdKeys;
+    for (size_t i = 0; i < numSamples; ++i) {
+        if (i > 0 && i + 1 < numSamples
+            && std::abs(values[i] - values[i - 1]) <= _kRedundantKeyTolerance
+            && std::abs(values[i] - values[i + 1]) <= _kRedundantKeyTolerance) {
+            const unsigned int previousKey = keyValues.length() - 1;
+            if (holdKeys.empty() || holdKeys.back() != previousKey) {
+                holdKeys.push_back(previousKey);
+            }
+            continue;
+        }
+        keyValues.append(values[i]);
+        keyTimes.append(times[static_cast<unsigned int>(i)]);
+    }
+
     MFnAnimCurve animFn;
     MObject      animObj = animFn.create(plug, nullptr, &status);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    // XXX: Why do the input arrays need to be mutable here?
-    status = animFn.addKeys(&times, &values);
+    status = animFn.addKeys(&keyTimes, &keyValues);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
+    // The default tangents could overshoot between the keys around the skipped
+    // ones, which hold the same value: linear tangents keep the curve flat.
+    for (const unsigned int key : holdKeys) {
+        status = animFn.setOutTangentType(key, MFnAnimCurve::kTangentLinear);
+        CHECK_MSTATUS_AND_RETURN(status, false);
+        status = animFn.setInTangentType(key + 1, MFnAnimCurve::kTangentLinear);
+        CHECK_MSTATUS_AND_RETURN(status, false);
+    }
+
     if (context) {
         // Register node for undo/redo
         context->RegisterNewMayaNode(animFn.name().asChar(), animObj);
@@ -207,90 +315,86 @@ bool _SetAnimPlugData(
 }
 
 /// Set animation on \p transformNode.
-/// The \p xforms holds transforms at each time, while the \p times
-/// array holds the corresponding times.
+/// The \p channels hold the decomposed transforms at each time, while the
+/// \p times array holds the corresponding times.
 bool _SetTransformAnim(
     MFnDependencyNode&              transformNode,
-    const std::vector<GfMatrix4d>&  xforms,
-    MTimeArray&                     times,
-    const UsdMayaPrimReaderContext* context,
-    bool                            applyEulerFilter)
+    const _TransformAnimChannels&   channels,
+    const MTimeArray&               times,
+    const UsdMayaPrimReaderContext* context)
 {
-    if (xforms.size() != times.length()) {
-        TF_WARN("xforms size [%zu] != times size [%du].", xforms.size(), times.length());
+    const size_t numSamples = channels.translates[0].size();
+    if (numSamples != times.length()) {
+        TF_WARN("xforms size [%zu] != times size [%du].", numSamples, times.length());
         return false;
     }
-    if (xforms.empty())
+    if (numSamples == 0)
         return true;
 
-    MStatus status;
-
-    const unsigned int numSamples = times.length();
-
     if (numSamples > 1) {
-        MDoubleArray translates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray rotates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray scales[3] = { MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1) };
-
-        // Decompose all transforms.
-        for (unsigned int i = 0; i < numSamples; ++i) {
-            const auto& xform = xforms[i];
-            GfVec3d     t, r, s;
-            if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-                for (int c = 0; c < 3; ++c) {
-                    translates[c][i] = t[c];
-                    rotates[c][i] = r[c];
-                    scales[c][i] = s[c];
-                }
-            }
-        }
-
-        if (applyEulerFilter) {
-            MPlug                         rotOrder = transformNode.findPlug("rotateOrder");
-            MEulerRotation::RotationOrder order
-                = static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
-
-            MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], order);
-            for (unsigned int i = 1; i < rotates[0].length(); ++i) {
-                MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], order);
-                current.setToClosestSolution(last);
-                rotates[0][i] = current[0];
-                rotates[1][i] = current[1];
-                rotates[2][i] = current[2];
-                last = current;
-            }
-        }
-
         for (int c = 0; c < 3; ++c) {
             if (!_SetAnimPlugData(
-                    transformNode, _MayaTokens->translates[c], translates[c], times, context)
+                    transformNode,
+                    _MayaTokens->translates[c],
+                    channels.translates[c],
+                    times,
+                    context)
                 || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->rotates[c], rotates[c], times, context)
+                    transformNode, _MayaTokens->rotates[c], channels.rotates[c], times, context)
                 || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->scales[c], scales[c], times, context)) {
+                    transformNode, _MayaTokens->scales[c], channels.scales[c], times, context)) {
                 return false;
             }
         }
     } else {
-        const auto& xform = xforms.front();
-        GfVec3d     t, r, s;
-        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-            for (int c = 0; c < 3; ++c) {
-                if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s[c])) {
-                    return false;
-                }
+        for (int c = 0; c < 3; ++c) {
+            if (!UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->translates[c], channels.translates[c][0])
+                || !UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->rotates[c], channels.rotates[c][0])
+                || !UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->scales[c], channels.scales[c][0])) {
+                return false;
             }
         }
     }
     return true;
 }
 
+/// Set animation on \p transformNode.
+/// The \p xforms holds transforms at each time, while the \p times
+/// array holds the corresponding times.
+bool _SetTransformAnim(
+    MFnDependencyNode&              transformNode,
+    const std::vector<GfMatrix4d>&  xforms,
+    const MTimeArray&               times,
+    const UsdMayaPrimReaderContext* context,
+    bool                            applyEulerFilter)
+{
+    if (xforms.size() != times.length()) {
+        TF_WARN("xforms size [%zu] != times size [%du].", xforms.size(), times.length());
+        return false;
+    }
+
+    _TransformAnimChannels channels;
+    _ResizeTransformAnimChannels(xforms.size(), &channels);
+
+    // Decompose all transforms.
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, xforms.size(), _kTimeGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                _DecomposeTransform(xforms[i], i, &channels);
+            }
+        });
+
+    if (applyEulerFilter && xforms.size() > 1) {
+        _ApplyEulerFilter(_GetRotationOrder(transformNode), &channels);
+    }
+
+    return _SetTransformAnim(transformNode, channels, times, context);
+}
+
 void _GetJointAnimTimeSamples(
     const UsdSkelSkeletonQuery&  skelQuery,
     const UsdMayaPrimReaderArgs& args,
@@ -502,14 +606,20 @@ bool _CopyAnimFromSkel(
 
     MStatus status;
 
+    const size_t numSamples = usdTimes.size();
+
     // Pre-sample the Skeleton's local transforms.
-    std::vector<GfMatrix4d>      skelLocalXforms(usdTimes.size());
+    std::vector<GfMatrix4d>      skelLocalXforms(numSamples);
     UsdGeomXformable::XformQuery xfQuery(skelQuery.GetSkeleton());
-    for (size_t i = 0; i < usdTimes.size(); ++i) {
-        if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
-            skelLocalXforms[i].SetIdentity();
-        }
-    }
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numSamples, _kTimeGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
+                    skelLocalXforms[i].SetIdentity();
+                }
+            }
+        });
 
     if (jointContainerIsSkeleton) {
         // The jointContainer is being used to represent the Skeleton.
@@ -528,42 +638,96 @@ bool _CopyAnimFromSkel(
         }
     }
 
-    // Pre-sample all joint animation.
-    std::vector<VtMatrix4dArray> samples(usdTimes.size());
-    for (size_t i = 0; i < samples.size(); ++i) {
-        if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
-            return false;
+    // We do not have a node to receive the local transforms of the
+    // Skeleton, so any local transforms on the Skeleton must be
+    // concatened onto the root joints instead.
+    std::vector<size_t> rootJoints;
+    if (!jointContainerIsSkeleton) {
+        for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j) {
+            if (skelQuery.GetTopology().GetParent(j) < 0) {
+                rootJoints.push_back(j);
+            }
         }
-        if (!jointContainerIsSkeleton) {
-            // We do not have a node to receive the local transforms of the
-            // Skeleton, so any local transforms on the Skeleton must be
-            // concatened onto the root joints instead.
-            for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j) {
-                if (skelQuery.GetTopology().GetParent(j) < 0) {
+    }
+
+    // Pre-sample all joint animation, in parallel over time.
+    std::vector<VtMatrix4dArray> samples(numSamples);
+    std::atomic<bool>            sampled(true);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numSamples, 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
+                    sampled = false;
+                    return;
+                }
+                for (size_t j : rootJoints) {
                     // This is a root joint. Concat by the local skel xform.
                     samples[i][j] *= skelLocalXforms[i];
                 }
             }
-        }
+        });
+    if (!sampled) {
+        return false;
     }
 
-    MFnDependencyNode jointDep;
+    const bool applyEulerFilter = args.GetJobArguments().applyEulerFilter && numSamples > 1;
 
-    std::vector<GfMatrix4d> xforms(samples.size());
+    MFnDependencyNode jointDep;
 
-    for (size_t jointIdx = 0; jointIdx < jointNodes.size(); ++jointIdx) {
+    // Decompose the joint transforms in parallel, one batch of joints at a
+    // time. Only the anim curves are created on the calling thread.
+    const size_t                               numJoints = jointNodes.size();
+    std::vector<_TransformAnimChannels>        channels(std::min(numJoints, _kJointBatchSize));
+    std::vector<MEulerRotation::RotationOrder> rotationOrders(channels.size());
+    std::vector<char>                          hasJointNode(channels.size());
+
+    for (size_t batchBegin = 0; batchBegin < numJoints; batchBegin += _kJointBatchSize) {
+        const size_t batchEnd = std::min(numJoints, batchBegin + _kJointBatchSize);
+
+        // Query the joint nodes before going parallel.
+        for (size_t jointIdx = batchBegin; jointIdx < batchEnd; ++jointIdx) {
+            const size_t b = jointIdx - batchBegin;
+            hasJointNode[b] = jointDep.setObject(jointNodes[jointIdx]) == MS::kSuccess;
+            if (hasJointNode[b]) {
+                _ResizeTransformAnimChannels(numSamples, &channels[b]);
+                if (applyEulerFilter) {
+                    rotationOrders[b] = _GetRotationOrder(jointDep);
+                }
+            }
+        }
 
-        if (!jointDep.setObject(jointNodes[jointIdx]))
-            continue;
+        tbb::parallel_for(
+            tbb::blocked_range2d<size_t>(batchBegin, batchEnd, 1, 0, numSamples, _kTimeGrainSize),
+            [&](const tbb::blocked_range2d<size_t>& range) {
+                for (size_t jointIdx = range.rows().begin(); jointIdx < range.rows().end();
+                     ++jointIdx) {
+                    const size_t b = jointIdx - batchBegin;
+                    if (!hasJointNode[b])
+                        continue;
+                    for (size_t i = range.cols().begin(); i < range.cols().end(); ++i) {
+                        _DecomposeTransform(samples[i][jointIdx], i, &channels[b]);
+                    }
+                }
+            });
 
-        // Get the transforms of just this joint.
-        for (size_t i = 0; i < samples.size(); ++i) {
-            xforms[i] = samples[i][jointIdx];
+        if (applyEulerFilter) {
+            tbb::parallel_for(batchBegin, batchEnd, [&](size_t jointIdx) {
+                const size_t b = jointIdx - batchBegin;
+                if (hasJointNode[b]) {
+                    _ApplyEulerFilter(rotationOrders[b], &channels[b]);
+                }
+            });
         }
 
-        if (!_SetTransformAnim(
-                jointDep, xforms, mayaTimes, context, args.GetJobArguments().applyEulerFilter))
-            return false;
+        for (size_t jointIdx = batchBegin; jointIdx < batchEnd; ++jointIdx) {
+            const size_t b = jointIdx - batchBegin;
+            if (!hasJointNode[b] || !jointDep.setObject(jointNodes[jointIdx]))
+                continue;
+
+            if (!_SetTransformAnim(jointDep, channels[b], mayaTimes, context))
+                return false;
+        }
     }
     return true;
 }
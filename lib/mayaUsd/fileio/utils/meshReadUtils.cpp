@@ -21,6 +21,7 @@
 #include <mayaUsd/fileio/utils/readUtil.h>
 #include <mayaUsd/fileio/utils/roundTripUtil.h>
 #include <mayaUsd/utils/colorSpace.h>
+#include <mayaUsd/utils/hash.h>
 #include <mayaUsd/utils/json.h>
 #include <mayaUsd/utils/util.h>
 
@@ -49,7 +50,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItMeshEdge.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -57,6 +57,12 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <mutex>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(UsdMayaMeshPrimvarTokens, PXRUSDMAYA_MESH_PRIMVAR_TOKENS);
@@ -158,54 +164,120 @@ bool addCreaseSet(
 }
 
 MIntArray getMayaFaceVertexAssignmentIds(
-    const MFnMesh&    meshFn,
+    const MIntArray&  vertexCounts,
+    const MIntArray&  vertexList,
     const TfToken&    interpolation,
     const VtIntArray& assignmentIndices,
     const int         unauthoredValuesIndex)
 {
-    MIntArray valueIds(meshFn.numFaceVertices(), -1);
-
-    MItMeshFaceVertex itFV(meshFn.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int valueId = 0;
-        if (interpolation == UsdGeomTokens->constant) {
-            valueId = 0;
-        } else if (interpolation == UsdGeomTokens->uniform) {
-            valueId = itFV.faceId();
-        } else if (interpolation == UsdGeomTokens->vertex) {
-            valueId = itFV.vertId();
-        } else if (interpolation == UsdGeomTokens->faceVarying) {
-            valueId = fvi;
-        }
+    MIntArray valueIds(vertexList.length(), -1);
+
+    const bool uniform = interpolation == UsdGeomTokens->uniform;
+    const bool vertex = interpolation == UsdGeomTokens->vertex;
+    const bool faceVarying = interpolation == UsdGeomTokens->faceVarying;
+
+    unsigned int fvi = 0;
+    for (unsigned int faceId = 0; faceId < vertexCounts.length(); ++faceId) {
+        const int numFaceVertices = vertexCounts[faceId];
+        for (int i = 0; i < numFaceVertices; ++i, ++fvi) {
+            int valueId = 0;
+            if (uniform) {
+                valueId = faceId;
+            } else if (vertex) {
+                valueId = vertexList[fvi];
+            } else if (faceVarying) {
+                valueId = fvi;
+            }
 
-        if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
-            // The data is indexed, so consult the indices array for the
-            // correct index into the data.
-            valueId = assignmentIndices[valueId];
+            if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
+                // The data is indexed, so consult the indices array for the
+                // correct index into the data.
+                valueId = assignmentIndices[valueId];
 
-            if (valueId == unauthoredValuesIndex) {
-                // This component had no authored value, so leave it unassigned.
-                continue;
+                if (valueId == unauthoredValuesIndex) {
+                    // This component had no authored value, so leave it unassigned.
+                    continue;
+                }
             }
-        }
 
-        valueIds[fvi] = valueId;
+            valueIds[fvi] = valueId;
+        }
     }
 
     return valueIds;
 }
 
+MIntArray getMayaFaceVertexAssignmentIds(
+    const MFnMesh&    meshFn,
+    const TfToken&    interpolation,
+    const VtIntArray& assignmentIndices,
+    const int         unauthoredValuesIndex)
+{
+    MIntArray vertexCounts;
+    MIntArray vertexList;
+    meshFn.getVertices(vertexCounts, vertexList);
+    return getMayaFaceVertexAssignmentIds(
+        vertexCounts, vertexList, interpolation, assignmentIndices, unauthoredValuesIndex);
+}
+
+bool isUVSetPrimvarType(const SdfValueTypeName& typeName)
+{
+    // Looks for TexCoord2fArray types for UV sets first. Otherwise, if env
+    // variable for reading Float2 as uv sets is turned on, we assume that
+    // Float2Array primvars are UV sets.
+    return typeName == SdfValueTypeNames->TexCoord2fArray
+        || (UsdMayaReadUtil::ReadFloat2AsUV() && typeName == SdfValueTypeNames->Float2Array);
+}
+
+bool isColorSetPrimvarType(const SdfValueTypeName& typeName)
+{
+    return typeName == SdfValueTypeNames->FloatArray || typeName == SdfValueTypeNames->Float3Array
+        || typeName == SdfValueTypeNames->Color3fArray || typeName == SdfValueTypeNames->Float4Array
+        || typeName == SdfValueTypeNames->Color4fArray;
+}
+
+// Gets the values of the primvar from the data read ahead if there is some.
+template <typename T>
+bool getPrimvarValues(
+    const UsdGeomPrimvar&                    primvar,
+    const UsdMayaMeshReadUtils::PrimvarData* data,
+    T&                                       values)
+{
+    if (!data) {
+        return primvar.Get(&values);
+    }
+    if (!data->values.IsHolding<T>()) {
+        return false;
+    }
+    values = data->values.UncheckedGet<T>();
+    return true;
+}
+
+bool getPrimvarIndices(
+    const UsdGeomPrimvar&                    primvar,
+    const UsdMayaMeshReadUtils::PrimvarData* data,
+    VtIntArray&                              indices)
+{
+    if (!data) {
+        return primvar.GetIndices(&indices);
+    }
+    if (data->indexed) {
+        indices = data->indices;
+    }
+    return data->indexed;
+}
+
 bool assignUVSetPrimvarToMesh(
     const UsdGeomPrimvar&                     primvar,
     MFnMesh&                                  meshFn,
     bool&                                     firstUVPrimvar,
-    const std::map<std::string, std::string>& uvSetNameRemappings)
+    const std::map<std::string, std::string>& uvSetNameRemappings,
+    const UsdMayaMeshReadUtils::PrimvarData*  data)
 {
     const TfToken& primvarName = primvar.GetPrimvarName();
 
     VtVec2fArray uvValues;
-    if (!primvar.Get(&uvValues) || uvValues.empty()) {
+    if (!getPrimvarValues(primvar, data, uvValues) || uvValues.empty()) {
         TF_WARN(
             "Could not read UV values from primvar '%s' on mesh: %s",
             primvarName.GetText(),
@@ -258,14 +330,19 @@ bool assignUVSetPrimvarToMesh(
     // meaning.
     const int unauthoredValuesIndex = primvar.GetUnauthoredValuesIndex();
 
-    MFloatArray uCoords;
-    MFloatArray vCoords;
+    const bool skipUnauthored = unauthoredValuesIndex >= 0
+        && static_cast<size_t>(unauthoredValuesIndex) < uvValues.size();
+    const unsigned int numUVs = static_cast<unsigned int>(uvValues.size() - skipUnauthored);
+    MFloatArray        uCoords(numUVs);
+    MFloatArray        vCoords(numUVs);
 
+    unsigned int uvIndex = 0u;
     for (size_t uvId = 0u; uvId < uvValues.size(); ++uvId) {
         if (unauthoredValuesIndex < 0 || uvId != static_cast<size_t>(unauthoredValuesIndex)) {
             const GfVec2f& v = uvValues[uvId];
-            uCoords.append(v[0u]);
-            vCoords.append(v[1u]);
+            uCoords[uvIndex] = v[0u];
+            vCoords[uvIndex] = v[1u];
+            ++uvIndex;
         }
     }
 
@@ -279,7 +356,7 @@ bool assignUVSetPrimvarToMesh(
     }
 
     VtIntArray assignmentIndices;
-    if (primvar.GetIndices(&assignmentIndices)) {
+    if (getPrimvarIndices(primvar, data, assignmentIndices)) {
         if (unauthoredValuesIndex >= 0) {
             // Since the unauthored value was removed above, we need to fix up
             // the assignment indices to replace any index equal to the
@@ -297,10 +374,6 @@ bool assignUVSetPrimvarToMesh(
 
     const TfToken& interpolation = primvar.GetInterpolation();
 
-    // Build an array of value assignments for each face vertex in the mesh.
-    // Any assignments left as -1 will not be assigned a value.
-    MIntArray uvIds = getMayaFaceVertexAssignmentIds(meshFn, interpolation, assignmentIndices, -1);
-
     MIntArray vertexCounts;
     MIntArray vertexList;
     status = meshFn.getVertices(vertexCounts, vertexList);
@@ -312,6 +385,11 @@ bool assignUVSetPrimvarToMesh(
         return false;
     }
 
+    // Build an array of value assignments for each face vertex in the mesh.
+    // Any assignments left as -1 will not be assigned a value.
+    MIntArray uvIds = getMayaFaceVertexAssignmentIds(
+        vertexCounts, vertexList, interpolation, assignmentIndices, -1);
+
     status = meshFn.assignUVs(vertexCounts, uvIds, &uvSetName);
     if (status != MS::kSuccess) {
         TF_WARN(
@@ -325,9 +403,10 @@ bool assignUVSetPrimvarToMesh(
 }
 
 bool assignColorSetPrimvarToMesh(
-    const UsdGeomMesh&    mesh,
-    const UsdGeomPrimvar& primvar,
-    MFnMesh&              meshFn)
+    const UsdGeomMesh&                       mesh,
+    const UsdGeomPrimvar&                    primvar,
+    MFnMesh&                                 meshFn,
+    const UsdMayaMeshReadUtils::PrimvarData* data)
 {
 
     const TfToken&          primvarName = primvar.GetPrimvarName();
@@ -367,7 +446,7 @@ bool assignColorSetPrimvarToMesh(
 
     if (typeName == SdfValueTypeNames->FloatArray) {
         colorRep = MFnMesh::kAlpha;
-        if (!primvar.Get(&alphaArray) || alphaArray.empty()) {
+        if (!getPrimvarValues(primvar, data, alphaArray) || alphaArray.empty()) {
             status = MS::kFailure;
         } else {
             numValues = alphaArray.size();
@@ -375,7 +454,7 @@ bool assignColorSetPrimvarToMesh(
     } else if (
         typeName == SdfValueTypeNames->Float3Array || typeName == SdfValueTypeNames->Color3fArray) {
         colorRep = MFnMesh::kRGB;
-        if (!primvar.Get(&rgbArray) || rgbArray.empty()) {
+        if (!getPrimvarValues(primvar, data, rgbArray) || rgbArray.empty()) {
             status = MS::kFailure;
         } else {
             numValues = rgbArray.size();
@@ -383,7 +462,7 @@ bool assignColorSetPrimvarToMesh(
     } else if (
         typeName == SdfValueTypeNames->Float4Array || typeName == SdfValueTypeNames->Color4fArray) {
         colorRep = MFnMesh::kRGBA;
-        if (!primvar.Get(&rgbaArray) || rgbaArray.empty()) {
+        if (!getPrimvarValues(primvar, data, rgbaArray) || rgbaArray.empty()) {
             status = MS::kFailure;
         } else {
             numValues = rgbaArray.size();
@@ -408,7 +487,7 @@ bool assignColorSetPrimvarToMesh(
 
     VtIntArray assignmentIndices;
     int        unauthoredValuesIndex = -1;
-    if (primvar.GetIndices(&assignmentIndices)) {
+    if (getPrimvarIndices(primvar, data, assignmentIndices)) {
         // The primvar IS indexed, so the indices array is what determines the
         // number of color values.
         numValues = assignmentIndices.size();
@@ -426,7 +505,8 @@ bool assignColorSetPrimvarToMesh(
     // values are ordered in the primvar. Because of this, we recycle the
     // assignmentIndices array as we go to store the new mapping from component
     // index to color index.
-    MColorArray colorArray;
+    MColorArray  colorArray(static_cast<unsigned int>(numValues));
+    unsigned int numColors = 0;
     for (size_t i = 0; i < numValues; ++i) {
         int valueIndex = i;
 
@@ -443,9 +523,9 @@ bool assignColorSetPrimvarToMesh(
                 continue;
             }
 
-            // We'll be appending a new value, so the current length of the
-            // array gives us the new value's index.
-            assignmentIndices[i] = colorArray.length();
+            // We'll be adding a new value, so the current number of colors
+            // gives us the new value's index.
+            assignmentIndices[i] = numColors;
         }
 
         GfVec4f colorValue(1.0);
@@ -470,9 +550,10 @@ bool assignColorSetPrimvarToMesh(
             colorValue = MayaUsd::utils::ConvertLinearToMaya(colorValue);
         }
 
-        MColor mColor(colorValue[0], colorValue[1], colorValue[2], colorValue[3]);
-        colorArray.append(mColor);
+        colorArray[numColors++]
+            = MColor(colorValue[0], colorValue[1], colorValue[2], colorValue[3]);
     }
+    colorArray.setLength(numColors);
 
     // colorArray now stores all of the values and any unassigned components
     // have had their indices set to -1, so update the unauthored values index.
@@ -573,6 +654,240 @@ bool assignConstantPrimvarToMesh(const UsdGeomPrimvar& primvar, MFnMesh& meshFn)
 
     return UsdMayaReadUtil::SetMayaAttr(plug, primvarData);
 }
+
+bool isLeftHanded(const UsdGeomMesh& mesh)
+{
+    TfToken orientation;
+    return mesh.GetOrientationAttr().Get(&orientation)
+        && orientation == UsdGeomTokens->leftHanded;
+}
+
+using MeshTopologyPtr = std::shared_ptr<const UsdMayaMeshReadUtils::MeshTopology>;
+
+// Validates the topology and converts it to the face vertex order of Maya.
+// Returns null, with the reason, if the topology is invalid.
+MeshTopologyPtr convertTopology(
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices,
+    size_t            numPoints,
+    bool              leftHanded,
+    std::string*      reason)
+{
+    if (!UsdGeomMesh::ValidateTopology(faceVertexIndices, faceVertexCounts, numPoints, reason)) {
+        return nullptr;
+    }
+
+    auto topology = std::make_shared<UsdMayaMeshReadUtils::MeshTopology>();
+    topology->faceVertexCounts = faceVertexCounts;
+    topology->faceVertexIndices = faceVertexIndices;
+    topology->faceVertexFaces.resize(faceVertexIndices.size());
+
+    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
+    // Fix them to be in right-handed order, as expected by Maya.
+    int*   indices = leftHanded ? topology->faceVertexIndices.data() : nullptr;
+    int*   faces = topology->faceVertexFaces.data();
+    size_t firstIndex = 0;
+    for (size_t face = 0; face < faceVertexCounts.size(); ++face) {
+        const int vertexCount = faceVertexCounts[face];
+        std::fill(faces + firstIndex, faces + firstIndex + vertexCount, static_cast<int>(face));
+        if (indices) {
+            std::reverse(indices + firstIndex, indices + firstIndex + vertexCount);
+        }
+        firstIndex += vertexCount;
+    }
+    return topology;
+}
+
+// Converted topologies, shared by the meshes with identical face vertex counts
+// and indices. Scattered copies of the same asset only convert it once.
+class MeshTopologyCache
+{
+public:
+    MeshTopologyPtr find(
+        const VtIntArray& faceVertexCounts,
+        const VtIntArray& faceVertexIndices,
+        size_t            numPoints,
+        bool              leftHanded,
+        std::string*      reason)
+    {
+        size_t hash = numPoints;
+        MayaUsd::hash_combine(hash, leftHanded);
+        MayaUsd::hash_combine(hash, hash_value(faceVertexCounts));
+        MayaUsd::hash_combine(hash, hash_value(faceVertexIndices));
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (const _Entry* entry
+                = _find(hash, faceVertexCounts, faceVertexIndices, numPoints, leftHanded)) {
+                *reason = entry->reason;
+                return entry->topology;
+            }
+        }
+
+        // Convert without holding the lock, so that the other threads can
+        // still find their topologies. If another thread converted the same
+        // topology meanwhile, keep the first one.
+        _Entry newEntry;
+        newEntry.faceVertexCounts = faceVertexCounts;
+        newEntry.faceVertexIndices = faceVertexIndices;
+        newEntry.numPoints = numPoints;
+        newEntry.leftHanded = leftHanded;
+        newEntry.topology = convertTopology(
+            faceVertexCounts, faceVertexIndices, numPoints, leftHanded, &newEntry.reason);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const _Entry*               entry
+            = _find(hash, faceVertexCounts, faceVertexIndices, numPoints, leftHanded);
+        if (!entry) {
+            std::vector<_Entry>& entries = _entries[hash];
+            entries.push_back(std::move(newEntry));
+            entry = &entries.back();
+        }
+        *reason = entry->reason;
+        return entry->topology;
+    }
+
+private:
+    struct _Entry
+    {
+        VtIntArray      faceVertexCounts;
+        VtIntArray      faceVertexIndices;
+        size_t          numPoints { 0 };
+        bool            leftHanded { false };
+        MeshTopologyPtr topology;
+        std::string     reason;
+    };
+
+    const _Entry* _find(
+        size_t            hash,
+        const VtIntArray& faceVertexCounts,
+        const VtIntArray& faceVertexIndices,
+        size_t            numPoints,
+        bool              leftHanded) const
+    {
+        auto found = _entries.find(hash);
+        if (found == _entries.end()) {
+            return nullptr;
+        }
+        for (const _Entry& entry : found->second) {
+            if (entry.numPoints == numPoints && entry.leftHanded == leftHanded
+                && entry.faceVertexCounts == faceVertexCounts
+                && entry.faceVertexIndices == faceVertexIndices) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::mutex                                      _mutex;
+    std::unordered_map<size_t, std::vector<_Entry>> _entries;
+};
+
+void readMeshGeometry(
+    const UsdGeomMesh&              mesh,
+    const GfInterval&               frameRange,
+    MeshTopologyCache*              topologyCache,
+    UsdMayaMeshReadUtils::MeshData& data)
+{
+    data = UsdMayaMeshReadUtils::MeshData();
+
+    const SdfPath path = mesh.GetPath();
+
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+
+    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
+    if (fvc.ValueMightBeTimeVarying()) {
+        // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
+        // for the mesh, perhaps?  For now, better to give a more specific error
+        data.errors.push_back(TfStringPrintf(
+            "<%s> is a topologically varying Mesh (has animated "
+            "faceVertexCounts), which isn't currently supported. "
+            "Skipping...",
+            path.GetText()));
+    } else {
+        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
+    }
+
+    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
+    if (fvi.ValueMightBeTimeVarying()) {
+        // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
+        // for the mesh, perhaps?  For now, better to give a more specific error
+        data.errors.push_back(TfStringPrintf(
+            "<%s> is a topologically varying Mesh (has animated "
+            "faceVertexIndices), which isn't currently supported. "
+            "Skipping...",
+            path.GetText()));
+    } else {
+        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
+    }
+
+    // Sanity Checks. If the vertex arrays are empty, skip this mesh
+    if (faceVertexCounts.empty() || faceVertexIndices.empty()) {
+        data.errors.push_back(TfStringPrintf(
+            "faceVertexCounts or faceVertexIndices array is empty "
+            "[count: %zu, indices:%zu] on Mesh <%s>. Skipping...",
+            faceVertexCounts.size(),
+            faceVertexIndices.size(),
+            path.GetText()));
+    }
+
+    // Gather points and normals
+    // If timeInterval is non-empty, pick the first available sample in the
+    // timeInterval or default.
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    UsdTimeCode normalsTimeSample = UsdTimeCode::EarliestTime();
+
+    if (!frameRange.IsEmpty()) {
+        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &data.pointsTimeSamples);
+        if (!data.pointsTimeSamples.empty()) {
+            pointsTimeSample = data.pointsTimeSamples.front();
+        }
+
+        std::vector<double> normalsTimeSamples;
+        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
+        if (!normalsTimeSamples.empty()) {
+            normalsTimeSample = normalsTimeSamples.front();
+        }
+    }
+
+    mesh.GetPointsAttr().Get(&data.points, pointsTimeSample);
+
+    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
+    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
+
+    if (primvar.HasValue()) {
+        primvar.ComputeFlattened(&data.normals, normalsTimeSample);
+        data.normalsInterpolation = primvar.GetInterpolation();
+    } else {
+        mesh.GetNormalsAttr().Get(&data.normals, normalsTimeSample);
+        data.normalsInterpolation = mesh.GetNormalsInterpolation();
+    }
+
+    if (data.points.empty()) {
+        data.errors.push_back(
+            TfStringPrintf("points array is empty on Mesh <%s>. Skipping...", path.GetText()));
+    }
+
+    const bool  leftHanded = isLeftHanded(mesh);
+    std::string reason;
+    data.topology = topologyCache
+        ? topologyCache->find(
+            faceVertexCounts, faceVertexIndices, data.points.size(), leftHanded, &reason)
+        : convertTopology(
+            faceVertexCounts, faceVertexIndices, data.points.size(), leftHanded, &reason);
+    if (!data.topology) {
+        data.errors.push_back(TfStringPrintf(
+            "Skipping Mesh <%s> with invalid topology: %s", path.GetText(), reason.c_str()));
+    }
+}
+
+// Innermost prefetch scope.
+UsdMayaMeshReadUtils::MeshPrefetchScope* currentPrefetchScope = nullptr;
+
+// Number of meshes read together by a prefetch scope. Large enough to keep
+// the threads busy, small enough to not hold the data of the whole import.
+constexpr size_t kPrefetchBatchSize = 256;
 } // namespace
 
 // This can be customized for specific pipelines.
@@ -602,12 +917,131 @@ void UsdMayaMeshReadUtils::setEmitNormalsTag(MFnMesh& meshFn, const bool emitNor
     }
 }
 
+void UsdMayaMeshReadUtils::readMeshData(
+    const UsdGeomMesh& mesh,
+    const GfInterval&  frameRange,
+    MeshData&          data)
+{
+    readMeshGeometry(mesh, frameRange, nullptr, data);
+}
+
+void UsdMayaMeshReadUtils::readPrimvarData(const UsdGeomMesh& mesh, PrimvarDataMap& primvars)
+{
+    primvars.clear();
+    for (const UsdGeomPrimvar& primvar : UsdGeomPrimvarsAPI(mesh).GetPrimvars()) {
+        const SdfValueTypeName typeName = primvar.GetTypeName();
+        if (!isUVSetPrimvarType(typeName) && !isColorSetPrimvarType(typeName)) {
+            continue;
+        }
+        PrimvarData& data = primvars[primvar.GetPrimvarName()];
+        primvar.Get(&data.values);
+        data.indexed = primvar.GetIndices(&data.indices);
+    }
+}
+
+class UsdMayaMeshReadUtils::MeshPrefetchScope::Impl
+{
+public:
+    Impl(const std::vector<UsdGeomMesh>& meshes, const GfInterval& frameRange)
+        : _meshes(meshes)
+        , _frameRange(frameRange)
+        , _data(meshes.size())
+        , _states(meshes.size(), _Unread)
+    {
+        for (size_t i = 0; i < _meshes.size(); ++i) {
+            _indices.emplace(_meshes[i].GetPath(), i);
+        }
+    }
+
+    bool take(const UsdGeomMesh& mesh, const GfInterval& frameRange, MeshData& data)
+    {
+        if (frameRange != _frameRange) {
+            return false;
+        }
+        auto found = _indices.find(mesh.GetPath());
+        if (found == _indices.end()) {
+            return false;
+        }
+
+        const size_t index = found->second;
+        if (_states[index] == _Unread) {
+            _prefetch(index, std::min(index + kPrefetchBatchSize, _meshes.size()));
+        }
+        if (_states[index] != _Read) {
+            return false;
+        }
+
+        data = std::move(_data[index]);
+        _data[index] = MeshData();
+        _states[index] = _Taken;
+        return true;
+    }
+
+private:
+    enum _State : char
+    {
+        _Unread,
+        _Read,
+        _Taken
+    };
+
+    void _prefetch(size_t begin, size_t end)
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(begin, end), [this](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i < r.end(); ++i) {
+                    if (_states[i] != _Unread) {
+                        continue;
+                    }
+                    readMeshGeometry(_meshes[i], _frameRange, &_topologyCache, _data[i]);
+                    readPrimvarData(_meshes[i], _data[i].primvars);
+                }
+            });
+
+        for (size_t i = begin; i < end; ++i) {
+            if (_states[i] == _Unread) {
+                _states[i] = _Read;
+            }
+        }
+    }
+
+    const std::vector<UsdGeomMesh>                     _meshes;
+    const GfInterval                                   _frameRange;
+    std::vector<MeshData>                              _data;
+    std::vector<_State>                                _states;
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> _indices;
+    MeshTopologyCache                                  _topologyCache;
+};
+
+UsdMayaMeshReadUtils::MeshPrefetchScope::MeshPrefetchScope(
+    const std::vector<UsdGeomMesh>& meshes,
+    const GfInterval&               frameRange)
+    : _impl(std::make_unique<Impl>(meshes, frameRange))
+    , _previous(currentPrefetchScope)
+{
+    currentPrefetchScope = this;
+}
+
+UsdMayaMeshReadUtils::MeshPrefetchScope::~MeshPrefetchScope()
+{
+    currentPrefetchScope = _previous;
+}
+
+bool UsdMayaMeshReadUtils::MeshPrefetchScope::takeMeshData(
+    const UsdGeomMesh& mesh,
+    const GfInterval&  frameRange,
+    MeshData&          data)
+{
+    return currentPrefetchScope && currentPrefetchScope->_impl->take(mesh, frameRange, data);
+}
+
 void UsdMayaMeshReadUtils::assignPrimvarsToMesh(
     const UsdGeomMesh&                        mesh,
     const MObject&                            meshObj,
     const TfToken::Set&                       excludePrimvarSet,
     const TfToken::Set&                       excludePrivarNamespaceSet,
-    const std::map<std::string, std::string>& uvSetNameRemappings)
+    const std::map<std::string, std::string>& uvSetNameRemappings,
+    const PrimvarDataMap*                     primvarData)
 {
     if (meshObj.apiType() != MFn::kMesh) {
         return;
@@ -663,29 +1097,30 @@ void UsdMayaMeshReadUtils::assignPrimvarsToMesh(
             }
         }
 
+        // Values read ahead, if any.
+        const PrimvarData* data = nullptr;
+        if (primvarData) {
+            auto found = primvarData->find(fullName);
+            if (found != primvarData->end()) {
+                data = &found->second;
+            }
+        }
+
         // XXX: Maya stores UVs in MFloatArrays and color set data in MColors
         // which store floats, so we currently only import primvars holding
         // float-typed arrays. Should we still consider other precisions
         // (double, half, ...) and/or numeric types (int)?
-        if (typeName == SdfValueTypeNames->TexCoord2fArray
-            || (UsdMayaReadUtil::ReadFloat2AsUV() && typeName == SdfValueTypeNames->Float2Array)) {
-            // Looks for TexCoord2fArray types for UV sets first
-            // Otherwise, if env variable for reading Float2
-            // as uv sets is turned on, we assume that Float2Array primvars
-            // are UV sets.
-            if (!assignUVSetPrimvarToMesh(primvar, meshFn, firstUVPrimvar, uvSetNameRemappings)) {
+        if (isUVSetPrimvarType(typeName)) {
+            if (!assignUVSetPrimvarToMesh(
+                    primvar, meshFn, firstUVPrimvar, uvSetNameRemappings, data)) {
                 TF_WARN(
                     "Unable to retrieve and assign data for UV set <%s> on "
                     "mesh <%s>",
                     name.GetText(),
                     mesh.GetPrim().GetPath().GetText());
             }
-        } else if (
-            typeName == SdfValueTypeNames->FloatArray || typeName == SdfValueTypeNames->Float3Array
-            || typeName == SdfValueTypeNames->Color3fArray
-            || typeName == SdfValueTypeNames->Float4Array
-            || typeName == SdfValueTypeNames->Color4fArray) {
-            if (!assignColorSetPrimvarToMesh(mesh, primvar, meshFn)) {
+        } else if (isColorSetPrimvarType(typeName)) {
+            if (!assignColorSetPrimvarToMesh(mesh, primvar, meshFn, data)) {
                 TF_WARN(
                     "Unable to retrieve and assign data for color set <%s> "
                     "on mesh <%s>",
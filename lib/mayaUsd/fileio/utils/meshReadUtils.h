@@ -20,11 +20,15 @@
 
 #include <mayaUsd/base/api.h>
 
+#include <pxr/base/gf/interval.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usdGeom/mesh.h>
 
@@ -33,6 +37,10 @@
 #include <maya/MObject.h>
 #include <maya/MString.h>
 
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -78,13 +86,87 @@ bool getEmitNormalsTag(const MFnMesh& mesh, bool* value);
 MAYAUSD_CORE_PUBLIC
 void setEmitNormalsTag(MFnMesh& meshFn, const bool emitNormals);
 
+/// Topology of a mesh in the face vertex order of Maya, shared by the meshes
+/// that have the same one.
+struct MeshTopology
+{
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    // Face of each face vertex.
+    VtIntArray faceVertexFaces;
+};
+
+/// Values and indices of a UV set or color set primvar, read at the default time.
+struct PrimvarData
+{
+    VtValue    values;
+    VtIntArray indices;
+    bool       indexed { false };
+};
+
+using PrimvarDataMap = std::unordered_map<TfToken, PrimvarData, TfToken::HashFunctor>;
+
+/// USD data needed to create the Maya mesh of a UsdGeomMesh.
+struct MeshData
+{
+    // Null if the mesh must be skipped.
+    std::shared_ptr<const MeshTopology> topology;
+    VtVec3fArray                        points;
+    // Samples of the points in the frame range.
+    std::vector<double> pointsTimeSamples;
+    VtVec3fArray        normals;
+    TfToken             normalsInterpolation;
+    // Problems found while reading, to be reported when creating the Maya mesh.
+    std::vector<std::string> errors;
+    PrimvarDataMap           primvars;
+};
+
+/// Reads the topology, points and normals of \p mesh, the points and normals at
+/// their first sample in \p frameRange, or at the earliest time if it is empty.
+/// Left-handed faces are reversed to be right-handed, as expected by Maya.
+/// Diagnostics are kept in the data instead of being posted, so this can run on
+/// any thread.
+MAYAUSD_CORE_PUBLIC
+void readMeshData(const UsdGeomMesh& mesh, const GfInterval& frameRange, MeshData& data);
+
+/// Reads the values of the UV set and color set primvars of \p mesh.
+MAYAUSD_CORE_PUBLIC
+void readPrimvarData(const UsdGeomMesh& mesh, PrimvarDataMap& primvars);
+
+/// \brief Reads the data of the meshes of an import ahead of their creation.
+///
+/// While the scope exists, the meshes it was given are read in parallel, in
+/// batches following the order of the list, the first time one of them is
+/// taken. Meshes with identical topologies share a single converted topology.
+/// Scopes can only be used on the main thread, and the innermost one is used.
+class MAYAUSD_CORE_PUBLIC MeshPrefetchScope
+{
+public:
+    MeshPrefetchScope(const std::vector<UsdGeomMesh>& meshes, const GfInterval& frameRange);
+    ~MeshPrefetchScope();
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(MeshPrefetchScope);
+
+    /// Moves the data of \p mesh read for \p frameRange into \p data.
+    /// Returns false if no scope reads that mesh for that frame range.
+    static bool takeMeshData(const UsdGeomMesh& mesh, const GfInterval& frameRange, MeshData& data);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+    MeshPrefetchScope*    _previous;
+};
+
+/// Assigns the primvars of \p mesh to the Maya mesh. Primvar values found in
+/// \p primvarData are used instead of being read again.
 MAYAUSD_CORE_PUBLIC
 void assignPrimvarsToMesh(
     const UsdGeomMesh&                        mesh,
     const MObject&                            meshObj,
     const TfToken::Set&                       excludePrimvarSet,
     const TfToken::Set&                       excludePrimvarNamespaceSet,
-    const std::map<std::string, std::string>& uvSetNameRemappings);
+    const std::map<std::string, std::string>& uvSetNameRemappings,
+    const PrimvarDataMap*                     primvarData = nullptr);
 
 MAYAUSD_CORE_PUBLIC
 void assignInvisibleFaces(const UsdGeomMesh& mesh, const MObject& meshObj);
@@ -57,6 +57,13 @@
 #include <maya/MUintArray.h>
 #include <maya/MVector.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 static constexpr char kMayaAttrNameInMesh[] = "inMesh";
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -339,7 +346,45 @@ void MergeEquivalentColorSetValues(
     }
 }
 
-GfVec3f LinearColorFromColorSet(const MColor& mayaColor, bool shouldConvertToLinear)
+//! Number of faces processed by a single task when gathering face-vertex data.
+constexpr unsigned int _kFaceGrainSize = 4096;
+
+// Fills \p offsets with the index of the first face vertex of each face, for
+// the given per-face counts, and returns the total number of face vertices.
+unsigned int _ComputeFaceOffsets(const MIntArray& counts, std::vector<unsigned int>& offsets)
+{
+    const unsigned int numFaces = counts.length();
+    offsets.resize(numFaces);
+
+    unsigned int offset = 0u;
+    for (unsigned int face = 0u; face < numFaces; ++face) {
+        offsets[face] = offset;
+        offset += static_cast<unsigned int>(std::max(counts[face], 0));
+    }
+    return offset;
+}
+
+// Returns the index of the shader value to use for the given face, or -1 if
+// there is none. Shader values for the mesh could be constant
+// (shadersAssignmentIndices is empty) or uniform.
+int _ShaderValueIndex(
+    const VtIntArray& shadersAssignmentIndices,
+    size_t            numShaderValues,
+    unsigned int      faceIndex)
+{
+    if (shadersAssignmentIndices.empty()) {
+        return (numShaderValues == 1) ? 0 : -1;
+    }
+    if (static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+        const int tmpIndex = shadersAssignmentIndices[faceIndex];
+        if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < numShaderValues) {
+            return tmpIndex;
+        }
+    }
+    return -1;
+}
+
+GfVec3f LinearColorFromColorSet(const GfVec4f& mayaColor, bool shouldConvertToLinear)
 {
     // we assume all color sets except displayColor are in linear space.
     // if we got a color from colorSetData and we're a displayColor, we
@@ -912,29 +957,63 @@ bool UsdMayaMeshWriteUtils::getMeshUVSetData(
         uvArray->emplace_back(uArray[uvId], vArray[uvId]);
     }
 
-    // Now iterate through all the face vertices and fill in the faceVarying
-    // assignmentIndices array, again in the same order as in the Maya mesh.
-    const unsigned int numFaceVertices = mesh.numFaceVertices(&status);
+    // Now fill in the faceVarying assignmentIndices array, again in the same
+    // order as in the Maya mesh. UVs are assigned per face: a face either has
+    // a UV for each of its face vertices or none at all, so the assigned UV
+    // ids can be copied face by face, leaving unmapped faces unassigned.
+    MIntArray faceVertexCounts, faceVertexIndices;
+    status = mesh.getVertices(faceVertexCounts, faceVertexIndices);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
+    const unsigned int numFaces = faceVertexCounts.length();
+    if (uvCounts.length() != numFaces) {
+        return false;
+    }
+
+    std::vector<unsigned int> faceOffsets, uvOffsets;
+    const unsigned int        numFaceVertices = _ComputeFaceOffsets(faceVertexCounts, faceOffsets);
+    const unsigned int        numUVIds = _ComputeFaceOffsets(uvCounts, uvOffsets);
+    if (numUVIds != uvIds.length()) {
+        return false;
+    }
+
     assignmentIndices->assign(static_cast<size_t>(numFaceVertices), -1);
     *interpolation = UsdGeomTokens->faceVarying;
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0u;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        if (!itFV.hasUVs(uvSetName)) {
-            // No UVs for this faceVertex, so leave it unassigned.
-            continue;
-        }
-
-        int uvIndex;
-        itFV.getUVIndex(uvIndex, &uvSetName);
-        if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= uArray.length()) {
-            return false;
-        }
+    const MIntArray& faceCounts = faceVertexCounts;
+    const MIntArray& faceUVCounts = uvCounts;
+    const MIntArray& faceUVIds = uvIds;
+    const int        numUVs = static_cast<int>(uArray.length());
+    int* const       dstIndices = assignmentIndices->data();
+    std::atomic_bool invalidUVIndex(false);
+    tbb::parallel_for(
+        tbb::blocked_range<unsigned int>(0u, numFaces, _kFaceGrainSize),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+            for (unsigned int face = range.begin(); face < range.end(); ++face) {
+                const int uvCount = faceUVCounts[face];
+                if (uvCount == 0) {
+                    // No UVs for this face, so leave it unassigned.
+                    continue;
+                }
+                if (uvCount != faceCounts[face]) {
+                    invalidUVIndex = true;
+                    return;
+                }
 
-        (*assignmentIndices)[fvi] = uvIndex;
+                const unsigned int fvi = faceOffsets[face];
+                const unsigned int uvi = uvOffsets[face];
+                for (int i = 0; i < uvCount; ++i) {
+                    const int uvIndex = faceUVIds[uvi + i];
+                    if (uvIndex < 0 || uvIndex >= numUVs) {
+                        invalidUVIndex = true;
+                        return;
+                    }
+                    dstIndices[fvi + i] = uvIndex;
+                }
+            }
+        });
+    if (invalidUVIndex) {
+        return false;
     }
 
     // We do not merge indexed values or compress indices here in an effort to
@@ -1275,118 +1354,138 @@ bool UsdMayaMeshWriteUtils::getMeshColorSetData(
     *colorSetRep = mesh.getColorRepresentation(colorSet);
     *clamped = mesh.isColorClamped(colorSet);
 
-    // We'll populate the assignment indices for every face vertex, but we'll
-    // only push values into the data if the face vertex has a value. All face
-    // vertices are initially unassigned/unauthored.
-    colorSetRGBData->clear();
-    colorSetAlphaData->clear();
-    colorSetAssignmentIndices->assign((size_t)colorSetData.length(), -1);
-    *interpolation = UsdGeomTokens->faceVarying;
+    // Gather the face of every face vertex from the face vertex counts, in the
+    // same order as the face vertex colors.
+    MIntArray faceVertexCounts, faceVertexIndices;
+    if (mesh.getVertices(faceVertexCounts, faceVertexIndices) == MS::kFailure) {
+        return false;
+    }
 
-    // Loop over every face vertex to populate the value arrays.
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        // If this is a displayColor color set, we may need to fallback on the
-        // bound shader colors/alphas for this face in some cases. In
-        // particular, if the color set is alpha-only, we fallback on the
-        // shader values for the color. If the color set is RGB-only, we
-        // fallback on the shader values for alpha only. If there's no authored
-        // color for this face vertex, we use both the color AND alpha values
-        // from the shader.
-        bool useShaderColorFallback = false;
-        bool useShaderAlphaFallback = false;
-        if (isDisplayColor) {
-            if (colorSetData[fvi] == unsetColor) {
-                useShaderColorFallback = true;
-                useShaderAlphaFallback = true;
-            } else if (*colorSetRep == MFnMesh::kAlpha) {
-                // The color set does not provide color, so fallback on shaders.
-                useShaderColorFallback = true;
-            } else if (*colorSetRep == MFnMesh::kRGB) {
-                // The color set does not provide alpha, so fallback on shaders.
-                useShaderAlphaFallback = true;
-            }
-        }
+    std::vector<unsigned int> faceOffsets;
+    const unsigned int numFaceVertices = _ComputeFaceOffsets(faceVertexCounts, faceOffsets);
+    if (numFaceVertices != colorSetData.length()) {
+        return false;
+    }
 
-        // If we're exporting displayColor and we use the value from the color
-        // set, we need to convert it to linear.
-        bool convertDisplayColorToLinear = isDisplayColor;
-
-        // Shader values for the mesh could be constant
-        // (shadersAssignmentIndices is empty) or uniform.
-        int faceIndex = itFV.faceId();
-        if (useShaderColorFallback) {
-            // There was no color value in the color set to use, so we use the
-            // shader color, or the default color if there is no shader color.
-            // This color will already be in linear space, so don't convert it
-            // again.
-            convertDisplayColorToLinear = false;
-
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersRGBData.size() == 1) {
-                    valueIndex = 0;
-                }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+    std::vector<GfVec4f> colors(numFaceVertices);
+    colorSetData.get(reinterpret_cast<float(*)[4]>(colors.data()));
+    const GfVec4f unsetValue(unsetColor.r, unsetColor.g, unsetColor.b, unsetColor.a);
+
+    // Resolve the value of every face vertex independently. Face vertices
+    // without a value are flagged, so that the values can then be compacted
+    // in face vertex order.
+    std::vector<GfVec3f>                rgbValues(numFaceVertices);
+    std::vector<float>                  alphaValues(numFaceVertices);
+    std::vector<char>                   hasValue(numFaceVertices, 0);
+    const MIntArray&                    faceCounts = faceVertexCounts;
+    const MFnMesh::MColorRepresentation rep = *colorSetRep;
+    tbb::parallel_for(
+        tbb::blocked_range<unsigned int>(0u, faceCounts.length(), _kFaceGrainSize),
+        [&](const tbb::blocked_range<unsigned int>& range) {
+            for (unsigned int face = range.begin(); face < range.end(); ++face) {
+                const unsigned int faceBegin = faceOffsets[face];
+                const unsigned int faceEnd = faceBegin + std::max(faceCounts[face], 0);
+                for (unsigned int fvi = faceBegin; fvi < faceEnd; ++fvi) {
+                    GfVec4f& color = colors[fvi];
+
+                    // If this is a displayColor color set, we may need to fallback on the
+                    // bound shader colors/alphas for this face in some cases. In
+                    // particular, if the color set is alpha-only, we fallback on the
+                    // shader values for the color. If the color set is RGB-only, we
+                    // fallback on the shader values for alpha only. If there's no
+                    // authored color for this face vertex, we use both the color AND
+                    // alpha values from the shader.
+                    bool useShaderColorFallback = false;
+                    bool useShaderAlphaFallback = false;
+                    if (isDisplayColor) {
+                        if (color == unsetValue) {
+                            useShaderColorFallback = true;
+                            useShaderAlphaFallback = true;
+                        } else if (rep == MFnMesh::kAlpha) {
+                            // The color set does not provide color, so fallback on shaders.
+                            useShaderColorFallback = true;
+                        } else if (rep == MFnMesh::kRGB) {
+                            // The color set does not provide alpha, so fallback on shaders.
+                            useShaderAlphaFallback = true;
+                        }
+                    }
 
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersRGBData.size()) {
-                    valueIndex = tmpIndex;
-                }
-            }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][0] = shadersRGBData[valueIndex][0];
-                colorSetData[fvi][1] = shadersRGBData[valueIndex][1];
-                colorSetData[fvi][2] = shadersRGBData[valueIndex][2];
-            } else {
-                // No shader color to fallback on. Use the default shader color.
-                colorSetData[fvi][0] = kUnauthoredShaderRGB[0];
-                colorSetData[fvi][1] = kUnauthoredShaderRGB[1];
-                colorSetData[fvi][2] = kUnauthoredShaderRGB[2];
-            }
-        }
-        if (useShaderAlphaFallback) {
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersAlphaData.size() == 1) {
-                    valueIndex = 0;
-                }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersAlphaData.size()) {
-                    valueIndex = tmpIndex;
-                }
-            }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][3] = shadersAlphaData[valueIndex];
-            } else {
-                // No shader alpha to fallback on. Use the default shader alpha.
-                colorSetData[fvi][3] = kUnauthoredShaderAlpha;
-            }
-        }
+                    // If we're exporting displayColor and we use the value from the
+                    // color set, we need to convert it to linear.
+                    bool convertDisplayColorToLinear = isDisplayColor;
+
+                    if (useShaderColorFallback) {
+                        // There was no color value in the color set to use, so we use
+                        // the shader color, or the default color if there is no shader
+                        // color. This color will already be in linear space, so don't
+                        // convert it again.
+                        convertDisplayColorToLinear = false;
+
+                        const int valueIndex = _ShaderValueIndex(
+                            shadersAssignmentIndices, shadersRGBData.size(), face);
+                        if (valueIndex >= 0) {
+                            color[0] = shadersRGBData[valueIndex][0];
+                            color[1] = shadersRGBData[valueIndex][1];
+                            color[2] = shadersRGBData[valueIndex][2];
+                        } else {
+                            // No shader color to fallback on. Use the default shader color.
+                            color[0] = kUnauthoredShaderRGB[0];
+                            color[1] = kUnauthoredShaderRGB[1];
+                            color[2] = kUnauthoredShaderRGB[2];
+                        }
+                    }
+                    if (useShaderAlphaFallback) {
+                        const int valueIndex = _ShaderValueIndex(
+                            shadersAssignmentIndices, shadersAlphaData.size(), face);
+                        if (valueIndex >= 0) {
+                            color[3] = shadersAlphaData[valueIndex];
+                        } else {
+                            // No shader alpha to fallback on. Use the default shader alpha.
+                            color[3] = kUnauthoredShaderAlpha;
+                        }
+                    }
 
-        // If we have a color/alpha value, add it to the data to be returned.
-        if (colorSetData[fvi] != unsetColor) {
-            GfVec3f rgbValue = kUnauthoredColorSetRGB;
-            float   alphaValue = kUnauthoredColorAlpha;
+                    // If we have a color/alpha value, it will be added to the data to be
+                    // returned.
+                    if (color != unsetValue) {
+                        GfVec3f rgbValue = kUnauthoredColorSetRGB;
+                        float   alphaValue = kUnauthoredColorAlpha;
 
-            if (useShaderColorFallback || (*colorSetRep == MFnMesh::kRGB)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                rgbValue = LinearColorFromColorSet(colorSetData[fvi], convertDisplayColorToLinear);
-            }
-            if (useShaderAlphaFallback || (*colorSetRep == MFnMesh::kAlpha)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                alphaValue = colorSetData[fvi][3];
+                        if (useShaderColorFallback || (rep == MFnMesh::kRGB)
+                            || (rep == MFnMesh::kRGBA)) {
+                            rgbValue = LinearColorFromColorSet(color, convertDisplayColorToLinear);
+                        }
+                        if (useShaderAlphaFallback || (rep == MFnMesh::kAlpha)
+                            || (rep == MFnMesh::kRGBA)) {
+                            alphaValue = color[3];
+                        }
+
+                        rgbValues[fvi] = rgbValue;
+                        alphaValues[fvi] = alphaValue;
+                        hasValue[fvi] = 1;
+                    }
+                }
             }
+        });
+
+    // We'll populate the assignment indices for every face vertex, but we'll
+    // only push values into the data if the face vertex has a value. All face
+    // vertices are initially unassigned/unauthored.
+    const size_t numValues = std::count(hasValue.begin(), hasValue.end(), 1);
+    colorSetRGBData->resize(numValues);
+    colorSetAlphaData->resize(numValues);
+    colorSetAssignmentIndices->assign(static_cast<size_t>(numFaceVertices), -1);
+    *interpolation = UsdGeomTokens->faceVarying;
 
-            colorSetRGBData->push_back(rgbValue);
-            colorSetAlphaData->push_back(alphaValue);
-            (*colorSetAssignmentIndices)[fvi] = colorSetRGBData->size() - 1;
+    GfVec3f* const dstRGB = colorSetRGBData->data();
+    float* const   dstAlpha = colorSetAlphaData->data();
+    int* const     dstIndices = colorSetAssignmentIndices->data();
+    int            valueIndex = 0;
+    for (unsigned int fvi = 0u; fvi < numFaceVertices; ++fvi) {
+        if (hasValue[fvi]) {
+            dstRGB[valueIndex] = rgbValues[fvi];
+            dstAlpha[valueIndex] = alphaValues[fvi];
+            dstIndices[fvi] = valueIndex++;
         }
     }
 
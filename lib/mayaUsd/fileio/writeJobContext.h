@@ -214,6 +214,23 @@ private:
     // manage two containers of shared pointers.
     std::map<MObjectHandle, std::pair<size_t, size_t>, MObjectHandleComp> _objectsToMasterWriters;
 
+    /// Data of an instance master shared by all of its instances. It is
+    /// gathered from the master's prim writers when the first instance writer
+    /// is created, instead of once per instance.
+    struct _InstanceMasterInfo
+    {
+        bool          exportsGprims = false;
+        SdfPathVector modelPaths;
+        /// For each DAG path written by the master's prim writers, the index
+        /// of each of its components under its parent, from the master root
+        /// down, and the USD path it is written to in the master.
+        std::vector<std::pair<std::vector<unsigned int>, SdfPath>> dagToUsdPaths;
+    };
+
+    /// Mapping of Maya object handles to the data shared by all the instances
+    /// of the corresponding instance master.
+    std::map<MObjectHandle, _InstanceMasterInfo, MObjectHandleComp> _objectsToMasterInfo;
+
     UsdPrim mInstancesPrim;
     SdfPath mRootPrimPath;
 
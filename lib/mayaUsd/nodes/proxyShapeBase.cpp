@@ -2272,23 +2272,50 @@ bool MayaUsdProxyShapeBase::closestPoint(
     MProfilingScope profilerScope(
         _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Compute closest point");
 
-    if (_sharedClosestPointDelegate) {
-        GfRay ray(
-            GfVec3d(raySource.x, raySource.y, raySource.z),
-            GfVec3d(rayDirection.x, rayDirection.y, rayDirection.z));
-        GfVec3d hitPoint;
-        GfVec3d hitNorm;
-        if (_sharedClosestPointDelegate(*this, ray, &hitPoint, &hitNorm)) {
-            theClosestPoint = MPoint(hitPoint[0], hitPoint[1], hitPoint[2]);
-            theClosestNormal = MVector(hitNorm[0], hitNorm[1], hitNorm[2]);
-            return true;
+    GfRay ray(
+        GfVec3d(raySource.x, raySource.y, raySource.z),
+        GfVec3d(rayDirection.x, rayDirection.y, rayDirection.z));
+    GfVec3d hitPoint;
+    GfVec3d hitNorm;
+    bool    found = false;
+    bool    skippedGprims = false;
+
+    UsdStageRefPtr stage = getUsdStage();
+    if (stage) {
+        // The intersector keeps the mesh hierarchies built by previous queries
+        // on the same stage.
+        if (!_rayIntersector || _rayIntersector->getStage() != stage) {
+            _rayIntersector = std::make_unique<MayaUsd::StageRayIntersector>(stage);
         }
+
+        MayaUsd::StageRayIntersector::Options options;
+        options.time = getTime();
+        options.rootPath = getPrimPath();
+        options.excludedPaths = getExcludePrimPaths();
+        getDrawPurposeToggles(
+            &options.renderPurpose, &options.proxyPurpose, &options.guidePurpose);
+
+        MayaUsd::StageRayIntersector::Hit hit;
+        found = _rayIntersector->intersect(ray, options, &hit, &skippedGprims);
+        hitPoint = hit.point;
+        hitNorm = hit.normal;
     }
 
-    return false;
+    // Only meshes are intersected on the CPU, the delegate also finds the
+    // other gprims.
+    if (skippedGprims && _sharedClosestPointDelegate) {
+        found = _sharedClosestPointDelegate(*this, ray, &hitPoint, &hitNorm);
+    }
+    if (!found) {
+        return false;
+    }
+
+    theClosestPoint = MPoint(hitPoint[0], hitPoint[1], hitPoint[2]);
+    theClosestNormal = MVector(hitNorm[0], hitNorm[1], hitNorm[2]);
+    return true;
 }
 
-bool MayaUsdProxyShapeBase::canMakeLive() const { return (bool)_sharedClosestPointDelegate; }
+bool MayaUsdProxyShapeBase::canMakeLive() const { return true; }
 
 void MayaUsdProxyShapeBase::processPlugDirty(
     MObject& /*observedNode*/,
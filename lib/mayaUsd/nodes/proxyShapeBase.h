@@ -41,6 +41,7 @@
 #include <ufe/ufe.h>
 
 #include <map>
+#include <memory>
 
 UFE_NS_DEF { class Path; }
 
@@ -51,6 +52,7 @@ UFE_NS_DEF { class Path; }
 #include <mayaUsd/nodes/usdPrimProvider.h>
 #include <mayaUsd/utils/mayaNodeObserver.h>
 #include <mayaUsd/utils/mayaNodeTypeObserver.h>
+#include <mayaUsd/utils/stageRayIntersector.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -141,7 +143,9 @@ public:
     static MObject variantFallbacksAttr;
 
     /// Delegate function for computing the closest point and surface normal
-    /// on the proxy shape to a given ray.
+    /// on the proxy shape to a given ray. The ray is intersected on the CPU
+    /// with the meshes of the stage, the delegate is used for stages with
+    /// other gprims.
     /// The input ray, output point, and output normal should be in the
     /// proxy shape's local space.
     /// Should return true if a point was found, and false otherwise.
@@ -433,6 +437,9 @@ private:
 
     static ClosestPointDelegate _sharedClosestPointDelegate;
 
+    // CPU ray queries used when no closest point delegate is installed.
+    std::unique_ptr<MayaUsd::StageRayIntersector> _rayIntersector;
+
     // Whether or not the proxy shape has enabled UFE/subpath selection
     const bool _isUfeSelectionEnabled;
 
@@ -33,6 +33,7 @@ TF_WRAP_MODULE
     TF_WRAP(DiagnosticDelegate);
     TF_WRAP(LayerLocking);
     TF_WRAP(LoadRules);
+    TF_WRAP(MeshReadUtils);
     TF_WRAP(MeshWriteUtils);
 #ifdef UFE_V3_FEATURES_AVAILABLE
     TF_WRAP(PrimUpdater);
@@ -0,0 +1,91 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/fileio/utils/meshReadUtils.h>
+
+#include <pxr/base/gf/interval.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/extract.hpp>
+#include <boost/python/list.hpp>
+#include <boost/python/tuple.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Prefetches the data of the meshes, then takes it mesh by mesh as an import
+// does. For each mesh, returns None if it is skipped, otherwise the index of
+// its topology among the distinct topologies taken, followed by the face vertex
+// counts and indices of that topology.
+static list _TakePrefetchedMeshData(const list& meshes, const GfInterval& frameRange)
+{
+    std::vector<UsdGeomMesh> meshVector;
+    for (int i = 0, n = len(meshes); i < n; ++i) {
+        meshVector.push_back(extract<UsdGeomMesh>(meshes[i]));
+    }
+
+    // Keep the topologies alive so that their addresses can't be reused.
+    std::vector<std::shared_ptr<const UsdMayaMeshReadUtils::MeshTopology>> topologies;
+
+    list                                    result;
+    UsdMayaMeshReadUtils::MeshPrefetchScope prefetch(meshVector, frameRange);
+    for (const UsdGeomMesh& mesh : meshVector) {
+        UsdMayaMeshReadUtils::MeshData data;
+        if (!UsdMayaMeshReadUtils::MeshPrefetchScope::takeMeshData(mesh, frameRange, data)
+            || !data.topology) {
+            result.append(object());
+            continue;
+        }
+
+        auto found = std::find(topologies.begin(), topologies.end(), data.topology);
+        if (found == topologies.end()) {
+            found = topologies.insert(found, data.topology);
+        }
+        result.append(make_tuple(
+            std::distance(topologies.begin(), found),
+            data.topology->faceVertexCounts,
+            data.topology->faceVertexIndices));
+    }
+    return result;
+}
+
+// Dummy class for putting UsdMayaMeshReadUtils namespace functions in a Python
+// MeshReadUtils namespace.
+class DummyScopeClass
+{
+};
+
+} // anonymous namespace
+
+void wrapMeshReadUtils()
+{
+    scope s = class_<DummyScopeClass>("MeshReadUtils", no_init)
+
+                  .def("TakePrefetchedMeshData", &_TakePrefetchedMeshData)
+                  .staticmethod("TakePrefetchedMeshData")
+
+        ;
+}
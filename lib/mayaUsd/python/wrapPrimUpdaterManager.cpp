@@ -71,6 +71,38 @@ bool mergeToUsd(const std::string& nodeName, const VtDictionary& userArgs = VtDi
 
 BOOST_PYTHON_FUNCTION_OVERLOADS(mergeToUsd_overloads, mergeToUsd, 1, 2)
 
+bool mergeAllToUsd(
+    const boost::python::list& nodeNames,
+    const VtDictionary&        userArgs = VtDictionary())
+{
+    PrimUpdaterManager::PulledPrimPaths pulledPrims;
+
+    const auto count = boost::python::len(nodeNames);
+    for (boost::python::ssize_t i = 0; i < count; ++i) {
+        const std::string nodeName = boost::python::extract<std::string>(nodeNames[i]);
+
+        MObject obj;
+        MStatus status = UsdMayaUtil::GetMObjectByName(nodeName, obj);
+        if (status != MStatus::kSuccess)
+            return false;
+
+        MDagPath dagPath;
+        status = MDagPath::getAPathTo(obj, dagPath);
+        if (status != MStatus::kSuccess)
+            return false;
+
+        Ufe::Path path;
+        if (!MayaUsd::readPullInformation(dagPath, path))
+            return false;
+
+        pulledPrims.emplace_back(path, dagPath);
+    }
+
+    return PrimUpdaterManager::getInstance().mergeToUsd(pulledPrims, userArgs);
+}
+
+BOOST_PYTHON_FUNCTION_OVERLOADS(mergeAllToUsd_overloads, mergeAllToUsd, 1, 2)
+
 bool editAsMaya(const std::string& ufePathString)
 {
     Ufe::Path path = Ufe::PathString::path(ufePathString);
@@ -133,6 +165,7 @@ void wrapPrimUpdaterManager()
         "PrimUpdaterManager", boost::python::no_init)
         .def("isAnimated", isAnimated)
         .def("mergeToUsd", mergeToUsd, mergeToUsd_overloads())
+        .def("mergeAllToUsd", mergeAllToUsd, mergeAllToUsd_overloads())
         .def("editAsMaya", editAsMaya)
         .def("canEditAsMaya", canEditAsMaya)
         .def("discardEdits", discardEdits)
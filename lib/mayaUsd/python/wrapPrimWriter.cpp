@@ -624,6 +624,7 @@ void wrapJobExportArgs()
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
+        .def_readonly("valueClipChunkSize", &UsdMayaJobExportArgs::valueClipChunkSize)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
         .add_property(
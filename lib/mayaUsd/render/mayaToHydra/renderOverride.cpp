@@ -375,6 +375,47 @@ SdfPath MtohRenderOverride::RendererSceneDelegateId(TfToken rendererName, TfToke
     return SdfPath();
 }
 
+size_t MtohRenderOverride::RendererSampleTransform(
+    TfToken        rendererName,
+    const SdfPath& id,
+    size_t         maxSampleCount,
+    float*         times,
+    GfMatrix4d*    samples)
+{
+    MtohRenderOverride* instance = _GetByName(rendererName);
+    if (!instance) {
+        return 0;
+    }
+
+    auto* renderIndex = instance->_renderIndex;
+    if (!renderIndex || !renderIndex->GetRprim(id)) {
+        return 0;
+    }
+    HdSceneDelegate* delegate = renderIndex->GetSceneDelegateForRprim(id);
+    if (!delegate) {
+        return 0;
+    }
+    return delegate->SampleTransform(id, maxSampleCount, times, samples);
+}
+
+SdfPathVector
+MtohRenderOverride::RendererMaterialRprims(TfToken rendererName, const SdfPath& materialId)
+{
+    MtohRenderOverride* instance = _GetByName(rendererName);
+    if (!instance) {
+        return {};
+    }
+
+    for (auto& delegate : instance->_delegates) {
+        if (HdMayaSceneDelegate* mayaScene = dynamic_cast<HdMayaSceneDelegate*>(delegate.get())) {
+            if (materialId.HasPrefix(mayaScene->GetMayaDelegateID())) {
+                return mayaScene->GetRprimsUsingMaterial(materialId);
+            }
+        }
+    }
+    return {};
+}
+
 void MtohRenderOverride::_DetectMayaDefaultLighting(const MHWRender::MDrawContext& drawContext)
 {
     constexpr auto considerAllSceneLights = MHWRender::MDrawContext::kFilteredIgnoreLightLimit;
@@ -23,6 +23,7 @@
 #include <hdMaya/delegates/delegate.h>
 #include <hdMaya/delegates/params.h>
 
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/tf/singleton.h>
 #include <pxr/imaging/hd/driver.h>
 #include <pxr/imaging/hd/engine.h>
@@ -72,6 +73,23 @@ public:
     /// Intended mostly for use in debugging and testing.
     static SdfPath RendererSceneDelegateId(TfToken rendererName, TfToken sceneDelegateName);
 
+    /// Returns the transform samples of the rprim \p id, as given to the render
+    /// delegate by the scene delegate of the rprim, and the number of samples.
+    ///
+    /// Intended mostly for use in debugging and testing.
+    static size_t RendererSampleTransform(
+        TfToken        rendererName,
+        const SdfPath& id,
+        size_t         maxSampleCount,
+        float*         times,
+        GfMatrix4d*    samples);
+
+    /// Returns the rprims that a change of the material \p materialId dirties,
+    /// for the given render delegate.
+    ///
+    /// Intended mostly for use in debugging and testing.
+    static SdfPathVector RendererMaterialRprims(TfToken rendererName, const SdfPath& materialId);
+
     MStatus Render(const MHWRender::MDrawContext& drawContext);
 
     void ClearHydraResources();
@@ -21,10 +21,16 @@
 
 #include <hdMaya/delegates/delegateRegistry.h>
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/usd/sdf/path.h>
+
 #include <maya/MArgDatabase.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MGlobal.h>
 #include <maya/MSyntax.h>
 
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 const MString MtohViewCmd::name("mtoh");
@@ -64,6 +70,15 @@ constexpr auto _visibleOnlyLong = "-visibleOnly";
 constexpr auto _sceneDelegateId = "-sid";
 constexpr auto _sceneDelegateIdLong = "-sceneDelegateId";
 
+constexpr auto _sampleTransform = "-st";
+constexpr auto _sampleTransformLong = "-sampleTransform";
+
+constexpr auto _sampleCount = "-sc";
+constexpr auto _sampleCountLong = "-sampleCount";
+
+constexpr auto _materialRprims = "-mr";
+constexpr auto _materialRprimsLong = "-materialRprims";
+
 constexpr auto _rendererId = "-r";
 constexpr auto _rendererIdLong = "-renderer";
 
@@ -104,6 +119,16 @@ Debug flags:
 -sceneDelegateId/-sid [SCENE_DELEGATE] -r [RENDERER]: Returns the path id
     corresponding to the given render delegate / scene delegate pair.
 
+-sampleTransform/-st [RPRIM] -r [RENDERER]: Returns the transform samples of the
+    given rprim as the render delegate gets them, with the time of each sample
+    followed by its 16 matrix values.
+
+-sampleCount/-sc [COUNT]: Flag which affects the behavior of -sampleTransform -
+    the maximum number of samples to return, 2 if not given.
+
+-materialRprims/-mr [MATERIAL] -r [RENDERER]: Returns the rprims which a change
+    of the given material dirties.
+
 )HELP";
 
 } // namespace
@@ -140,6 +165,12 @@ MSyntax MtohViewCmd::createSyntax()
 
     syntax.addFlag(_sceneDelegateId, _sceneDelegateIdLong, MSyntax::kString);
 
+    syntax.addFlag(_sampleTransform, _sampleTransformLong, MSyntax::kString);
+
+    syntax.addFlag(_sampleCount, _sampleCountLong, MSyntax::kUnsigned);
+
+    syntax.addFlag(_materialRprims, _materialRprimsLong, MSyntax::kString);
+
     return syntax;
 }
 
@@ -252,6 +283,59 @@ MStatus MtohViewCmd::doIt(const MArgList& args)
         SdfPath delegateId = MtohRenderOverride::RendererSceneDelegateId(
             renderDelegateName, TfToken(sceneDelegateName.asChar()));
         setResult(MString(delegateId.GetText()));
+    } else if (db.isFlagSet(_sampleTransform)) {
+        if (renderDelegateName.IsEmpty()) {
+            MGlobal::displayError(
+                MString("Must supply '") + _rendererIdLong + "' flag when using '"
+                + _sampleTransformLong + "' flag");
+            return MS::kInvalidParameter;
+        }
+
+        MString rprimId;
+        CHECK_MSTATUS_AND_RETURN_IT(db.getFlagArgument(_sampleTransform, 0, rprimId));
+        unsigned int maxSampleCount = 2;
+        if (db.isFlagSet(_sampleCount)) {
+            CHECK_MSTATUS_AND_RETURN_IT(db.getFlagArgument(_sampleCount, 0, maxSampleCount));
+        }
+
+        std::vector<float>      times(maxSampleCount);
+        std::vector<GfMatrix4d> samples(maxSampleCount);
+        const size_t            sampleCount = MtohRenderOverride::RendererSampleTransform(
+            renderDelegateName,
+            SdfPath(rprimId.asChar()),
+            maxSampleCount,
+            times.data(),
+            samples.data());
+
+        MDoubleArray result;
+        for (size_t i = 0; i < sampleCount; ++i) {
+            result.append(times[i]);
+            const double* values = samples[i].GetArray();
+            for (int j = 0; j < 16; ++j) {
+                result.append(values[j]);
+            }
+        }
+        setResult(result);
+    } else if (db.isFlagSet(_materialRprims)) {
+        if (renderDelegateName.IsEmpty()) {
+            MGlobal::displayError(
+                MString("Must supply '") + _rendererIdLong + "' flag when using '"
+                + _materialRprimsLong + "' flag");
+            return MS::kInvalidParameter;
+        }
+
+        MString materialId;
+        CHECK_MSTATUS_AND_RETURN_IT(db.getFlagArgument(_materialRprims, 0, materialId));
+
+        auto rprimPaths = MtohRenderOverride::RendererMaterialRprims(
+            renderDelegateName, SdfPath(materialId.asChar()));
+        for (auto& rprimPath : rprimPaths) {
+            appendToResult(rprimPath.GetText());
+        }
+        // Want to return an empty list, not None
+        if (!isCurrentResultArray()) {
+            setResult(MStringArray());
+        }
     }
     return MS::kSuccess;
 }
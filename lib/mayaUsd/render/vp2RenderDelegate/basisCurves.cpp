@@ -16,6 +16,7 @@
 //
 #include "basisCurves.h"
 
+#include "basisCurvesUtils.h"
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "drawItem.h"
@@ -47,339 +48,6 @@ namespace {
 const TfTokenVector sFallbackShaderPrimvars
     = { HdTokens->displayColor, HdTokens->displayOpacity, HdTokens->normals, HdTokens->widths };
 
-template <typename T>
-VtArray<T> InterpolateVarying(
-    size_t            numVerts,
-    VtIntArray const& vertexCounts,
-    TfToken           wrap,
-    TfToken           basis,
-    VtArray<T> const& authoredValues)
-{
-    VtArray<T> outputValues(numVerts);
-
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
-
-    if (wrap == HdTokens->periodic) {
-        // XXX : Add support for periodic curves
-        TF_WARN("Varying data is only supported for non-periodic curves.");
-    }
-
-    TF_FOR_ALL(itVertexCount, vertexCounts)
-    {
-        int nVerts = *itVertexCount;
-
-        // Handling for the case of potentially incorrect vertex counts
-        if (nVerts < 1) {
-            continue;
-        }
-
-        if (basis == HdTokens->catmullRom || basis == HdTokens->bSpline) {
-            // For splines with a vstep of 1, we are doing linear interpolation
-            // between segments, so all we do here is duplicate the first and
-            // last outputValues. Since these are never acutally used during
-            // drawing, it would also work just to set the to 0.
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            for (int i = 1; i < nVerts - 2; ++i) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex;
-                ++srcIndex;
-            }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-        } else if (basis == HdTokens->bezier) {
-            // For bezier splines, we map the linear values to cubic values
-            // the begin value gets mapped to the first two vertices and
-            // the end value gets mapped to the last two vertices in a segment.
-            // shaders can choose to access value[1] and value[2] when linearly
-            // interpolating a value, which happens to match up with the
-            // indexing to use for catmullRom and bSpline basis.
-            int vStep = 3;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-
-            // vstep - 1 control points will have an interpolated value
-            for (int i = 2; i < nVerts - 2; i += vStep) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex;
-                ++srcIndex;
-            }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-        } else {
-            TF_WARN("Unsupported basis: '%s'", basis.GetText());
-        }
-    }
-    TF_VERIFY(srcIndex == authoredValues.size());
-    TF_VERIFY(dstIndex == numVerts);
-
-    return outputValues;
-}
-
-VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
-{
-    /*
-    Here's a diagram of what's happening in this code:
-
-    For open (non periodic, wrap = false) curves:
-
-      bezier (vStep = 3)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-                           [======= seg1 =======]
-
-
-      bspline / catmullRom (vStep = 1)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-             [======= seg1 =======]
-                    [======= seg2 =======]
-                           [======= seg3 =======]
-
-
-    For closed (periodic, wrap = true) curves:
-
-       periodic bezier (vStep = 3)
-       0------1------2------3------4------5------0 (vertex index)
-       [======= seg0 =======]
-                            [======= seg1 =======]
-
-
-       periodic bspline / catmullRom (vStep = 1)
-       0------1------2------3------4------5------0------1------2 (vertex index)
-       [======= seg0 =======]
-              [======= seg1 =======]
-                     [======= seg2 =======]
-                            [======= seg3 =======]
-                                   [======= seg4 =======]
-                                          [======= seg5 =======]
-    */
-    std::vector<GfVec4i> indices;
-
-    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
-    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                vStep;
-    TfToken            basis = topology.GetCurveBasis();
-    if (basis == HdTokens->bezier) {
-        vStep = 3;
-    } else {
-        vStep = 1;
-    }
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int count = *itCounts;
-        // The first segment always eats up 4 verts, not just vstep, so to
-        // compensate, we break at count - 3.
-        int numSegs;
-
-        // If we're closing the curve, make sure that we have enough
-        // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for (int i = 0; i < numSegs; ++i) {
-
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int     offset = i * vStep;
-            for (int v = 0; v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
-                              : vertexIndex + std::min(offset + v, (count - 1));
-            }
-            indices.push_back(seg);
-        }
-        vertexIndex += count;
-    }
-
-    VtVec4iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec4i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
-{
-    std::vector<GfVec2i> indices;
-    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        for (int i = 0; i < *itCounts; i += 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
-{
-    const TfToken basis = topology.GetCurveBasis();
-    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
-
-    std::vector<GfVec2i> indices;
-    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
-    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                  vertexIndex = 0; // Index of next vertex to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++vertexIndex;
-        for (int i = 1; i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
-                indices.push_back(GfVec2i(v0, v1));
-            }
-            v0 = v1;
-        }
-        if (wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-template <typename BaseType>
-VtArray<BaseType> _BuildInterpolatedArray(
-    const HdBasisCurvesTopology& topology,
-    const VtArray<BaseType>&     authoredData,
-    const BaseType&              defaultValue)
-{
-    // We need to interpolate primvar depending on its type
-    size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
-
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
-
-    if (size == 1) {
-        // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
-    } else if (size == numVerts) {
-        // Vertex data
-        result = authoredData;
-    } else if (size == topology.CalculateNeededNumberOfVaryingControlPoints()) {
-        // Varying data
-        result = InterpolateVarying<BaseType>(
-            numVerts,
-            topology.GetCurveVertexCounts(),
-            topology.GetCurveWrap(),
-            topology.GetCurveBasis(),
-            authoredData);
-    } else {
-        // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
-        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
-    }
-
-    return result;
-}
 } // anonymous namespace
 
 //! \brief  Constructor
@@ -570,11 +238,11 @@ void HdVP2BasisCurves::_UpdateDrawItem(
         VtValue result;
 
         if (!forceLines && type == HdTokens->cubic) {
-            result = _BuildCubicIndexArray(topology);
+            result = VtValue(HdVP2BasisCurvesUtils::BuildCubicIndexArray(topology));
         } else if (wrap == HdTokens->segmented) {
-            result = _BuildLinesIndexArray(topology);
+            result = VtValue(HdVP2BasisCurvesUtils::BuildLinesIndexArray(topology));
         } else {
-            result = _BuildLineSegmentIndexArray(topology);
+            result = VtValue(HdVP2BasisCurvesUtils::BuildLineSegmentIndexArray(topology));
         }
 
         const void*  indexData = nullptr;
@@ -618,7 +286,8 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                 normals.push_back(defaultNormal);
             }
 
-            normals = _BuildInterpolatedArray(topology, normals, defaultNormal);
+            normals
+                = HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, normals, defaultNormal);
 
             if (!_curvesSharedData._normalsBuffer) {
                 const MHWRender::MVertexBufferDescriptor vbDesc(
@@ -655,7 +324,7 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                 widths.push_back(1.0f);
             }
 
-            widths = _BuildInterpolatedArray(topology, widths, 1.f);
+            widths = HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, widths, 1.f);
 
             MHWRender::MVertexBuffer* widthsBuffer
                 = _curvesSharedData._primvarBuffers[HdTokens->widths].get();
@@ -812,8 +481,10 @@ void HdVP2BasisCurves::_UpdateDrawItem(
             }
 
             if (prepareCPVBuffer) {
-                colorArray = _BuildInterpolatedArray(topology, colorArray, GfVec3f(1.f, 0.f, 0.f));
-                alphaArray = _BuildInterpolatedArray(topology, alphaArray, 1.f);
+                colorArray = HdVP2BasisCurvesUtils::BuildInterpolatedArray(
+                    topology, colorArray, GfVec3f(1.f, 0.f, 0.f));
+                alphaArray
+                    = HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, alphaArray, 1.f);
 
                 const size_t numColors = colorArray.size();
                 const size_t numAlphas = alphaArray.size();
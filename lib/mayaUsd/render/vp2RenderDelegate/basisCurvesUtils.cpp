@@ -0,0 +1,296 @@
+//
+// Copyright 2018 Pixar
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "basisCurvesUtils.h"
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Maps a generated vertex index through the optional topology curve indices.
+class _CurveIndexRemapper
+{
+public:
+    _CurveIndexRemapper(const VtIntArray& curveIndices)
+        : _indices(curveIndices.empty() ? nullptr : curveIndices.cdata())
+        , _maxIndex(static_cast<int>(curveIndices.size()) - 1)
+    {
+    }
+
+    int operator()(int index) const
+    {
+        return _indices ? _indices[std::min(index, _maxIndex)] : index;
+    }
+
+private:
+    const int* _indices;
+    int        _maxIndex;
+};
+
+/*! \brief  Computes exclusive prefix sums of the per-curve vertex and segment counts.
+
+    \p segmentCount returns the number of segments emitted for a curve and
+    \p vertexAdvance returns how much the running vertex index advances past it.
+*/
+template <typename SegmentCountFn, typename VertexAdvanceFn>
+void _ComputeCurveOffsets(
+    const VtIntArray&    vertexCounts,
+    SegmentCountFn       segmentCount,
+    VertexAdvanceFn      vertexAdvance,
+    std::vector<int>&    vertexOffsets,
+    std::vector<size_t>& segmentOffsets)
+{
+    const size_t numCurves = vertexCounts.size();
+    vertexOffsets.resize(numCurves + 1);
+    segmentOffsets.resize(numCurves + 1);
+
+    int    vertexIndex = 0;
+    size_t segmentIndex = 0;
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        vertexOffsets[curve] = vertexIndex;
+        segmentOffsets[curve] = segmentIndex;
+        vertexIndex += vertexAdvance(vertexCounts[curve]);
+        segmentIndex += segmentCount(vertexCounts[curve]);
+    }
+    vertexOffsets[numCurves] = vertexIndex;
+    segmentOffsets[numCurves] = segmentIndex;
+}
+
+} // anonymous namespace
+
+namespace HdVP2BasisCurvesUtils {
+
+VtVec4iArray BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
+{
+    /*
+    Here's a diagram of what's happening in this code:
+
+    For open (non periodic, wrap = false) curves:
+
+      bezier (vStep = 3)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+                           [======= seg1 =======]
+
+
+      bspline / catmullRom (vStep = 1)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+             [======= seg1 =======]
+                    [======= seg2 =======]
+                           [======= seg3 =======]
+
+
+    For closed (periodic, wrap = true) curves:
+
+       periodic bezier (vStep = 3)
+       0------1------2------3------4------5------0 (vertex index)
+       [======= seg0 =======]
+                            [======= seg1 =======]
+
+
+       periodic bspline / catmullRom (vStep = 1)
+       0------1------2------3------4------5------0------1------2 (vertex index)
+       [======= seg0 =======]
+              [======= seg1 =======]
+                     [======= seg2 =======]
+                            [======= seg3 =======]
+                                   [======= seg4 =======]
+                                          [======= seg5 =======]
+    */
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const bool        wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int         vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+
+    std::vector<int>    vertexOffsets;
+    std::vector<size_t> segmentOffsets;
+    _ComputeCurveOffsets(
+        vertexCounts,
+        [wrap, vStep](int count) -> size_t {
+            // The first segment always eats up 4 verts, not just vstep, so to
+            // compensate, we break at count - 3. If we're closing the curve,
+            // make sure that we have enough segments to wrap all the way back
+            // to the beginning.
+            const int numSegs = wrap ? count / vStep : ((count - 4) / vStep) + 1;
+            return static_cast<size_t>(std::max(numSegs, 0));
+        },
+        [](int count) { return count; },
+        vertexOffsets,
+        segmentOffsets);
+
+    VtVec4iArray              finalIndices(segmentOffsets.back());
+    GfVec4i* const            dst = finalIndices.data();
+    const _CurveIndexRemapper remap(topology.GetCurveIndices());
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertexCounts.size(), kCurvesGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t curve = range.begin(); curve < range.end(); ++curve) {
+                const int    count = vertexCounts[curve];
+                const int    vertexIndex = vertexOffsets[curve];
+                const size_t firstSeg = segmentOffsets[curve];
+                const size_t numSegs = segmentOffsets[curve + 1] - firstSeg;
+
+                for (size_t i = 0; i < numSegs; ++i) {
+                    // Set up curve segments based on curve basis
+                    const int offset = static_cast<int>(i) * vStep;
+                    GfVec4i&  seg = dst[firstSeg + i];
+                    for (int v = 0; v < 4; ++v) {
+                        // If there are not enough verts to round out the
+                        // segment just repeat the last vert.
+                        seg[v] = remap(
+                            wrap ? vertexIndex + ((offset + v) % count)
+                                 : vertexIndex + std::min(offset + v, (count - 1)));
+                    }
+                }
+            }
+        });
+
+    return finalIndices;
+}
+
+VtVec2iArray BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
+{
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+
+    // Each curve emits one line per pair of vertices; an odd trailing vertex
+    // still consumes a full pair.
+    const auto numLines
+        = [](int count) -> size_t { return count > 0 ? static_cast<size_t>(count + 1) / 2 : 0; };
+
+    std::vector<int>    vertexOffsets;
+    std::vector<size_t> segmentOffsets;
+    _ComputeCurveOffsets(
+        vertexCounts,
+        numLines,
+        [numLines](int count) { return static_cast<int>(numLines(count) * 2); },
+        vertexOffsets,
+        segmentOffsets);
+
+    VtVec2iArray              finalIndices(segmentOffsets.back());
+    GfVec2i* const            dst = finalIndices.data();
+    const _CurveIndexRemapper remap(topology.GetCurveIndices());
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertexCounts.size(), kCurvesGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t curve = range.begin(); curve < range.end(); ++curve) {
+                int vertexIndex = vertexOffsets[curve];
+                for (size_t i = segmentOffsets[curve]; i < segmentOffsets[curve + 1]; ++i) {
+                    dst[i].Set(remap(vertexIndex), remap(vertexIndex + 1));
+                    vertexIndex += 2;
+                }
+            }
+        });
+
+    return finalIndices;
+}
+
+VtVec2iArray BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
+{
+    const bool skipFirstAndLastSegs = (topology.GetCurveBasis() == HdTokens->catmullRom);
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+
+    std::vector<int>    vertexOffsets;
+    std::vector<size_t> segmentOffsets;
+    _ComputeCurveOffsets(
+        vertexCounts,
+        [skipFirstAndLastSegs, wrap](int count) -> size_t {
+            const int numSegs = skipFirstAndLastSegs ? count - 3 : count - 1;
+            return static_cast<size_t>(std::max(numSegs, 0)) + (wrap ? 1 : 0);
+        },
+        // The first vertex of a curve is always consumed.
+        [](int count) { return std::max(count, 1); },
+        vertexOffsets,
+        segmentOffsets);
+
+    VtVec2iArray              finalIndices(segmentOffsets.back());
+    GfVec2i* const            dst = finalIndices.data();
+    const _CurveIndexRemapper remap(topology.GetCurveIndices());
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertexCounts.size(), kCurvesGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t curve = range.begin(); curve < range.end(); ++curve) {
+                const int count = vertexCounts[curve];
+                // Store first vert index in case we are wrapping
+                const int firstVert = vertexOffsets[curve];
+                size_t    segIndex = segmentOffsets[curve];
+
+                const int first = skipFirstAndLastSegs ? 2 : 1;
+                const int last = skipFirstAndLastSegs ? count - 1 : count;
+                for (int i = first; i < last; ++i) {
+                    dst[segIndex++].Set(remap(firstVert + i - 1), remap(firstVert + i));
+                }
+                if (wrap) {
+                    const int lastVert = firstVert + std::max(count - 1, 0);
+                    dst[segIndex].Set(remap(lastVert), remap(firstVert));
+                }
+            }
+        });
+
+    return finalIndices;
+}
+
+bool ComputeVaryingOffsets(
+    const VtIntArray&    vertexCounts,
+    const TfToken&       basis,
+    std::vector<size_t>& dstOffsets,
+    std::vector<size_t>& srcOffsets)
+{
+    const bool isCubicSpline = (basis == HdTokens->catmullRom || basis == HdTokens->bSpline);
+    const bool isBezier = (basis == HdTokens->bezier);
+
+    const size_t numCurves = vertexCounts.size();
+    dstOffsets.resize(numCurves + 1);
+    srcOffsets.resize(numCurves + 1);
+
+    size_t dstIndex = 0;
+    size_t srcIndex = 0;
+    for (size_t curve = 0; curve < numCurves; ++curve) {
+        dstOffsets[curve] = dstIndex;
+        srcOffsets[curve] = srcIndex;
+
+        // Handling for the case of potentially incorrect vertex counts
+        const int nVerts = vertexCounts[curve];
+        if (nVerts < 1) {
+            continue;
+        }
+
+        if (isCubicSpline) {
+            // First value, one value per inner vertex, then the last value twice.
+            const size_t numInner = static_cast<size_t>(std::max(nVerts - 3, 0));
+            dstIndex += numInner + 3;
+            srcIndex += numInner + 1;
+        } else if (isBezier) {
+            // Two values per end point and three per interpolated control point.
+            const size_t numInner = nVerts >= 5 ? static_cast<size_t>((nVerts - 5) / 3 + 1) : 0;
+            dstIndex += 3 * numInner + 4;
+            srcIndex += numInner + 2;
+        }
+    }
+    dstOffsets[numCurves] = dstIndex;
+    srcOffsets[numCurves] = srcIndex;
+
+    return isCubicSpline || isBezier;
+}
+
+} // namespace HdVP2BasisCurvesUtils
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,193 @@
+//
+// Copyright 2018 Pixar
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HDVP2_BASIS_CURVES_UTILS_H
+#define HDVP2_BASIS_CURVES_UTILS_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/vec2i.h>
+#include <pxr/base/gf/vec4i.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/pxr.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <cstddef>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Index and primvar builders used by HdVP2BasisCurves.
+
+    Every builder first computes per-curve output offsets with a prefix sum
+    over the curve vertex counts, then fills the output in parallel chunks of
+    curves. The outputs are identical to a sequential per-curve walk.
+*/
+namespace HdVP2BasisCurvesUtils {
+
+//! Number of curves processed by a single task when filling outputs in parallel.
+constexpr size_t kCurvesGrainSize = 1024;
+
+//! Builds the cubic patch index buffer (4 indices per segment).
+MAYAUSD_CORE_PUBLIC
+VtVec4iArray BuildCubicIndexArray(const HdBasisCurvesTopology& topology);
+
+//! Builds the line index buffer of segmented curves (2 indices per line).
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray BuildLinesIndexArray(const HdBasisCurvesTopology& topology);
+
+//! Builds the line-strip index buffer used for wireframe and linear curves.
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology);
+
+/*! \brief  Computes per-curve offsets for varying primvar interpolation.
+
+    On return, \p dstOffsets and \p srcOffsets hold numCurves + 1 entries: the
+    first output vertex and the first authored value of each curve, the last
+    entry being the totals. Returns false if the basis is not supported.
+*/
+MAYAUSD_CORE_PUBLIC
+bool ComputeVaryingOffsets(
+    const VtIntArray&    vertexCounts,
+    const TfToken&       basis,
+    std::vector<size_t>& dstOffsets,
+    std::vector<size_t>& srcOffsets);
+
+//! Expands varying primvar data to one value per control vertex.
+template <typename T>
+VtArray<T> InterpolateVarying(
+    size_t            numVerts,
+    VtIntArray const& vertexCounts,
+    TfToken           wrap,
+    TfToken           basis,
+    VtArray<T> const& authoredValues)
+{
+    VtArray<T> outputValues(numVerts);
+
+    if (wrap == HdTokens->periodic) {
+        // XXX : Add support for periodic curves
+        TF_WARN("Varying data is only supported for non-periodic curves.");
+    }
+
+    std::vector<size_t> dstOffsets;
+    std::vector<size_t> srcOffsets;
+    if (!ComputeVaryingOffsets(vertexCounts, basis, dstOffsets, srcOffsets)) {
+        TF_WARN("Unsupported basis: '%s'", basis.GetText());
+    }
+
+    // Never write out of range when the topology and the data disagree.
+    if (!TF_VERIFY(srcOffsets.back() == authoredValues.size())
+        || !TF_VERIFY(dstOffsets.back() == numVerts)) {
+        return outputValues;
+    }
+
+    const bool isBezier = (basis == HdTokens->bezier);
+    const T*   src = authoredValues.cdata();
+    T*         dst = outputValues.data();
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertexCounts.size(), kCurvesGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t curve = range.begin(); curve < range.end(); ++curve) {
+                const int nVerts = vertexCounts[curve];
+                if (nVerts < 1 || dstOffsets[curve] == dstOffsets[curve + 1]) {
+                    continue;
+                }
+
+                size_t srcIndex = srcOffsets[curve];
+                size_t dstIndex = dstOffsets[curve];
+
+                if (!isBezier) {
+                    // For splines with a vstep of 1, we are doing linear
+                    // interpolation between segments, so all we do here is
+                    // duplicate the first and last values.
+                    dst[dstIndex++] = src[srcIndex];
+                    for (int i = 1; i < nVerts - 2; ++i) {
+                        dst[dstIndex++] = src[srcIndex++];
+                    }
+                    dst[dstIndex++] = src[srcIndex];
+                    dst[dstIndex] = src[srcIndex];
+                } else {
+                    // For bezier splines, we map the linear values to cubic
+                    // values: the begin value gets mapped to the first two
+                    // vertices and the end value gets mapped to the last two
+                    // vertices in a segment.
+                    const int vStep = 3;
+                    dst[dstIndex++] = src[srcIndex];
+                    dst[dstIndex++] = src[srcIndex++];
+
+                    // vstep - 1 control points will have an interpolated value
+                    for (int i = 2; i < nVerts - 2; i += vStep) {
+                        dst[dstIndex++] = src[srcIndex];
+                        dst[dstIndex++] = src[srcIndex];
+                        dst[dstIndex++] = src[srcIndex++];
+                    }
+                    dst[dstIndex++] = src[srcIndex];
+                    dst[dstIndex] = src[srcIndex];
+                }
+            }
+        });
+
+    return outputValues;
+}
+
+//! Expands constant, uniform or varying primvar data to one value per control vertex.
+template <typename BaseType>
+VtArray<BaseType> BuildInterpolatedArray(
+    const HdBasisCurvesTopology& topology,
+    const VtArray<BaseType>&     authoredData,
+    const BaseType&              defaultValue)
+{
+    // We need to interpolate primvar depending on its type
+    const size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
+    const size_t size = authoredData.size();
+
+    VtArray<BaseType> result;
+    if (size == 1) {
+        // Uniform data
+        result.assign(numVerts, authoredData[0]);
+    } else if (size == numVerts) {
+        // Vertex data
+        result = authoredData;
+    } else if (size == topology.CalculateNeededNumberOfVaryingControlPoints()) {
+        // Varying data
+        result = InterpolateVarying<BaseType>(
+            numVerts,
+            topology.GetCurveVertexCounts(),
+            topology.GetCurveWrap(),
+            topology.GetCurveBasis(),
+            authoredData);
+    } else {
+        // Fallback
+        result.assign(numVerts, defaultValue);
+        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+    }
+
+    return result;
+}
+
+} // namespace HdVP2BasisCurvesUtils
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HDVP2_BASIS_CURVES_UTILS_H
@@ -375,8 +375,14 @@ void HdVP2Mesh::_InitGPUCompute()
     MRenderer* renderer = MRenderer::theRenderer();
     // would also be nice to check the openGL version but renderer->drawAPIVersion() returns 4.
     // Compute was added in 4.3 so I don't have enough information to make the check
-    if (renderer && renderer->drawAPIIsOpenGL()
-        && (TfGetenvInt("HDVP2_USE_GPU_NORMAL_COMPUTATION", 0) > 0)) {
+    const bool useGPU = renderer && renderer->drawAPIIsOpenGL()
+        && (TfGetenvInt("HDVP2_USE_GPU_NORMAL_COMPUTATION", 0) > 0);
+    // The CPU backend of the viewport compute doesn't need any particular draw API.
+    const bool useCPU = TfGetenvInt("HDVP2_USE_CPU_VIEWPORT_COMPUTE", 0) > 0;
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
+    MeshViewportCompute::setUseCPU(useCPU);
+#endif
+    if (useGPU || useCPU) {
         int threshold = TfGetenvInt("HDVP2_GPU_NORMAL_COMPUTATION_MINIMUM_THRESHOLD", 8000);
         _gpuNormalsComputeThreshold = threshold >= 0 ? (size_t)threshold : SIZE_MAX;
     } else
@@ -1061,9 +1067,9 @@ void HdVP2Mesh::Sync(
             = _gpuNormalsEnabled && _meshSharedData->_numVertices >= _gpuNormalsComputeThreshold;
         if (_gpuNormalsEnabled) {
             _CreateViewportCompute();
-#ifdef HDVP2_ENABLE_GPU_OSD
-            _CreateOSDTables();
-#endif
+            if (MeshViewportCompute::requiresOSD(_meshSharedData->_renderingTopology)) {
+                _CreateOSDTables();
+            }
         }
 #else
         _gpuNormalsEnabled = false;
@@ -1657,10 +1663,13 @@ void HdVP2Mesh::_UpdateDrawItem(
     const bool isPointSnappingItem = (renderItem->primitive() == MHWRender::MGeometry::kPoints);
 #endif
 
-#ifdef HDVP2_ENABLE_GPU_OSD
+#ifdef HDVP2_ENABLE_GPU_COMPUTE
     const bool isLineItem = (renderItem->primitive() == MHWRender::MGeometry::kLines);
     // when we do OSD we don't bother creating indexing until after we have a smooth mesh
-    const bool requiresIndexUpdate = !isBBoxItem && !isPointSnappingItem && isLineItem;
+    const bool requiresOSD = _gpuNormalsEnabled
+        && MeshViewportCompute::requiresOSD(_meshSharedData->_renderingTopology);
+    const bool requiresIndexUpdate
+        = !isBBoxItem && !isPointSnappingItem && (!requiresOSD || isLineItem);
 #else
     const bool requiresIndexUpdate = !isBBoxItem && !isPointSnappingItem;
 #endif
@@ -2452,121 +2461,21 @@ void HdVP2Mesh::_CreateViewportCompute()
             = MSharedPtr<MeshViewportCompute>::make<>(_meshSharedData);
     }
 }
-#endif
 
-#ifdef HDVP2_ENABLE_GPU_OSD
+/*! \brief  Get the OpenSubdiv tables of the rendering topology for later GPGPU evaluation
+
+    The tables come from a cache shared by all the meshes, so meshes and instances with the
+    same topology only refine it once. Doing it here builds the tables during the parallel
+    sync rather than when the compute executes.
+*/
 void HdVP2Mesh::_CreateOSDTables()
 {
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
-
     assert(_meshSharedData->_viewportCompute);
     MProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "createOSDTables");
 
-    // create topology refiner
-    PxOsdTopologyRefinerSharedPtr refiner;
-
-    OpenSubdiv::Far::StencilTable const* vertexStencils = nullptr;
-    OpenSubdiv::Far::StencilTable const* varyingStencils = nullptr;
-    OpenSubdiv::Far::PatchTable const*   patchTable = nullptr;
-
-    HdMeshTopology* topology
-        = &_meshSharedData->_renderingTopology; // TODO: something with _topology?
-
-    // for empty topology, we don't need to refine anything.
-    // but still need to return the typed buffer for codegen
-    if (topology->GetFaceVertexCounts().size() == 0) {
-        // leave refiner empty
-    } else {
-        refiner = PxOsdRefinerFactory::Create(
-            topology->GetPxOsdMeshTopology(), TfToken(_meshSharedData->_renderTag.GetText()));
-    }
-
-    if (refiner) {
-        OpenSubdiv::Far::PatchTableFactory::Options patchOptions(
-            _meshSharedData->_viewportCompute->level);
-        if (_meshSharedData->_viewportCompute->adaptive) {
-            patchOptions.endCapType
-                = OpenSubdiv::Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
-#if OPENSUBDIV_VERSION_NUMBER >= 30400
-            // Improve fidelity when refining to limit surface patches
-            // These options supported since v3.1.0 and v3.2.0 respectively.
-            patchOptions.useInfSharpPatch = true;
-            patchOptions.generateLegacySharpCornerPatches = false;
-#endif
-        }
-
-        // split trace scopes.
-        {
-            MProfilingScope subProfilingScope(
-                HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "refine");
-            if (_meshSharedData->_viewportCompute->adaptive) {
-                OpenSubdiv::Far::TopologyRefiner::AdaptiveOptions adaptiveOptions(
-                    _meshSharedData->_viewportCompute->level);
-#if OPENSUBDIV_VERSION_NUMBER >= 30400
-                adaptiveOptions = patchOptions.GetRefineAdaptiveOptions();
-#endif
-                refiner->RefineAdaptive(adaptiveOptions);
-            } else {
-                refiner->RefineUniform(_meshSharedData->_viewportCompute->level);
-            }
-        }
-#define GENERATE_SOURCE_TABLES
-#ifdef GENERATE_SOURCE_TABLES
-        {
-            MProfilingScope subProfilingScope(
-                HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "stencilFactory");
-            OpenSubdiv::Far::StencilTableFactory::Options options;
-            options.generateOffsets = true;
-            options.generateIntermediateLevels = _meshSharedData->_viewportCompute->adaptive;
-            options.interpolationMode = OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VERTEX;
-            vertexStencils = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
-
-            options.interpolationMode = OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VARYING;
-            varyingStencils = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
-        }
-        {
-            MProfilingScope subProfilingScope(
-                HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "patchFactory");
-            patchTable = OpenSubdiv::Far::PatchTableFactory::Create(*refiner, patchOptions);
-        }
-#else
-        // grab the values we need from the refiner.
-        const OpenSubdiv::Far::TopologyLevel& refinedLevel
-            = refiner->GetLevel(refiner->GetMaxLevel());
-        size_t indexLength = refinedLevel.GetNumFaces()
-            * 4; // i know it is quads but not always? can we do this more safely?
-        size_t vertexLength = GetNumVerticesTotal();
-        // save these values and use them to create the updated geometry index mapping.
-#endif
-    }
-#ifdef GENERATE_SOURCE_TABLES
-    // merge endcap
-    if (patchTable && patchTable->GetLocalPointStencilTable()) {
-        // append stencils
-        if (OpenSubdiv::Far::StencilTable const* vertexStencilsWithLocalPoints
-            = OpenSubdiv::Far::StencilTableFactory::AppendLocalPointStencilTable(
-                *refiner, vertexStencils, patchTable->GetLocalPointStencilTable())) {
-            delete vertexStencils;
-            vertexStencils = vertexStencilsWithLocalPoints;
-        }
-        if (OpenSubdiv::Far::StencilTable const* varyingStencilsWithLocalPoints
-            = OpenSubdiv::Far::StencilTableFactory::AppendLocalPointStencilTable(
-                *refiner, varyingStencils, patchTable->GetLocalPointStencilTable())) {
-            delete varyingStencils;
-            varyingStencils = varyingStencilsWithLocalPoints;
-        }
-    }
-
-    // save values for the next loop
-    _meshSharedData->_viewportCompute->vertexStencils.reset(vertexStencils);
-    _meshSharedData->_viewportCompute->varyingStencils.reset(varyingStencils);
-    _meshSharedData->_viewportCompute->patchTable.reset(patchTable);
-#endif
-
-    // if there is a sourceMeshSharedData it should have entries for every vertex in that geometry
-    // source.
-
+    _meshSharedData->_viewportCompute->updateOsdTables();
 #endif
 }
 #endif
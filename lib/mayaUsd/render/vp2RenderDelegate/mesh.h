@@ -137,8 +137,6 @@ private:
 
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
     void _CreateViewportCompute();
-#endif
-#ifdef HDVP2_ENABLE_GPU_OSD
     void _CreateOSDTables();
 #endif
 
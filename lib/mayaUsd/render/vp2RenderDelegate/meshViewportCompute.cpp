@@ -87,6 +87,29 @@ template <typename F> void EnqueueLambdaTask(const F& f)
 
 std::once_flag      MeshViewportCompute::_compileProgramOnce;
 PxrMayaGLSLProgram* MeshViewportCompute::_computeNormalsProgram;
+bool                MeshViewportCompute::_useCPU = false;
+
+bool MeshViewportCompute::osdEnabled()
+{
+#if defined(DO_OPENGL_OSD)
+    return true;
+#elif defined(DO_CPU_OSD)
+    return _useCPU;
+#else
+    return false;
+#endif
+}
+
+bool MeshViewportCompute::requiresOSD(const HdMeshTopology& topology)
+{
+    // Like HdSt, only refine the subdivision meshes with a refine level. Adaptive refinement isn't
+    // supported, so the Catmull-Clark patches are always quads.
+    if (!osdEnabled() || topology.GetRefineLevel() <= 0) {
+        return false;
+    }
+    const TfToken& scheme = topology.GetScheme();
+    return scheme == PxOsdOpenSubdivTokens->catmullClark || scheme == PxOsdOpenSubdivTokens->loop;
+}
 
 void MeshViewportCompute::openGLErrorCheck()
 {
@@ -158,12 +181,7 @@ void MeshViewportCompute::reset()
     _adjacencyBufferGPUDirty = true;
     _normalVertexBufferGPUDirty = true;
 
-#if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
-    // OSD information
-    _vertexStencils.reset();
-    _varyingStencils.reset();
-    _patchTable.reset();
-#endif
+    // Keep the OSD tables, they are only rebuilt when the topology they were built for changes.
 }
 
 bool MeshViewportCompute::hasExecuted() const { return _executed; }
@@ -397,9 +415,37 @@ void MeshViewportCompute::findRenderGeometry(MRenderItem& renderItem)
     _renderGeom = renderGeometry;
 }
 
+#if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
+void MeshViewportCompute::updateOsdTables()
+{
+    // The tables only depend on the topology, so they are reused until the topology changes,
+    // and shared with the other meshes and instances with the same topology.
+    const HdMeshTopology& topology = _meshSharedData->_renderingTopology;
+    if (!requiresOSD(topology)) {
+        _osdTables.reset();
+        return;
+    }
+    _level = topology.GetRefineLevel();
+    if (_osdTables && _osdTables->matches(topology.ComputeHash(), _level, _adaptive)) {
+        return;
+    }
+
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:findOrCreateOsdTables");
+
+    _osdTables = MeshViewportComputeCPU::findOrCreateOsdTables(
+        topology, TfToken(_meshSharedData->_renderTag.GetText()), _level, _adaptive);
+}
+#endif
+
 void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
 {
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
+    if (!requiresOSD(_meshSharedData->_renderingTopology)) {
+        return;
+    }
 
     MProfilingScope subProfilingScope(
         HdVP2RenderDelegate::sProfilerCategory,
@@ -409,115 +455,9 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
     // refine
     //  and
     // create stencil/patch table
-    {
-        OpenSubdiv::Far::StencilTable const* consolidatedVertexStencils = nullptr;
-        OpenSubdiv::Far::StencilTable const* consolidatedVaryingStencils = nullptr;
-        OpenSubdiv::Far::PatchTable const*   consolidatedPatchTable = nullptr;
-
-        // if this is a consolidated item then we won't have any stencils or tables.
-        // If this is an unconsolidated item then we'll already have the tables we need.
-        if (!_vertexStencils || !_varyingStencils || !_patchTable) {
-            MProfilingScope subsubProfilingScope(
-                HdVP2RenderDelegate::sProfilerCategory,
-                MProfiler::kColorD_L2,
-                "MeshViewportCompute:createConsolidatedMeshTables");
-
-            // create topology refiner
-            PxOsdTopologyRefinerSharedPtr refiner;
-            // for empty topology, we don't need to refine anything.
-            // but still need to return the typed buffer for codegen
-            if (_meshSharedData->_renderingTopology.GetFaceVertexCounts().size() == 0) {
-                // leave refiner empty
-            } else {
-                refiner = PxOsdRefinerFactory::Create(
-                    _meshSharedData->_renderingTopology.GetPxOsdMeshTopology(),
-                    TfToken(_meshSharedData->_renderTag.GetText()));
-            }
-
-            if (refiner) {
-                OpenSubdiv::Far::PatchTableFactory::Options patchOptions(_level);
-                if (_adaptive) {
-                    patchOptions.endCapType
-                        = OpenSubdiv::Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
-#if OPENSUBDIV_VERSION_NUMBER >= 30400
-                    // Improve fidelity when refining to limit surface patches
-                    // These options supported since v3.1.0 and v3.2.0 respectively.
-                    patchOptions.useInfSharpPatch = true;
-                    patchOptions.generateLegacySharpCornerPatches = false;
-#endif
-                }
-
-                // split trace scopes.
-                {
-                    MProfilingScope subsubsubProfilingScope(
-                        HdVP2RenderDelegate::sProfilerCategory,
-                        MProfiler::kColorD_L2,
-                        "MeshViewportCompute:refine");
-                    if (_adaptive) {
-                        OpenSubdiv::Far::TopologyRefiner::AdaptiveOptions adaptiveOptions(_level);
-#if OPENSUBDIV_VERSION_NUMBER >= 30400
-                        adaptiveOptions = patchOptions.GetRefineAdaptiveOptions();
-#endif
-                        refiner->RefineAdaptive(adaptiveOptions);
-                    } else {
-                        refiner->RefineUniform(_level);
-                    }
-                }
-                {
-                    MProfilingScope subsubsubProfilingScope(
-                        HdVP2RenderDelegate::sProfilerCategory,
-                        MProfiler::kColorD_L2,
-                        "MeshViewportCompute:stencilFactory");
-                    OpenSubdiv::Far::StencilTableFactory::Options options;
-                    options.generateOffsets = true;
-                    options.generateIntermediateLevels = _adaptive;
-                    options.interpolationMode
-                        = OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VERTEX;
-                    consolidatedVertexStencils
-                        = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
-
-                    options.interpolationMode
-                        = OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VARYING;
-                    consolidatedVaryingStencils
-                        = OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
-                }
-                {
-                    MProfilingScope subsubsubProfilingScope(
-                        HdVP2RenderDelegate::sProfilerCategory,
-                        MProfiler::kColorD_L2,
-                        "MeshViewportCompute:patchFactory");
-                    consolidatedPatchTable
-                        = OpenSubdiv::Far::PatchTableFactory::Create(*refiner, patchOptions);
-                }
-            }
-
-            // merge endcap
-            if (consolidatedPatchTable && consolidatedPatchTable->GetLocalPointStencilTable()) {
-                // append stencils
-                if (OpenSubdiv::Far::StencilTable const* vertexStencilsWithLocalPoints
-                    = OpenSubdiv::Far::StencilTableFactory::AppendLocalPointStencilTable(
-                        *refiner,
-                        consolidatedVertexStencils,
-                        consolidatedPatchTable->GetLocalPointStencilTable())) {
-                    delete consolidatedVertexStencils;
-                    consolidatedVertexStencils = vertexStencilsWithLocalPoints;
-                }
-                if (OpenSubdiv::Far::StencilTable const* varyingStencilsWithLocalPoints
-                    = OpenSubdiv::Far::StencilTableFactory::AppendLocalPointStencilTable(
-                        *refiner,
-                        consolidatedVaryingStencils,
-                        consolidatedPatchTable->GetLocalPointStencilTable())) {
-                    delete consolidatedVaryingStencils;
-                    consolidatedVaryingStencils = varyingStencilsWithLocalPoints;
-                }
-            }
-
-            // save tables to topology
-            _vertexStencils.reset(consolidatedVertexStencils);
-            _varyingStencils.reset(consolidatedVaryingStencils);
-            _patchTable.reset(consolidatedPatchTable);
-        }
-    }
+    //
+    // If this is a consolidated item the tables are built for the consolidated topology.
+    updateOsdTables();
 
     if (_geometryIndexMapping && _geometryIndexMapping->geometryCount() > 0) {
         MProfilingScope subsubProfilingScope(
@@ -536,13 +476,13 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
             MSharedPtr<MeshViewportCompute> sourceViewportComputeItem
                 = MSharedPtr<MeshViewportCompute>::dynamic_pointer_cast<>(
                     sourceItem->viewportComputeItem());
-            size_t sourcePtableSize
-                = sourceViewportComputeItem->_patchTable->GetPatchControlVerticesTable().size();
+            const HdVP2OsdTables& sourceOsdTables = *sourceViewportComputeItem->_osdTables;
+            size_t                sourcePtableSize
+                = sourceOsdTables.patchTable->GetPatchControlVerticesTable().size();
             size_t sourceBaseVertexCount
                 = sourceViewportComputeItem->_meshSharedData->_renderingTopology
                       .GetNumPoints(); // _geometryIndexMapping->vertexLength(i);
-            size_t sourceSmoothVertexCount
-                = sourceViewportComputeItem->_vertexStencils->GetNumStencils();
+            size_t sourceSmoothVertexCount = sourceOsdTables.vertexStencils->GetNumStencils();
             _geometryIndexMapping->updateSource(
                 i,
                 indexStart,
@@ -567,12 +507,14 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
     // PxOsdOpenSubdivTokens->catmullClark + _adaptive -> BSplinePatches
     // PxOsdOpenSubdivTokens->catmullClark + !_adaptive -> quads
     // HdSt draws with tessellation shaders and we do have that? try calling
+    OpenSubdiv::Far::PatchTable const* patchTable
+        = _osdTables ? _osdTables->patchTable.get() : nullptr;
     OpenSubdiv::Far::Index const* firstIndex = nullptr;
     size_t                        ptableSize = 0;
-    if (_patchTable) {
-        ptableSize = _patchTable->GetPatchControlVerticesTable().size();
+    if (patchTable) {
+        ptableSize = patchTable->GetPatchControlVerticesTable().size();
         if (ptableSize > 0)
-            firstIndex = &_patchTable->GetPatchControlVerticesTable()[0];
+            firstIndex = &patchTable->GetPatchControlVerticesTable()[0];
     }
 
     int indexLength = 0;
@@ -581,7 +523,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
         && _meshSharedData->_renderingTopology.GetScheme() == PxOsdOpenSubdivTokens->catmullClark) {
         // _patchTable is quads. Convert to triangles and make an index buffer we can draw
         int patchSize
-            = _patchTable ? _patchTable->GetPatchArrayDescriptor(0).GetNumControlVertices() : 0;
+            = patchTable ? patchTable->GetPatchArrayDescriptor(0).GetNumControlVertices() : 0;
         TF_VERIFY(patchSize == 4);
         VtArray<int> indices(ptableSize);
         memcpy(indices.data(), firstIndex, ptableSize * sizeof(int));
@@ -616,7 +558,7 @@ void MeshViewportCompute::createConsolidatedOSDTables(MRenderItem& renderItem)
         }
     } else if (_meshSharedData->_renderingTopology.GetScheme() == PxOsdOpenSubdivTokens->loop) {
         int patchSize
-            = _patchTable ? _patchTable->GetPatchArrayDescriptor(0).GetNumControlVertices() : 0;
+            = patchTable ? patchTable->GetPatchArrayDescriptor(0).GetNumControlVertices() : 0;
         TF_VERIFY(patchSize == 3);
         MIndexBuffer* indexBuffer = _renderGeom->indexBuffer(0);
         void*         indexData = indexBuffer->acquire(ptableSize, true);
@@ -1096,11 +1038,48 @@ void MeshViewportCompute::computeNormals()
 
     // clFinish(MOpenCLInfo::getMayaDefaultOpenCLCommandQueue());
 
-#elif defined(DO_CPU_NORMALS)
-
 #endif
 }
 
+void MeshViewportCompute::computeNormalsCPU()
+{
+    if (!_normalVertexBufferGPUDirty)
+        return;
+    _normalVertexBufferGPUDirty = false;
+
+    MProfilingScope subProfilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "MeshViewportCompute:computeNormalsCPU");
+
+    // The rendering topology can split scene vertices, in which case positions and normals are
+    // in rendering vertex order and the adjacency is in scene vertex order.
+    const VtIntArray&       renderingToScene = _meshSharedData->_renderingToSceneFaceVtxIds;
+    const std::vector<int>& sceneToRendering = _meshSharedData->_sceneToRenderingFaceVtxIds;
+    const bool              hasRemapping = !renderingToScene.empty();
+    if (hasRemapping && !TF_VERIFY(renderingToScene.size() >= _vertexCount)) {
+        return;
+    }
+
+    const float* positions = static_cast<const float*>(_positionVertexBufferGPU->map());
+    void*        normalsBufferData = _normalVertexBufferGPU->acquire(_vertexCount, true);
+    if (positions && normalsBufferData) {
+        MeshViewportComputeCPU::computeSmoothNormals(
+            _adjacencyBufferCPU.get(),
+            _adjacencyBufferSize,
+            _vertexCount,
+            positions,
+            static_cast<float*>(normalsBufferData),
+            hasRemapping ? renderingToScene.cdata() : nullptr,
+            hasRemapping ? sceneToRendering.data() : nullptr);
+    }
+    _positionVertexBufferGPU->unmap();
+
+    if (normalsBufferData) {
+        _normalVertexBufferGPU->commit(normalsBufferData);
+    }
+}
+
 void MeshViewportCompute::computeOSD()
 {
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
@@ -1108,64 +1087,38 @@ void MeshViewportCompute::computeOSD()
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "MeshViewportCompute:doOSD");
     // Inspired by HdSt_Osd3TopologyComputation::Resolve()
 
-    // refine
-    //  and
-    // create stencil/patch table
-    OpenSubdiv::Far::StencilTable const* consolidatedVertexStencils = _vertexStencils.get();
-    OpenSubdiv::Far::StencilTable const* consolidatedVaryingStencils = _varyingStencils.get();
-    OpenSubdiv::Far::PatchTable const*   consolidatedPatchTable = _patchTable.get();
+    if (!requiresOSD(_meshSharedData->_renderingTopology) || !_osdTables
+        || !_osdTables->vertexStencils) {
+        return;
+    }
+    OpenSubdiv::Far::StencilTable const* consolidatedVertexStencils
+        = _osdTables->vertexStencils.get();
 #endif
 #if defined(DO_CPU_OSD)
-
-    class OsdCPUBuffer
-    {
-    public:
-        OsdCPUBuffer(float* buffer)
-            : _buffer(buffer)
-        {
+    if (_useCPU) {
+        // Smooth every vertex buffer. The refined vertices are written after the base vertices,
+        // so each buffer must first grow to hold them.
+        for (MVertexBuffer* vertexBuffer :
+             { _positionVertexBufferGPU, _normalVertexBufferGPU, _colorVertexBufferGPU }) {
+            if (!vertexBuffer) {
+                continue;
+            }
+            const int dimension = vertexBuffer->descriptor().dimension();
+            void*     bufferData = vertexBuffer->acquire(
+                _vertexCount + consolidatedVertexStencils->GetNumStencils(), false);
+            if (bufferData) {
+                MeshViewportComputeCPU::evalStencils(
+                    *consolidatedVertexStencils,
+                    static_cast<float*>(bufferData),
+                    dimension,
+                    _vertexCount);
+                vertexBuffer->commit(bufferData);
+            }
         }
-
-        float* BindCpuBuffer() { return _buffer; }
-
-    private:
-        float* _buffer { nullptr };
-    };
-
-    // smooth the normals
-    const MVertexBufferDescriptor& normalsDescriptor = _normalVertexBufferGPU->descriptor();
-    int                            dimension = normalsDescriptor.dimension();
-    void*                          normalsBufferData = _normalVertexBufferGPU->acquire(
-        _vertexCount + consolidatedVertexStencils->GetNumStencils(), false);
-    OpenSubdiv::Osd::BufferDescriptor normalSrcDesc(0, dimension, dimension);
-    OpenSubdiv::Osd::BufferDescriptor normalDstDesc(_vertexCount * dimension, dimension, dimension);
-    OsdCPUBuffer                      osdNormalVertexBuffer((float*)normalsBufferData);
-    OpenSubdiv::Osd::CpuEvaluator::
-        EvalStencils<OsdCPUBuffer, OsdCPUBuffer, OpenSubdiv::Far::StencilTable>(
-            &osdNormalVertexBuffer,
-            normalSrcDesc,
-            &osdNormalVertexBuffer,
-            normalDstDesc,
-            consolidatedVertexStencils);
-    _normalVertexBufferGPU->commit(normalsBufferData);
-
-    // smooth the positions
-    const MVertexBufferDescriptor& positionsDescriptor = _positionVertexBufferGPU->descriptor();
-    dimension = positionsDescriptor.dimension();
-    void* positionsBufferData = _positionVertexBufferGPU->acquire(
-        _vertexCount + consolidatedVertexStencils->GetNumStencils(), false);
-    OpenSubdiv::Osd::BufferDescriptor positionSrcDesc(0, dimension, dimension);
-    OpenSubdiv::Osd::BufferDescriptor positionDstDesc(
-        _vertexCount * dimension, dimension, dimension);
-    OsdCPUBuffer osdPositionVertexBuffer((float*)positionsBufferData);
-    OpenSubdiv::Osd::CpuEvaluator::
-        EvalStencils<OsdCPUBuffer, OsdCPUBuffer, OpenSubdiv::Far::StencilTable>(
-            &osdPositionVertexBuffer,
-            positionSrcDesc,
-            &osdPositionVertexBuffer,
-            positionDstDesc,
-            consolidatedVertexStencils);
-    _positionVertexBufferGPU->commit(positionsBufferData);
-#elif defined(DO_OPENGL_OSD)
+        return;
+    }
+#endif
+#if defined(DO_OPENGL_OSD)
 
     class OsdGLBuffer
     {
@@ -1302,22 +1255,26 @@ bool MeshViewportCompute::execute(
 
     findRenderGeometry(renderItem);
 
-    createConsolidatedOSDTables(renderItem); // disabled by preprocessor macros
+    createConsolidatedOSDTables(renderItem); // only for the meshes which require OSD
 
     findVertexBuffers(renderItem);
 
-    prepareAdjacencyBuffer();
+    if (_useCPU) {
+        computeNormalsCPU();
+    } else {
+        prepareAdjacencyBuffer();
 
-    if (!hasOpenGL()) {
-        initializeOpenGL();
-    }
-    TF_VERIFY(hasOpenGL());
+        if (!hasOpenGL()) {
+            initializeOpenGL();
+        }
+        TF_VERIFY(hasOpenGL());
 
-    prepareUniformBufferForNormals();
+        prepareUniformBufferForNormals();
 
-    computeNormals();
+        computeNormals();
+    }
 
-    computeOSD(); // disabled by preprocessor macros
+    computeOSD(); // only for the meshes which require OSD
 
     setClean();
 
@@ -38,6 +38,14 @@
      * selection in the viewport is very slow
      * toggling VP2 consolidation world off and on will cause crashes
      * some objects draw with incorrect indexing
+
+    CPU Compute Backend
+
+    Setting HDVP2_USE_CPU_VIEWPORT_COMPUTE=1 at runtime runs the same computations on the CPU
+    with TBB instead of OpenGL compute kernels (see meshViewportComputeCPU.h). It doesn't need
+    an OpenGL device, so it also works with other draw APIs and on headless machines. The CPU
+    backend also refines the subdivision meshes with a refine level above 0 with OSD, without
+    having to compile with HDVP2_ENABLE_GPU_OSD.
 */
 
 // Maya 2020 is missing API necessary for compute support
@@ -53,18 +61,16 @@
 //#define HDVP2_ENABLE_GPU_OSD
 #ifdef HDVP2_ENABLE_GPU_OSD
 #define DO_OPENGL_OSD
-//#define DO_CPU_OSD
 #endif
+// The CPU OSD evaluation is selected at runtime, see MeshViewportCompute::setUseCPU().
+#define DO_CPU_OSD
 
 #include <pxr/imaging/hd/mesh.h>
 
 #include <maya/MHWGeometry.h>
 #include <maya/MSharedPtr.h>
 
-#ifdef HDVP2_ENABLE_GPU_OSD
-#include <opensubdiv/far/_patchTable.h>
-#include <opensubdiv/far/stencilTable.h>
-#endif
+#include "meshViewportComputeCPU.h"
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
@@ -187,14 +193,14 @@ private:
     bool _normalVertexBufferGPUDirty { true }; //_normalVertexBufferGPU is dirty
 
 #if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
-    // OSD information
-    std::unique_ptr<OpenSubdiv::Far::StencilTable const> _vertexStencils;
-    std::unique_ptr<OpenSubdiv::Far::StencilTable const> _varyingStencils;
-    std::unique_ptr<OpenSubdiv::Far::PatchTable const>   _patchTable;
-    bool                                                 _adaptive { false };
-    int                                                  _level { 1 };
+    // OSD information. The tables are kept as long as the topology doesn't change.
+    HdVP2OsdTablesSharedPtr _osdTables;
+    bool                    _adaptive { false };
+    int                     _level { 1 };
 #endif
 
+    static bool _useCPU; // Run the computations with the CPU backend instead of OpenGL
+
 #if defined(HDVP2_OPENGL_NORMALS)
     static std::once_flag      _compileProgramOnce;
     static PxrMayaGLSLProgram* _computeNormalsProgram;
@@ -229,6 +235,7 @@ private:
     void        prepareUniformBufferForNormals();
     static void compileNormalsProgram();
     void        computeNormals();
+    void        computeNormalsCPU();
     void        computeOSD();
     void        setClean();
 
@@ -240,10 +247,10 @@ public:
         setRequiredAction(MPxViewportComputeItem::kAccessVirtualDevice, true);
         setRequiredAction(MPxViewportComputeItem::kAccessConsolidation, true);
         setRequiredAction(MPxViewportComputeItem::kModifyVertexBufferData, true);
-#if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
-        setRequiredAction(MPxViewportComputeItem::kModifyVertexBufferSize, true);
-        setRequiredAction(MPxViewportComputeItem::kModifyConsolidation, true);
-#endif
+        if (osdEnabled()) {
+            setRequiredAction(MPxViewportComputeItem::kModifyVertexBufferSize, true);
+            setRequiredAction(MPxViewportComputeItem::kModifyConsolidation, true);
+        }
     }
 
     virtual ~MeshViewportCompute()
@@ -260,6 +267,19 @@ public:
     void setTopologyDirty();
     void setAdjacencyBufferGPUDirty();
     void setNormalVertexBufferGPUDirty();
+
+#if defined(DO_CPU_OSD) || defined(DO_OPENGL_OSD)
+    //! Gets the OpenSubdiv tables of the current topology from the shared cache.
+    void updateOsdTables();
+#endif
+
+    static void setUseCPU(bool useCPU) { _useCPU = useCPU; }
+    static bool useCPU() { return _useCPU; }
+
+    //! True if the selected backend can refine meshes with OSD.
+    static bool osdEnabled();
+    //! True if the meshes with the given topology are refined with OSD by the compute.
+    static bool requiresOSD(const HdMeshTopology& topology);
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
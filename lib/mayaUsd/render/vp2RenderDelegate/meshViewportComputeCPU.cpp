@@ -0,0 +1,309 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshViewportComputeCPU.h"
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/imaging/pxOsd/refinerFactory.h>
+
+#include <opensubdiv/far/patchTableFactory.h>
+#include <opensubdiv/far/stencilTableFactory.h>
+#include <opensubdiv/version.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Number of vertices or stencils processed by a single task.
+constexpr size_t kGrainSize = 4096;
+
+//! Key of the shared OpenSubdiv tables cache.
+struct _OsdTablesKey
+{
+    size_t topologyHash;
+    int    level;
+    bool   adaptive;
+
+    bool operator==(const _OsdTablesKey& other) const
+    {
+        return topologyHash == other.topologyHash && level == other.level
+            && adaptive == other.adaptive;
+    }
+};
+
+struct _OsdTablesKeyHash
+{
+    size_t operator()(const _OsdTablesKey& key) const
+    {
+        return key.topologyHash ^ (std::hash<int>()(key.level * 2 + (key.adaptive ? 1 : 0)) << 1);
+    }
+};
+
+/*! \brief  Weak references to the OpenSubdiv tables in use, by topology.
+
+    Tables are built outside of the lock, so two meshes syncing the same new
+    topology at the same time may both build it. The first tables stored win
+    and the other ones are dropped.
+*/
+class _OsdTablesCache
+{
+public:
+    HdVP2OsdTablesSharedPtr find(const _OsdTablesKey& key) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        it = _tables.find(key);
+        return it != _tables.end() ? it->second.lock() : nullptr;
+    }
+
+    //! Stores \p tables unless live tables were stored for \p key first, returns the cached ones.
+    HdVP2OsdTablesSharedPtr insert(const _OsdTablesKey& key, const HdVP2OsdTablesSharedPtr& tables)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::weak_ptr<const HdVP2OsdTables>& entry = _tables[key];
+        if (HdVP2OsdTablesSharedPtr cached = entry.lock()) {
+            return cached;
+        }
+        entry = tables;
+
+        // Drop the entries of freed tables once the map doubled since the last sweep, so that
+        // the cost is amortized over the insertions.
+        if (_tables.size() >= 2 * _sizeAfterSweep) {
+            for (auto it = _tables.begin(); it != _tables.end();) {
+                it = it->second.expired() ? _tables.erase(it) : std::next(it);
+            }
+            _sizeAfterSweep = std::max(_tables.size(), kMinSweepSize);
+        }
+        return tables;
+    }
+
+private:
+    static constexpr size_t kMinSweepSize = 64;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<_OsdTablesKey, std::weak_ptr<const HdVP2OsdTables>, _OsdTablesKeyHash>
+           _tables;
+    size_t _sizeAfterSweep { kMinSweepSize };
+};
+
+constexpr size_t _OsdTablesCache::kMinSweepSize;
+
+_OsdTablesCache& _GetOsdTablesCache()
+{
+    static _OsdTablesCache cache;
+    return cache;
+}
+
+} // namespace
+
+namespace MeshViewportComputeCPU {
+
+HdVP2OsdTablesSharedPtr
+createOsdTables(const HdMeshTopology& topology, const TfToken& renderTag, int level, bool adaptive)
+{
+    // for empty topology, we don't need to refine anything.
+    if (topology.GetFaceVertexCounts().size() == 0) {
+        return nullptr;
+    }
+
+    PxOsdTopologyRefinerSharedPtr refiner
+        = PxOsdRefinerFactory::Create(topology.GetPxOsdMeshTopology(), renderTag);
+    if (!refiner) {
+        return nullptr;
+    }
+
+    OpenSubdiv::Far::PatchTableFactory::Options patchOptions(level);
+    if (adaptive) {
+        patchOptions.endCapType = OpenSubdiv::Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
+#if OPENSUBDIV_VERSION_NUMBER >= 30400
+        // Improve fidelity when refining to limit surface patches
+        // These options supported since v3.1.0 and v3.2.0 respectively.
+        patchOptions.useInfSharpPatch = true;
+        patchOptions.generateLegacySharpCornerPatches = false;
+#endif
+    }
+
+    if (adaptive) {
+        OpenSubdiv::Far::TopologyRefiner::AdaptiveOptions adaptiveOptions(level);
+#if OPENSUBDIV_VERSION_NUMBER >= 30400
+        adaptiveOptions = patchOptions.GetRefineAdaptiveOptions();
+#endif
+        refiner->RefineAdaptive(adaptiveOptions);
+    } else {
+        refiner->RefineUniform(level);
+    }
+
+    // The stencil and patch tables only read the refiner, build them concurrently.
+    OpenSubdiv::Far::StencilTable const* vertexStencils = nullptr;
+    OpenSubdiv::Far::StencilTable const* varyingStencils = nullptr;
+    OpenSubdiv::Far::PatchTable const*   patchTable = nullptr;
+    auto createStencils = [&refiner, adaptive](OpenSubdiv::Far::StencilTableFactory::Mode mode) {
+        OpenSubdiv::Far::StencilTableFactory::Options options;
+        options.generateOffsets = true;
+        options.generateIntermediateLevels = adaptive;
+        options.interpolationMode = mode;
+        return OpenSubdiv::Far::StencilTableFactory::Create(*refiner, options);
+    };
+    tbb::parallel_invoke(
+        [&]() {
+            vertexStencils
+                = createStencils(OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VERTEX);
+        },
+        [&]() {
+            varyingStencils
+                = createStencils(OpenSubdiv::Far::StencilTableFactory::INTERPOLATE_VARYING);
+        },
+        [&]() {
+            patchTable = OpenSubdiv::Far::PatchTableFactory::Create(*refiner, patchOptions);
+        });
+
+    // merge endcap
+    if (patchTable && patchTable->GetLocalPointStencilTable()) {
+        // append stencils
+        auto appendLocalPoints
+            = [&refiner, patchTable](OpenSubdiv::Far::StencilTable const*& stencils) {
+                  if (OpenSubdiv::Far::StencilTable const* stencilsWithLocalPoints
+                      = OpenSubdiv::Far::StencilTableFactory::AppendLocalPointStencilTable(
+                          *refiner, stencils, patchTable->GetLocalPointStencilTable())) {
+                      delete stencils;
+                      stencils = stencilsWithLocalPoints;
+                  }
+              };
+        tbb::parallel_invoke(
+            [&]() { appendLocalPoints(vertexStencils); },
+            [&]() { appendLocalPoints(varyingStencils); });
+    }
+
+    auto tables = std::make_shared<HdVP2OsdTables>();
+    tables->vertexStencils.reset(vertexStencils);
+    tables->varyingStencils.reset(varyingStencils);
+    tables->patchTable.reset(patchTable);
+    tables->topologyHash = topology.ComputeHash();
+    tables->level = level;
+    tables->adaptive = adaptive;
+    return tables;
+}
+
+HdVP2OsdTablesSharedPtr findOrCreateOsdTables(
+    const HdMeshTopology& topology,
+    const TfToken&        renderTag,
+    int                   level,
+    bool                  adaptive)
+{
+    const _OsdTablesKey key { topology.ComputeHash(), level, adaptive };
+    _OsdTablesCache&    cache = _GetOsdTablesCache();
+    if (HdVP2OsdTablesSharedPtr tables = cache.find(key)) {
+        return tables;
+    }
+
+    HdVP2OsdTablesSharedPtr tables = createOsdTables(topology, renderTag, level, adaptive);
+    if (!tables) {
+        return nullptr;
+    }
+    return cache.insert(key, tables);
+}
+
+void evalStencils(
+    const OpenSubdiv::Far::StencilTable& stencils,
+    float*                               buffer,
+    int                                  dimension,
+    size_t                               numBaseVertices)
+{
+    // Stencils are factorized down to the control vertices, so every stencil
+    // only reads the base vertices and can be evaluated independently.
+    const int*   sizes = stencils.GetSizes().data();
+    const int*   offsets = stencils.GetOffsets().data();
+    const int*   indices = stencils.GetControlIndices().data();
+    const float* weights = stencils.GetWeights().data();
+
+    const float* src = buffer;
+    float*       dst = buffer + numBaseVertices * dimension;
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, stencils.GetNumStencils(), kGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t stencil = range.begin(); stencil < range.end(); ++stencil) {
+                float* result = dst + stencil * dimension;
+                std::fill(result, result + dimension, 0.0f);
+
+                const int begin = offsets[stencil];
+                const int end = begin + sizes[stencil];
+                for (int i = begin; i < end; ++i) {
+                    const float* control = src + static_cast<size_t>(indices[i]) * dimension;
+                    const float  weight = weights[i];
+                    for (int d = 0; d < dimension; ++d) {
+                        result[d] += weight * control[d];
+                    }
+                }
+            }
+        });
+}
+
+void computeSmoothNormals(
+    const int*   adjacency,
+    size_t       adjacencySize,
+    size_t       numVertices,
+    const float* positions,
+    float*       normals,
+    const int*   renderingToScene,
+    const int*   sceneToRendering)
+{
+    // The adjacency table starts with an (offset, valence) pair per scene vertex.
+    const size_t numAdjacencyVertices = adjacencySize > 0 ? size_t(adjacency[0]) / 2 : 0;
+
+    const GfVec3f* points = reinterpret_cast<const GfVec3f*>(positions);
+    GfVec3f*       result = reinterpret_cast<GfVec3f*>(normals);
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numVertices, kGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t vertexId = range.begin(); vertexId < range.end(); ++vertexId) {
+                const int sceneVertexId
+                    = renderingToScene ? renderingToScene[vertexId] : static_cast<int>(vertexId);
+
+                GfVec3f normal(0.0f);
+                if (sceneVertexId >= 0 && size_t(sceneVertexId) < numAdjacencyVertices) {
+                    const int*     entry = adjacency + adjacency[sceneVertexId * 2];
+                    const int      valence = adjacency[sceneVertexId * 2 + 1];
+                    const GfVec3f& curr = points[vertexId];
+
+                    for (int neighbour = 0; neighbour < valence; ++neighbour) {
+                        int prevId = *entry++;
+                        int nextId = *entry++;
+                        if (sceneToRendering) {
+                            prevId = sceneToRendering[prevId];
+                            nextId = sceneToRendering[nextId];
+                        }
+                        // All meshes have all been converted to rightHanded
+                        normal += GfCross(points[nextId] - curr, points[prevId] - curr);
+                    }
+                    normal.Normalize();
+                }
+                result[vertexId] = normal;
+            }
+        });
+}
+
+} // namespace MeshViewportComputeCPU
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,123 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESHVIEWPORTCOMPUTECPU
+#define HD_VP2_MESHVIEWPORTCOMPUTECPU
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/pxr.h>
+
+#include <opensubdiv/far/patchTable.h>
+#include <opensubdiv/far/stencilTable.h>
+
+#include <cstddef>
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  OpenSubdiv tables of one refined mesh topology.
+    \class  HdVP2OsdTables
+
+    The tables only depend on the topology, the refinement level and the
+    adaptive flag, so they can be kept across position changes and shared by
+    every compute item using the same topology.
+*/
+struct HdVP2OsdTables
+{
+    std::unique_ptr<const OpenSubdiv::Far::StencilTable> vertexStencils;
+    std::unique_ptr<const OpenSubdiv::Far::StencilTable> varyingStencils;
+    std::unique_ptr<const OpenSubdiv::Far::PatchTable>   patchTable;
+
+    size_t topologyHash { 0 };
+    int    level { 1 };
+    bool   adaptive { false };
+
+    //! True if the tables were built for the given topology and refinement settings.
+    bool matches(size_t hash, int refineLevel, bool isAdaptive) const
+    {
+        return topologyHash == hash && level == refineLevel && adaptive == isAdaptive;
+    }
+};
+
+using HdVP2OsdTablesSharedPtr = std::shared_ptr<const HdVP2OsdTables>;
+
+/*! \brief  CPU backend of MeshViewportCompute.
+
+    These functions compute on plain CPU buffers what the OpenGL compute
+    kernels of MeshViewportCompute compute on GPU buffers. They don't need an
+    OpenGL context, so they can run on headless machines and in unit tests.
+    Work is split over TBB tasks.
+*/
+namespace MeshViewportComputeCPU {
+
+/*! \brief  Refines the topology and builds its stencil and patch tables.
+
+    Returns nullptr for an empty topology.
+*/
+MAYAUSD_CORE_PUBLIC
+HdVP2OsdTablesSharedPtr
+createOsdTables(const HdMeshTopology& topology, const TfToken& renderTag, int level, bool adaptive);
+
+/*! \brief  Returns the shared tables of the topology, building them if needed.
+
+    Tables are cached by topology hash, level and adaptive flag. The cache only
+    holds weak references: meshes and instances with the same topology share
+    the tables while any of them uses them, and the tables are freed with their
+    last user.
+*/
+MAYAUSD_CORE_PUBLIC
+HdVP2OsdTablesSharedPtr findOrCreateOsdTables(
+    const HdMeshTopology& topology,
+    const TfToken&        renderTag,
+    int                   level,
+    bool                  adaptive);
+
+/*! \brief  Evaluates the stencils of \p stencils in place.
+
+    \p buffer holds \p numBaseVertices control vertices of \p dimension floats,
+    followed by room for one refined vertex per stencil, which are written.
+*/
+MAYAUSD_CORE_PUBLIC
+void evalStencils(
+    const OpenSubdiv::Far::StencilTable& stencils,
+    float*                               buffer,
+    int                                  dimension,
+    size_t                               numBaseVertices);
+
+/*! \brief  Computes smooth vertex normals, same as the computeNormals.glsl kernel.
+
+    \p adjacency is an Hd_VertexAdjacency table built on the scene topology.
+    When \p renderingToScene and \p sceneToRendering are given, \p positions
+    and \p normals are in rendering vertex order and the maps translate between
+    the two orders. Vertices not used by any face get a zero normal.
+*/
+MAYAUSD_CORE_PUBLIC
+void computeSmoothNormals(
+    const int*   adjacency,
+    size_t       adjacencySize,
+    size_t       numVertices,
+    const float* positions,
+    float*       normals,
+    const int*   renderingToScene = nullptr,
+    const int*   sceneToRendering = nullptr);
+
+} // namespace MeshViewportComputeCPU
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
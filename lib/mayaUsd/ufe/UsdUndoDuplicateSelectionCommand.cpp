@@ -17,10 +17,19 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <usdUfe/base/tokens.h>
+#include <usdUfe/ufe/UfeNotifGuard.h>
+#include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/utils/editRouterContext.h>
+#include <usdUfe/utils/layers.h>
+#include <usdUfe/utils/loadRules.h>
+#include <usdUfe/utils/mergePrims.h>
 #include <usdUfe/utils/usdUtils.h>
 
 #include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
@@ -32,6 +41,9 @@
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -45,6 +57,30 @@ bool shouldConnectExternalInputs(const Ufe::ValueDictionary& duplicateOptions)
     return itInputConnections != duplicateOptions.end() && itInputConnections->second.get<bool>();
 }
 
+// Names of the children of a prim, as considered by UsdUfe::uniqueChildName().
+TfToken::HashSet childrenNames(const UsdPrim& parent)
+{
+    TfToken::HashSet names;
+    if (parent) {
+        for (const auto& child : parent.GetFilteredChildren(
+                 UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract))) {
+            names.insert(child.GetName());
+        }
+    }
+    return names;
+}
+
+// A selected item and its duplicate, planned before any authoring.
+struct DuplicateItem
+{
+    UsdPrim        srcPrim;
+    SdfPath        dstPath;
+    SdfLayerHandle dstLayer;
+    // Specs where the source prim is defined, from weak to strong.
+    SdfPrimSpecHandleVector specs;
+    ReplicateExtrasToUSD    extras;
+};
+
 } // namespace
 
 UsdUndoDuplicateSelectionCommand::UsdUndoDuplicateSelectionCommand(
@@ -85,39 +121,147 @@ void UsdUndoDuplicateSelectionCommand::execute()
 {
     UsdUfe::UsdUndoBlock undoBlock(&_undoableItem);
 
+    // Plan all the duplicates before authoring anything. The duplicates are not on the
+    // stages yet when the next names are picked, so the names given in this batch are
+    // tracked per parent. Otherwise the collision resolution on names would merge bob1
+    // and bob2 into a single bob3 instead of creating a bob3 and a bob4.
+    std::vector<DuplicateItem>                       duplicates;
+    std::unordered_map<Ufe::Path, TfToken::HashSet>  takenNames;
+    std::unordered_map<Ufe::Path, UsdStageLoadRules> loadRules;
+    duplicates.reserve(_sourceItems.size());
     for (auto&& usdItem : _sourceItems) {
-        // Need to create and execute. If we create all before executing any, then the collision
-        // resolution on names will merge bob1 and bob2 into a single bob3 instead of creating a
-        // bob3 and a bob4.
-        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem);
-        duplicateCmd->execute();
+        DuplicateItem duplicate;
+        duplicate.srcPrim = usdItem->prim();
+        const UsdPrim        parentPrim = duplicate.srcPrim.GetParent();
+        const UsdStageRefPtr stage = duplicate.srcPrim.GetStage();
+        const Ufe::Path      stgPath = stagePath(stage);
+
+        auto names = takenNames.find(usdItem->path().pop());
+        if (names == takenNames.end()) {
+            names = takenNames.emplace(usdItem->path().pop(), childrenNames(parentPrim)).first;
+        }
+        std::string newName = UsdUfe::uniqueChildName(parentPrim, duplicate.srcPrim.GetName());
+        if (names->second.count(TfToken(newName)) > 0) {
+            newName = UsdUfe::uniqueName(names->second, newName);
+        }
+        names->second.insert(TfToken(newName));
+        duplicate.dstPath = parentPrim.GetPath().AppendChild(TfToken(newName));
+
+        {
+            UsdUfe::OperationEditRouterContext ctx(
+                UsdUfe::EditRoutingTokens->RouteDuplicate, duplicate.srcPrim);
+            duplicate.dstLayer = stage->GetEditTarget().GetLayer();
+        }
 
-        // Currently unordered_map since we need to streamline the targetItem override.
-        _perItemCommands[usdItem->path()] = duplicateCmd;
+        // Retrieve the local layers around where the prim is defined and order them
+        // from weak to strong. That weak-to-strong order allows us to copy the weakest
+        // opinions first, so that they will get over-written by the stronger opinions.
+        duplicate.specs = UsdUfe::getDefiningPrimStack(duplicate.srcPrim);
+        std::reverse(duplicate.specs.begin(), duplicate.specs.end());
 
-        PXR_NS::UsdPrim srcPrim = usdItem->prim();
-        PXR_NS::UsdPrim dstPrim = duplicateCmd->duplicatedItem()->prim();
+        duplicate.extras.initRecursive(usdItem);
 
-        Ufe::Path stgPath = stagePath(dstPrim.GetStage());
-        auto      stageIt = _duplicatesMap.find(stgPath);
-        if (stageIt == _duplicatesMap.end()) {
-            stageIt = _duplicatesMap.insert({ stgPath, DuplicatePathsMap() }).first;
+        // The loaded state of a model is controlled by the load rules of the stage.
+        // When duplicating a node, we want the new node to be in the same loaded
+        // state. The rules are set once per stage, below.
+        auto rules = loadRules.find(stgPath);
+        if (rules == loadRules.end()) {
+            rules = loadRules.emplace(stgPath, stage->GetLoadRules()).first;
         }
+        UsdUfe::duplicateLoadRules(rules->second, duplicate.srcPrim.GetPath(), duplicate.dstPath);
 
         // Make sure we are not tracking more than one duplicate per source.
-        TF_VERIFY(stageIt->second.count(srcPrim.GetPath()) == 0);
-        stageIt->second.insert({ srcPrim.GetPath(), dstPrim.GetPath() });
+        DuplicatePathsMap& pathsMap = _duplicatesMap[stgPath];
+        TF_VERIFY(pathsMap.count(duplicate.srcPrim.GetPath()) == 0);
+        pathsMap.insert({ duplicate.srcPrim.GetPath(), duplicate.dstPath });
+
+        _duplicatedPaths[usdItem->path()] = duplicate.dstPath;
+        duplicates.push_back(std::move(duplicate));
     }
 
     // We no longer require the source selection:
     _sourceItems.clear();
 
-    // Fixups were grouped by stage.
+    {
+        UsdUfe::InAddOrDeleteOperation ad;
+
+        for (const auto& rules : loadRules) {
+            PXR_NS::UsdStageWeakPtr stage(getStage(rules.first));
+            if (stage && stage->GetLoadRules() != rules.second) {
+                stage->SetLoadRules(rules.second);
+            }
+        }
+
+        // Copy the weakest opinions of all the duplicates inside a single change block, so
+        // that the stages are recomposed and notified once for the whole batch.
+        {
+            SdfChangeBlock changeBlock;
+            for (const DuplicateItem& duplicate : duplicates) {
+                if (!duplicate.dstLayer || duplicate.specs.empty()) {
+                    continue;
+                }
+
+                // Make sure all necessary parent exists in the target layer, at least as over,
+                // otherwise SdfCopySepc will fail.
+                SdfJustCreatePrimInLayer(duplicate.dstLayer, duplicate.dstPath.GetParentPath());
+
+                const SdfPrimSpecHandle& spec = duplicate.specs.front();
+                const bool               result = SdfCopySpec(
+                    spec->GetLayer(), spec->GetPath(), duplicate.dstLayer, duplicate.dstPath);
+                TF_VERIFY(
+                    result,
+                    "Failed to copy the USD prim at '%s' in layer '%s' to '%s'",
+                    spec->GetPath().GetText(),
+                    spec->GetLayer()->GetDisplayName().c_str(),
+                    duplicate.dstPath.GetText());
+            }
+        }
+
+        // Merging the stronger opinions relies on the composed stage, so it is done per
+        // duplicate, now that they all exist. Most prims are defined in a single layer and
+        // have nothing to merge.
+        UsdUfe::MergePrimsOptions options;
+        options.verbosity = UsdUfe::MergeVerbosity::None;
+        options.mergeChildren = true;
+        for (const DuplicateItem& duplicate : duplicates) {
+            const UsdStageRefPtr stage = duplicate.srcPrim.GetStage();
+            if (duplicate.dstLayer) {
+                for (size_t i = 1; i < duplicate.specs.size(); ++i) {
+                    const SdfPrimSpecHandle& spec = duplicate.specs[i];
+                    const bool               result = UsdUfe::mergePrims(
+                        stage,
+                        spec->GetLayer(),
+                        spec->GetPath(),
+                        stage,
+                        duplicate.dstLayer,
+                        duplicate.dstPath,
+                        options);
+                    TF_VERIFY(
+                        result,
+                        "Failed to copy the USD prim at '%s' in layer '%s' to '%s'",
+                        spec->GetPath().GetText(),
+                        spec->GetLayer()->GetDisplayName().c_str(),
+                        duplicate.dstPath.GetText());
+                }
+            }
+
+            ReplicateExtrasToUSD::RenamedPaths renamed;
+            renamed[duplicate.srcPrim.GetPath()] = duplicate.dstPath;
+            duplicate.extras.finalize(stagePath(stage), renamed);
+        }
+    }
+
+    // Fixups were grouped by stage. All the relationships and connections of the
+    // duplicates are read first, then rewritten inside a single change block.
     for (const auto& stageData : _duplicatesMap) {
         PXR_NS::UsdStageWeakPtr stage(getStage(stageData.first));
         if (!stage) {
             continue;
         }
+
+        std::vector<std::pair<PXR_NS::UsdAttribute, PXR_NS::SdfPathVector>>    connections;
+        std::vector<std::pair<PXR_NS::UsdRelationship, PXR_NS::SdfPathVector>> targets;
+        std::vector<PXR_NS::UsdAttribute>                                      attrsToRemove;
         for (const auto& duplicatePair : stageData.second) {
             // Cleanup relationships and connections on the duplicate.
             for (auto p : UsdPrimRange(stage->GetPrimAtPath(duplicatePair.second))) {
@@ -128,43 +272,56 @@ void UsdUndoDuplicateSelectionCommand::execute()
                         attr.GetConnections(&sources);
                         if (updateSdfPathVector(
                                 sources, duplicatePair, stageData.second, _copyExternalInputs)) {
-                            if (sources.empty()) {
-                                attr.ClearConnections();
-                                if (!attr.HasValue() && !UsdShadeNodeGraph(attr.GetPrim())) {
-                                    p.RemoveProperty(prop.GetName());
-                                }
-                            } else {
-                                attr.SetConnections(sources);
+                            if (sources.empty() && !attr.HasValue()
+                                && !UsdShadeNodeGraph(attr.GetPrim())) {
+                                attrsToRemove.push_back(attr);
                             }
+                            connections.emplace_back(attr, std::move(sources));
                         }
                     } else if (prop.Is<PXR_NS::UsdRelationship>()) {
                         PXR_NS::UsdRelationship rel = prop.As<PXR_NS::UsdRelationship>();
-                        PXR_NS::SdfPathVector   targets;
-                        rel.GetTargets(&targets);
+                        PXR_NS::SdfPathVector   relTargets;
+                        rel.GetTargets(&relTargets);
                         // Currently always copying external relationships is the right move since
                         // duplicated geometries will keep their currently assigned material. We
                         // might need a case by case basis later as we deal with more complex
                         // relationships.
-                        if (updateSdfPathVector(targets, duplicatePair, stageData.second, true)) {
-                            if (targets.empty()) {
-                                rel.ClearTargets(true);
-                            } else {
-                                rel.SetTargets(targets);
-                            }
+                        if (updateSdfPathVector(
+                                relTargets, duplicatePair, stageData.second, true)) {
+                            targets.emplace_back(rel, std::move(relTargets));
                         }
                     }
                 }
             }
         }
+
+        SdfChangeBlock changeBlock;
+        for (auto& connection : connections) {
+            if (connection.second.empty()) {
+                connection.first.ClearConnections();
+            } else {
+                connection.first.SetConnections(connection.second);
+            }
+        }
+        for (const PXR_NS::UsdAttribute& attr : attrsToRemove) {
+            attr.GetPrim().RemoveProperty(attr.GetName());
+        }
+        for (auto& target : targets) {
+            if (target.second.empty()) {
+                target.first.ClearTargets(true);
+            } else {
+                target.first.SetTargets(target.second);
+            }
+        }
     }
 }
 
 Ufe::SceneItem::Ptr UsdUndoDuplicateSelectionCommand::targetItem(const Ufe::Path& sourcePath) const
 {
     // Perfect match:
-    CommandMap::const_iterator it = _perItemCommands.find(sourcePath);
-    if (it != _perItemCommands.cend()) {
-        return it->second->duplicatedItem();
+    DuplicatedPathsMap::const_iterator it = _duplicatedPaths.find(sourcePath);
+    if (it != _duplicatedPaths.cend()) {
+        return createSiblingSceneItem(sourcePath, it->second.GetElementString());
     }
 
     // MAYA-125854: If we do not find that exact path, see if it is a descendant of a duplicated
@@ -176,11 +333,14 @@ Ufe::SceneItem::Ptr UsdUndoDuplicateSelectionCommand::targetItem(const Ufe::Path
     }
 
     while (numSegments == path.getSegments().size()) {
-        it = _perItemCommands.find(path);
-        if (it != _perItemCommands.cend() && it->second->duplicatedItem()) {
-            Ufe::Path duplicatedChildPath
-                = sourcePath.reparent(path, it->second->duplicatedItem()->path());
-            return Ufe::Hierarchy::createItem(duplicatedChildPath);
+        it = _duplicatedPaths.find(path);
+        if (it != _duplicatedPaths.cend()) {
+            auto duplicatedItem = createSiblingSceneItem(path, it->second.GetElementString());
+            if (duplicatedItem) {
+                Ufe::Path duplicatedChildPath
+                    = sourcePath.reparent(path, duplicatedItem->path());
+                return Ufe::Hierarchy::createItem(duplicatedChildPath);
+            }
         }
         path = path.pop();
     }
@@ -197,24 +357,24 @@ bool UsdUndoDuplicateSelectionCommand::updateSdfPathVector(
     std::list<size_t> indicesToRemove;
     for (size_t i = 0; i < pathVec.size(); ++i) {
         const PXR_NS::SdfPath& path = pathVec[i];
-        PXR_NS::SdfPath        finalPath = path;
-        auto                   itPath = otherPairs.begin();
-        const auto             endPath = otherPairs.end();
-        bool                   isExternalPath = true;
-        for (; itPath != endPath; ++itPath) {
-            if (*itPath == duplicatePair) {
-                // That one was correctly processed by USD when duplicating.
-                isExternalPath
-                    = !finalPath.HasPrefix(itPath->first) && !finalPath.HasPrefix(itPath->second);
+        // Descendants of selected items are not duplicated on their own, so at most one
+        // source path is a prefix of the path: look its ancestors up instead of testing
+        // every duplicate of the batch.
+        bool isExternalPath = !path.HasPrefix(duplicatePair.second);
+        for (PXR_NS::SdfPath prefix = path.GetPrimPath();
+             !prefix.IsEmpty() && prefix != PXR_NS::SdfPath::AbsoluteRootPath();
+             prefix = prefix.GetParentPath()) {
+            const auto itPath = otherPairs.find(prefix);
+            if (itPath == otherPairs.end()) {
                 continue;
             }
-            finalPath = finalPath.ReplacePrefix(itPath->first, itPath->second);
-            if (path != finalPath) {
-                pathVec[i] = finalPath;
+            isExternalPath = false;
+            // The duplicate itself was correctly processed by USD when duplicating.
+            if (*itPath != duplicatePair) {
+                pathVec[i] = path.ReplacePrefix(itPath->first, itPath->second);
                 hasChanged = true;
-                isExternalPath = false;
-                break;
             }
+            break;
         }
         if (!keepExternal && isExternalPath) {
             hasChanged = true;
@@ -17,11 +17,12 @@
 #define MAYAUSD_UFE_USDUNDODUPLICATESELECTIONCOMMAND_H
 
 #include <mayaUsd/base/api.h>
-#include <mayaUsd/ufe/UsdUndoDuplicateCommand.h>
 
 #include <usdUfe/ufe/UsdSceneItem.h>
 #include <usdUfe/undo/UsdUndoableItem.h>
 
+#include <pxr/usd/sdf/path.h>
+
 #include <ufe/path.h>
 #include <ufe/selection.h>
 #include <ufe/undoableCommand.h>
@@ -29,11 +30,20 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
 //! \brief UsdUndoDuplicateSelectionCommand
+//!
+//! \details Duplicates all the selected items as a single batch: the specs of all the
+//!          duplicates are copied inside a single SdfChangeBlock, so that the stage is
+//!          recomposed once instead of once per item, and the relationships and
+//!          connections of all the duplicates are then fixed in a second change block.
+//!
+//!          Like UsdUndoDuplicateCommand, the opinions of the local layer stack where
+//!          each prim is defined are flattened in the target layer of the edit router.
 class MAYAUSD_CORE_PUBLIC UsdUndoDuplicateSelectionCommand : public Ufe::SelectionUndoableCommand
 {
 public:
@@ -62,8 +72,9 @@ private:
     // Transient list of items to duplicate. Needed by execute.
     std::vector<UsdUfe::UsdSceneItem::Ptr> _sourceItems;
 
-    using CommandMap = std::unordered_map<Ufe::Path, UsdUndoDuplicateCommand::Ptr>;
-    CommandMap _perItemCommands;
+    // Path of the duplicate of each source item, for targetItem().
+    using DuplicatedPathsMap = std::unordered_map<Ufe::Path, PXR_NS::SdfPath>;
+    DuplicatedPathsMap _duplicatedPaths;
 
     // Fixup data:
     using DuplicatePathsMap = std::map<PXR_NS::SdfPath, PXR_NS::SdfPath>;
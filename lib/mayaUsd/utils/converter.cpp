@@ -22,11 +22,14 @@
 #include <maya/MDGModifier.h>
 #include <maya/MDataBlock.h>
 #include <maya/MFnData.h>
+#include <maya/MFnDoubleArrayData.h>
+#include <maya/MFnFloatArrayData.h>
 #include <maya/MFnIntArrayData.h>
 #include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnPointArrayData.h>
 #include <maya/MFnStringData.h>
 #include <maya/MFnUnitAttribute.h>
+#include <maya/MFnVectorArrayData.h>
 
 #include <unordered_map>
 
@@ -53,9 +56,17 @@
 | Matrix4d         | GfMatrix4d            | MFnData::kMatrix,  MFn::kMatrixData                            | MMatrix, MFnMatrixData  | MakeMayaFnData     |
 ||
 | IntArray         | VtArray< int >        | MFnData::kIntArray, MFn::kIntArrayData                | MIntArray, MFnIntArrayData       | MakeMayaFnData     |
+| FloatArray       | VtArray< float >      | MFnData::kFloatArray, MFn::kFloatArrayData            | MFloatArray, MFnFloatArrayData   | MakeMayaFnData     |
+| DoubleArray      | VtArray< double >     | MFnData::kDoubleArray, MFn::kDoubleArrayData          | MDoubleArray, MFnDoubleArrayData | MakeMayaFnData     |
 | Point3fArray     | VtArray< GfVec3f >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
+| Point3dArray     | VtArray< GfVec3d >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
+| Vector3fArray    | VtArray< GfVec3f >    | MFnData::kVectorArray, MFn::kVectorArrayData          | MVectorArray, MFnVectorArrayData | MakeMayaFnData     |
+| Vector3dArray    | VtArray< GfVec3d >    | MFnData::kVectorArray, MFn::kVectorArrayData          | MVectorArray, MFnVectorArrayData | MakeMayaFnData     |
 | Matrix4dArray    | VtArray< GfMatrix4d > | MFnData::kMatrixArray, MFn::kMatrixArrayData          | MMatrixArray, MFnMatrixArrayData | MakeMayaFnData     |
 
+Conversions between Maya arrays and VtArray are done in bulk, see MayaArrayLayout and
+UsdArrayLayout in converter.h.
+
 This table lists currently supported types for array attributes
 
 | USD C++ Item Type | Maya C++ Item Type | Helper TypeTrait            |
@@ -243,19 +254,20 @@ template <class MAYA_Type> struct MakeMayaFnData : public std::false_type
 {
 };
 
-//! \brief  Type trait for Maya's MMatrixArray type providing get and set methods for data
+//! \brief  Common type trait for Maya's typed array data providing get and set methods for data
 //! handle and plugs.
-template <> struct MakeMayaFnData<MMatrixArray> : public std::true_type
+template <class MAYA_ArrayType, class MAYA_FnType, MFnData::Type DataType, MFn::Type ApiType>
+struct MakeMayaArrayFnData : public std::true_type
 {
-    using Type = MMatrixArray;
-    using FnType = MFnMatrixArrayData;
+    using Type = MAYA_ArrayType;
+    using FnType = MAYA_FnType;
     enum
     {
-        kDataType = MFnData::kMatrixArray
+        kDataType = DataType
     };
     enum
     {
-        kApiType = MFn::kMatrixArrayData
+        kApiType = ApiType
     };
 
     static MObject create(FnType& data) { return data.create(); }
@@ -281,80 +293,66 @@ template <> struct MakeMayaFnData<MMatrixArray> : public std::true_type
     }
 };
 
-//! \brief  Type trait for Maya's MIntArray type providing get and set methods for data handle
-//! and plugs.
-template <> struct MakeMayaFnData<MIntArray> : public std::true_type
+//! \brief  Type trait for Maya's MMatrixArray type.
+template <>
+struct MakeMayaFnData<MMatrixArray>
+    : public MakeMayaArrayFnData<
+          MMatrixArray,
+          MFnMatrixArrayData,
+          MFnData::kMatrixArray,
+          MFn::kMatrixArrayData>
 {
-    using Type = MIntArray;
-    using FnType = MFnIntArrayData;
-    enum
-    {
-        kDataType = MFnData::kIntArray
-    };
-    enum
-    {
-        kApiType = MFn::kIntArrayData
-    };
-
-    static MObject create(FnType& data) { return data.create(); }
-
-    static void get(const FnType& data, Type& value) { data.copyTo(value); }
-
-    static void set(FnType& data, const Type& value) { data.set(value); }
-
-    static void get(const MDataHandle& handle, Type& value)
-    {
-        MObject dataObj = const_cast<MDataHandle&>(handle).data();
-        FnType  dataFn(dataObj);
-        get(dataFn, value);
-    }
-
-    static void set(MDataHandle& handle, const Type& value)
-    {
-        FnType  dataFn;
-        MObject dataObj = create(dataFn);
-        set(dataFn, value);
-
-        handle.setMObject(dataObj);
-    }
 };
 
-//! \brief  Type trait for Maya's MPointArray type providing get and set methods for data handle
-//! and plugs.
-template <> struct MakeMayaFnData<MPointArray> : public std::true_type
+//! \brief  Type trait for Maya's MIntArray type.
+template <>
+struct MakeMayaFnData<MIntArray>
+    : public MakeMayaArrayFnData<MIntArray, MFnIntArrayData, MFnData::kIntArray, MFn::kIntArrayData>
 {
-    using Type = MPointArray;
-    using FnType = MFnPointArrayData;
-    enum
-    {
-        kDataType = MFnData::kPointArray
-    };
-    enum
-    {
-        kApiType = MFn::kPointArrayData
-    };
-
-    static MObject create(FnType& data) { return data.create(); }
-
-    static void get(const FnType& data, Type& value) { data.copyTo(value); }
+};
 
-    static void set(FnType& data, const Type& value) { data.set(value); }
+//! \brief  Type trait for Maya's MFloatArray type.
+template <>
+struct MakeMayaFnData<MFloatArray>
+    : public MakeMayaArrayFnData<
+          MFloatArray,
+          MFnFloatArrayData,
+          MFnData::kFloatArray,
+          MFn::kFloatArrayData>
+{
+};
 
-    static void get(const MDataHandle& handle, Type& value)
-    {
-        MObject dataObj = const_cast<MDataHandle&>(handle).data();
-        FnType  dataFn(dataObj);
-        get(dataFn, value);
-    }
+//! \brief  Type trait for Maya's MDoubleArray type.
+template <>
+struct MakeMayaFnData<MDoubleArray>
+    : public MakeMayaArrayFnData<
+          MDoubleArray,
+          MFnDoubleArrayData,
+          MFnData::kDoubleArray,
+          MFn::kDoubleArrayData>
+{
+};
 
-    static void set(MDataHandle& handle, const Type& value)
-    {
-        FnType  dataFn;
-        MObject dataObj = create(dataFn);
-        set(dataFn, value);
+//! \brief  Type trait for Maya's MPointArray type.
+template <>
+struct MakeMayaFnData<MPointArray>
+    : public MakeMayaArrayFnData<
+          MPointArray,
+          MFnPointArrayData,
+          MFnData::kPointArray,
+          MFn::kPointArrayData>
+{
+};
 
-        handle.setMObject(dataObj);
-    }
+//! \brief  Type trait for Maya's MVectorArray type.
+template <>
+struct MakeMayaFnData<MVectorArray>
+    : public MakeMayaArrayFnData<
+          MVectorArray,
+          MFnVectorArrayData,
+          MFnData::kVectorArray,
+          MFn::kVectorArrayData>
+{
 };
 
 //! \brief  Type trait for Maya's MMatrix type providing get and set methods for data handle and
@@ -1077,7 +1075,14 @@ struct Converter::GenerateConverters
             converters, SdfValueTypeNames->Color3d);
 
         createConverter<MIntArray, VtArray<int>>(converters, SdfValueTypeNames->IntArray);
+        createConverter<MFloatArray, VtArray<float>>(converters, SdfValueTypeNames->FloatArray);
+        createConverter<MDoubleArray, VtArray<double>>(converters, SdfValueTypeNames->DoubleArray);
         createConverter<MPointArray, VtArray<GfVec3f>>(converters, SdfValueTypeNames->Point3fArray);
+        createConverter<MPointArray, VtArray<GfVec3d>>(converters, SdfValueTypeNames->Point3dArray);
+        createConverter<MVectorArray, VtArray<GfVec3f>>(
+            converters, SdfValueTypeNames->Vector3fArray);
+        createConverter<MVectorArray, VtArray<GfVec3d>>(
+            converters, SdfValueTypeNames->Vector3dArray);
         createConverter<MMatrixArray, VtArray<GfMatrix4d>>(
             converters, SdfValueTypeNames->Matrix4dArray);
 
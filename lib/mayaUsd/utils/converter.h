@@ -26,6 +26,10 @@
 #include <pxr/usd/usd/timeCode.h>
 
 #include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
+#include <maya/MFloatPointArray.h>
+#include <maya/MFloatVectorArray.h>
 #include <maya/MFnMatrixData.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnTypedAttribute.h>
@@ -36,6 +40,11 @@
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
 #include <maya/MString.h>
+#include <maya/MVectorArray.h>
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -422,66 +431,182 @@ template <> struct TypedConverter<MMatrix, GfMatrix4d>
     }
 };
 
-//! \brief  Specialization of TypedConverter for MIntArray <--> VtArray<int>
-template <> struct TypedConverter<MIntArray, VtArray<int>>
+//! \brief  Describes the raw storage of a Maya array type supporting bulk conversion. Each
+//! supported type will specialize this struct, providing the scalar type and the number of
+//! scalars of one element.
+template <class MAYA_ArrayType> struct MayaArrayLayout : public std::false_type
 {
-    static void convert(const VtArray<int>& src, MIntArray& dst)
-    {
-        const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
-        }
-    }
-    static void convert(const MIntArray& src, VtArray<int>& dst)
-    {
-        const size_t srcSize = src.length();
-        dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
-        }
-    }
 };
 
-//! \brief  Specialization of TypedConverter for MPointArray <--> VtArray<GfVec3f>
-template <> struct TypedConverter<MPointArray, VtArray<GfVec3f>>
+template <> struct MayaArrayLayout<MIntArray> : public std::true_type
 {
-    static void convert(const VtArray<GfVec3f>& src, MPointArray& dst)
-    {
-        const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
-        }
+    using Scalar = int;
+    static constexpr size_t kDimension = 1;
+};
+
+template <> struct MayaArrayLayout<MFloatArray> : public std::true_type
+{
+    using Scalar = float;
+    static constexpr size_t kDimension = 1;
+};
+
+template <> struct MayaArrayLayout<MDoubleArray> : public std::true_type
+{
+    using Scalar = double;
+    static constexpr size_t kDimension = 1;
+};
+
+//! \brief  Maya points are homogeneous, the w component is stored after x, y and z.
+template <> struct MayaArrayLayout<MPointArray> : public std::true_type
+{
+    using Scalar = double;
+    static constexpr size_t kDimension = 4;
+};
+
+//! \brief  Maya points are homogeneous, the w component is stored after x, y and z.
+template <> struct MayaArrayLayout<MFloatPointArray> : public std::true_type
+{
+    using Scalar = float;
+    static constexpr size_t kDimension = 4;
+};
+
+template <> struct MayaArrayLayout<MVectorArray> : public std::true_type
+{
+    using Scalar = double;
+    static constexpr size_t kDimension = 3;
+};
+
+template <> struct MayaArrayLayout<MFloatVectorArray> : public std::true_type
+{
+    using Scalar = float;
+    static constexpr size_t kDimension = 3;
+};
+
+template <> struct MayaArrayLayout<MMatrixArray> : public std::true_type
+{
+    using Scalar = double;
+    static constexpr size_t kDimension = 16;
+};
+
+//! \brief  Describes the raw storage of a Usd array item type supporting bulk conversion.
+template <class USD_Type, class Enable = void> struct UsdArrayLayout : public std::false_type
+{
+};
+
+//! \brief  Specialization of UsdArrayLayout for arithmetic item types.
+template <class USD_Type>
+struct UsdArrayLayout<USD_Type, typename std::enable_if<std::is_arithmetic<USD_Type>::value>::type>
+    : public std::true_type
+{
+    using Scalar = USD_Type;
+    static constexpr size_t kDimension = 1;
+};
+
+//! \brief  Specialization of UsdArrayLayout for GfVec3f and GfVec3d.
+template <class USD_Type>
+struct UsdArrayLayout<
+    USD_Type,
+    typename std::enable_if<
+        std::is_same<USD_Type, GfVec3f>::value || std::is_same<USD_Type, GfVec3d>::value>::type>
+    : public std::true_type
+{
+    using Scalar = typename USD_Type::ScalarType;
+    static constexpr size_t kDimension = USD_Type::dimension;
+};
+
+//! \brief  Specialization of UsdArrayLayout for GfMatrix4d.
+template <> struct UsdArrayLayout<GfMatrix4d> : public std::true_type
+{
+    using Scalar = double;
+    static constexpr size_t kDimension = 16;
+};
+
+/*! \brief  Copies \p count elements of \p SrcDim scalars from \p src to elements of \p DstDim
+    scalars in \p dst.
+
+    Identical layouts are copied with a single memcpy. Otherwise the scalars are widened or
+    narrowed in a tight loop with compile-time strides, which compilers vectorize. Destination
+    scalars without a source scalar are set to 1, the homogeneous coordinate of Maya points.
+*/
+template <size_t SrcDim, size_t DstDim, class SrcScalar, class DstScalar>
+void bulkArrayCopy(const SrcScalar* src, DstScalar* dst, size_t count)
+{
+    if (count == 0) {
+        return;
     }
-    static void convert(const MPointArray& src, VtArray<GfVec3f>& dst)
-    {
-        const size_t srcSize = src.length();
-        dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
-        }
+
+    if (SrcDim == DstDim && std::is_same<SrcScalar, DstScalar>::value) {
+        memcpy(dst, src, count * SrcDim * sizeof(SrcScalar));
+        return;
     }
-};
 
-//! \brief  Specialization of TypedConverter for MMatrixArray <--> VtArray<GfMatrix4d>
-template <> struct TypedConverter<MMatrixArray, VtArray<GfMatrix4d>>
+    constexpr size_t kCommonDim = SrcDim < DstDim ? SrcDim : DstDim;
+    for (size_t i = 0; i < count; ++i) {
+        const SrcScalar* srcItem = src + i * SrcDim;
+        DstScalar*       dstItem = dst + i * DstDim;
+        for (size_t c = 0; c < kCommonDim; ++c) {
+            dstItem[c] = static_cast<DstScalar>(srcItem[c]);
+        }
+        for (size_t c = kCommonDim; c < DstDim; ++c) {
+            dstItem[c] = DstScalar(1);
+        }
+    }
+}
+
+//! \brief  Specialization of TypedConverter for Maya arrays <--> VtArray, converting the whole
+//! array at once instead of one element at a time.
+//!
+//! The whole storage of a Maya array is addressed from its first item. This assumes that the
+//! Maya arrays listed by MayaArrayLayout store their items contiguously, which is how they are
+//! implemented although their API does not state it. Only the packing of a single item can be
+//! checked at compile time: a Maya array type added to MayaArrayLayout must be checked to store
+//! its items contiguously, and be covered by the round trip tests of testConverter.cpp.
+template <class MAYA_Type, class USD_ItemType>
+struct TypedConverter<
+    MAYA_Type,
+    VtArray<USD_ItemType>,
+    typename std::enable_if<
+        MayaArrayLayout<MAYA_Type>::value && UsdArrayLayout<USD_ItemType>::value>::type>
 {
-    static void convert(const VtArray<GfMatrix4d>& src, MMatrixArray& dst)
+    using MayaLayout = MayaArrayLayout<MAYA_Type>;
+    using UsdLayout = UsdArrayLayout<USD_ItemType>;
+
+    using MayaItemType = typename std::decay<decltype(std::declval<MAYA_Type&>()[0])>::type;
+
+    static_assert(
+        sizeof(MayaItemType) == MayaLayout::kDimension * sizeof(typename MayaLayout::Scalar),
+        "Maya array items must be tightly packed");
+    static_assert(
+        sizeof(USD_ItemType) == UsdLayout::kDimension * sizeof(typename UsdLayout::Scalar),
+        "Usd array items must be tightly packed");
+
+    static void convert(const VtArray<USD_ItemType>& src, MAYA_Type& dst)
     {
         const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+        dst.setLength(static_cast<unsigned int>(srcSize));
+        if (srcSize == 0) {
+            return;
         }
+
+        bulkArrayCopy<UsdLayout::kDimension, MayaLayout::kDimension>(
+            reinterpret_cast<const typename UsdLayout::Scalar*>(src.cdata()),
+            reinterpret_cast<typename MayaLayout::Scalar*>(&dst[0]),
+            srcSize);
     }
-    static void convert(const MMatrixArray& src, VtArray<GfMatrix4d>& dst)
+    static void convert(const MAYA_Type& src, VtArray<USD_ItemType>& dst)
     {
         const size_t srcSize = src.length();
         dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+        if (srcSize == 0) {
+            return;
         }
+
+        // Const Maya arrays return their items by value, use the non-const accessor to get
+        // the address of the contiguous storage. It is only read from.
+        bulkArrayCopy<MayaLayout::kDimension, UsdLayout::kDimension>(
+            reinterpret_cast<const typename MayaLayout::Scalar*>(&const_cast<MAYA_Type&>(src)[0]),
+            reinterpret_cast<typename UsdLayout::Scalar*>(dst.data()),
+            srcSize);
     }
 };
 
@@ -24,6 +24,9 @@
 
 #include <maya/MGlobal.h>
 
+#include <unordered_map>
+#include <unordered_set>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {
@@ -112,56 +115,103 @@ void replicateMissingAncestors(
     }
 }
 
-// Verify if the given path needs to be renamed and rename it if needed.
-void renamePath(SdfPath& pathToVerify, const MayaUsd::CopyLayerPrimsResult& result)
+// Prefix index of the copied and renamed paths recorded in the copy result.
+//
+// The result keeps its paths in ordered maps, which can only be searched for
+// a prefix of a given path by looking at every entry. The index instead looks
+// up each ancestor of the given path in hash tables, so the cost of a query
+// only depends on the depth of the path, not on the number of copied prims.
+class CopiedPathsIndex
 {
-    for (const auto& oldAndNew : result.renamedPaths) {
-        // If the relationship was not targeting this renamed path, skip.
-        const SdfPath& oldPath = oldAndNew.first;
-        if (!pathToVerify.HasPrefix(oldPath))
-            continue;
-
-        const SdfPath& newPath = oldAndNew.second;
-        SdfPath        renamedPath = pathToVerify.ReplacePrefix(oldPath, newPath);
-
-        DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
-            "Renaming path %s to %s",
-            pathToVerify.GetAsString().c_str(),
-            renamedPath.GetAsString().c_str()));
-
-        pathToVerify = renamedPath;
-
-        // Note: each path must only be renamed once. Otherwise, if there
-        //       is a chain of renaming 1 -> 2 -> 3, etc, all paths would
-        //       get renamed to the end of the chain, instead of their one
-        //       true renamed path.
-        //
-        //       For example:
-        //
-        //       Let's say we copied a1 and a2 and suppose the destination
-        //       already contained a1. Then a1 will become a2 and a2 will
-        //       become a3 in the destination.
-        //
-        //       When verifying the path a1 we want to correctly rename it to
-        //       the path a2, but then avoid renaming it again to a3. That is
-        //       why we interrupt renaming at the first renaming.
-        break;
+public:
+    void addCopied(const SdfPath& srcPath) { _copiedPaths.insert(srcPath); }
+
+    void addRenamed(const SdfPath& oldPath, const SdfPath& newPath)
+    {
+        _renamedPaths[oldPath] = newPath;
     }
+
+    // Verify if the given path or one of its ancestors has been copied.
+    bool isCopied(const SdfPath& path) const
+    {
+        if (_copiedPaths.empty())
+            return false;
+
+        for (SdfPath prefix = path; prefix.GetPathElementCount() > 0;
+             prefix = prefix.GetParentPath()) {
+            if (_copiedPaths.count(prefix))
+                return true;
+        }
+        return false;
+    }
+
+    // Find the renamed path that is the top-most ancestor of the given path,
+    // or the path itself. Returns null if none were renamed.
+    const std::pair<const SdfPath, SdfPath>* findRenamed(const SdfPath& path) const
+    {
+        if (_renamedPaths.empty())
+            return nullptr;
+
+        const std::pair<const SdfPath, SdfPath>* found = nullptr;
+        for (SdfPath prefix = path; prefix.GetPathElementCount() > 0;
+             prefix = prefix.GetParentPath()) {
+            const auto iter = _renamedPaths.find(prefix);
+            if (iter != _renamedPaths.end())
+                found = &*iter;
+        }
+        return found;
+    }
+
+private:
+    std::unordered_set<SdfPath, SdfPath::Hash>          _copiedPaths;
+    std::unordered_map<SdfPath, SdfPath, SdfPath::Hash> _renamedPaths;
+};
+
+// Verify if the given path needs to be renamed and rename it if needed.
+// Returns true if the path was renamed.
+bool renamePath(SdfPath& pathToVerify, const CopiedPathsIndex& index)
+{
+    // Note: each path must only be renamed once. Otherwise, if there
+    //       is a chain of renaming 1 -> 2 -> 3, etc, all paths would
+    //       get renamed to the end of the chain, instead of their one
+    //       true renamed path.
+    //
+    //       For example:
+    //
+    //       Let's say we copied a1 and a2 and suppose the destination
+    //       already contained a1. Then a1 will become a2 and a2 will
+    //       become a3 in the destination.
+    //
+    //       When verifying the path a1 we want to correctly rename it to
+    //       the path a2, but then avoid renaming it again to a3. That is
+    //       why only the top-most renamed ancestor is used.
+    const auto oldAndNew = index.findRenamed(pathToVerify);
+    if (!oldAndNew)
+        return false;
+
+    const SdfPath& oldPath = oldAndNew->first;
+    const SdfPath& newPath = oldAndNew->second;
+    SdfPath        renamedPath = pathToVerify.ReplacePrefix(oldPath, newPath);
+
+    DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
+        "Renaming path %s to %s",
+        pathToVerify.GetAsString().c_str(),
+        renamedPath.GetAsString().c_str()));
+
+    pathToVerify = renamedPath;
+    return true;
 }
 
 // Verify if the given path has already been copied.
-bool isAlreadyCopied(const SdfPath& pathToVerify, MayaUsd::CopyLayerPrimsResult& result)
+bool isAlreadyCopied(const SdfPath& pathToVerify, const CopiedPathsIndex& index)
 {
-    for (const auto& srcAndDest : result.copiedPaths) {
-        const SdfPath& alreadyDone = srcAndDest.first;
-        if (pathToVerify.HasPrefix(alreadyDone)) {
-            DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
-                "Already copied source prim %s, skipping additional copies",
-                pathToVerify.GetAsString().c_str()));
-            return true;
-        }
-    }
-    return false;
+    if (!index.isCopied(pathToVerify))
+        return false;
+
+    DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
+        "Already copied source prim %s, skipping additional copies",
+        pathToVerify.GetAsString().c_str()));
+    return true;
 }
 
 bool isPrimType(const UsdStageRefPtr& stage, const SdfPath& path, const TfToken& desiredType)
@@ -193,7 +243,8 @@ bool copyTraverser(
     std::vector<SdfPath>&                 otherPathsToCopy,
     const MayaUsd::CopyLayerPrimsOptions& options,
     const SdfPath&                        pathToCopy,
-    MayaUsd::CopyLayerPrimsResult&        result)
+    MayaUsd::CopyLayerPrimsResult&        result,
+    CopiedPathsIndex&                     index)
 {
     // Check if the path is a relationship target path. If so, we optionally copy
     // the target since it is used by the prim containing this relationship.
@@ -201,7 +252,7 @@ bool copyTraverser(
         if (options.followRelationships) {
             const SdfPath& targetPath = pathToCopy.GetTargetPath();
             if (!targetPath.IsEmpty()) {
-                if (!isAlreadyCopied(targetPath, result)) {
+                if (!isAlreadyCopied(targetPath, index)) {
                     DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
                         "Adding %s to be copied due to target in %s",
                         targetPath.GetAsString().c_str(),
@@ -223,7 +274,7 @@ bool copyTraverser(
         return true;
     }
 
-    if (isAlreadyCopied(pathToCopy, result)) {
+    if (isAlreadyCopied(pathToCopy, index)) {
         // Note: it may have been copied indirectly, in that case it will not
         //       have been added to the list copied paths, so we want to add
         //       it to the list of copied paths now. It's important that it be
@@ -233,7 +284,7 @@ bool copyTraverser(
         if (result.copiedPaths.count(pathToCopy) == 0) {
             SdfPath dstPath = pathToCopy.ReplacePrefix(srcParentPath, dstParentPath);
             // Verify if the prim that contained this prim was renamed.
-            renamePath(dstPath, result);
+            renamePath(dstPath, index);
             result.copiedPaths[pathToCopy] = dstPath;
         }
 
@@ -266,7 +317,8 @@ bool copyTraverser(
                     otherPathsToCopy,
                     options,
                     childPathToCopy,
-                    result)) {
+                    result,
+                    index)) {
                 return false;
             }
         }
@@ -280,8 +332,11 @@ bool copyTraverser(
 
     // Record the copy and the potential renaming.
     result.copiedPaths[pathToCopy] = dstPath;
-    if (dstPath != origDstPath)
+    index.addCopied(pathToCopy);
+    if (dstPath != origDstPath) {
         result.renamedPaths[origDstPath] = dstPath;
+        index.addRenamed(origDstPath, dstPath);
+    }
 
     const std::string copyingMsg = TfStringPrintf(
         "Copying source prim %s to destination prim %s",
@@ -311,7 +366,8 @@ auto makeCopyTraverser(
     const SdfPath&                        dstParentPath,
     std::vector<SdfPath>&                 otherPathsToCopy,
     const MayaUsd::CopyLayerPrimsOptions& options,
-    MayaUsd::CopyLayerPrimsResult&        result)
+    MayaUsd::CopyLayerPrimsResult&        result,
+    CopiedPathsIndex&                     index)
 {
     auto copyFn = [&srcStage,
                    &srcLayer,
@@ -321,7 +377,8 @@ auto makeCopyTraverser(
                    &dstParentPath,
                    &otherPathsToCopy,
                    &options,
-                   &result](const SdfPath& pathToCopy) -> bool {
+                   &result,
+                   &index](const SdfPath& pathToCopy) -> bool {
         return copyTraverser(
             srcStage,
             srcLayer,
@@ -332,62 +389,50 @@ auto makeCopyTraverser(
             otherPathsToCopy,
             options,
             pathToCopy,
-            result);
+            result,
+            index);
     };
     return copyFn;
 }
 
 // Prim hierarchy traverser (a function called for every SdfSpec starting
 // from a prim to be copied, recursively) that finds every targeting paths.
-bool findTargetingPathsTraverser(
-    const UsdStageRefPtr& dstStage,
-    const SdfPath&        layerSpecPath,
-    std::set<SdfPath>&    targetingPaths)
+//
+// Note: the traversal roots never overlap, so each targeting path is only
+//       found once and can be appended without checking for duplicates.
+auto makeFindTargetingPathsTraverser(SdfPathVector& targetingPaths)
 {
-    // We're only interested in targeting paths.
-    if (!layerSpecPath.IsTargetPath())
-        return true;
+    auto findTargetingFn = [&targetingPaths](const SdfPath& layerSpecPath) -> bool {
+        // We're only interested in targeting paths.
+        if (!layerSpecPath.IsTargetPath())
+            return true;
 
-    SdfPath targetPath = layerSpecPath.GetTargetPath();
+        DEBUG_LOG_COPY_LAYER_PRIMS(
+            TfStringPrintf("Found targeting property %s", layerSpecPath.GetAsString().c_str()));
 
-    if (targetingPaths.count(layerSpecPath))
+        targetingPaths.emplace_back(layerSpecPath);
         return true;
-
-    DEBUG_LOG_COPY_LAYER_PRIMS(
-        TfStringPrintf("Found targeting property %s", layerSpecPath.GetAsString().c_str()));
-
-    targetingPaths.insert(layerSpecPath);
-
-    return true;
-}
-
-// Function to create a find-targeting-path traverser functor that can take
-// a single argument: the path to process. Used to create the function that
-// can be called by the traverseLayer function.
-auto makeFindTargetingPathsTraverser(
-    const UsdStageRefPtr& dstStage,
-    std::set<SdfPath>&    targetingPaths)
-{
-    auto findTargetingFn = [&dstStage, &targetingPaths](const SdfPath& layerSpecPath) -> bool {
-        return findTargetingPathsTraverser(dstStage, layerSpecPath, targetingPaths);
     };
     return findTargetingFn;
 }
 
 // Verify if each target needs to be renamed and rename them if needed.
-void renameTargets(SdfPathVector& targets, const MayaUsd::CopyLayerPrimsResult& result)
+// Returns true if any target was renamed.
+bool renameTargets(SdfPathVector& targets, const CopiedPathsIndex& index)
 {
+    bool renamed = false;
     for (auto& target : targets) {
-        renamePath(target, result);
+        renamed |= renamePath(target, index);
     }
+    return renamed;
 }
 
 // Verify if the targets of the given targeting path need to be renamed based on
 // the known list of renamed prims and rename them if needed.
 void renameTargetingPath(
-    const UsdStageRefPtr&                dstStage,
-    const SdfPath&                       layerSpecPath,
-    const MayaUsd::CopyLayerPrimsResult& result)
+    const UsdStageRefPtr&   dstStage,
+    const SdfPath&          layerSpecPath,
+    const CopiedPathsIndex& index)
 {
     // We're only interested in targeting paths.
     if (!layerSpecPath.IsTargetPath())
@@ -421,8 +466,8 @@ void renameTargetingPath(
         // Modify all targets that were using the old path to now use the new path.
         SdfPathVector targets;
         rel.GetTargets(&targets);
-        renameTargets(targets, result);
-        rel.SetTargets(targets);
+        if (renameTargets(targets, index))
+            rel.SetTargets(targets);
     } else {
         // Retrieve the attribute so we can modify its targets.
         auto attr = prim.GetAttributeAtPath(targetingPath);
@@ -430,8 +475,8 @@ void renameTargetingPath(
             // Modify all targets that were using the old path to now use the new path.
             SdfPathVector targets;
             attr.GetConnections(&targets);
-            renameTargets(targets, result);
-            attr.SetConnections(targets);
+            if (renameTargets(targets, index))
+                attr.SetConnections(targets);
         }
     }
 }
@@ -451,6 +496,7 @@ CopyLayerPrimsResult copyLayerPrims(
     const CopyLayerPrimsOptions& options)
 {
     CopyLayerPrimsResult result;
+    CopiedPathsIndex     index;
 
 #ifdef DEBUG_COPY_LAYER_PRIMS
     std::string layerContentsMsg;
@@ -473,7 +519,8 @@ CopyLayerPrimsResult copyLayerPrims(
         dstParentPath,
         otherPathsToCopy,
         options,
-        result);
+        result,
+        index);
 
     // Traverse the temporary layer starting from the source root path
     // and copy all prims, optionally including the ones targeted by relationships.
@@ -493,13 +540,22 @@ CopyLayerPrimsResult copyLayerPrims(
 
     // Traverse again the destination prims to find all targeting properties
     // so that we can rename their targets if necessary.
-    std::set<SdfPath> targetingPaths;
+    //
+    // Note: prims copied indirectly are also recorded in the copied paths,
+    //       under the prim that was copied, so only traverse the top-most
+    //       destination prims to visit each layer spec a single time.
+    SdfPathVector traversalRoots;
+    traversalRoots.reserve(result.copiedPaths.size());
+    for (const auto& srcAndDest : result.copiedPaths)
+        traversalRoots.emplace_back(srcAndDest.second);
+    SdfPath::RemoveDescendentPaths(&traversalRoots);
+
+    SdfPathVector targetingPaths;
 
-    auto findTargetingsFn = makeFindTargetingPathsTraverser(dstStage, targetingPaths);
+    auto findTargetingsFn = makeFindTargetingPathsTraverser(targetingPaths);
 
-    addProgressSteps(options, result.copiedPaths.size());
-    for (const auto& srcAndDest : result.copiedPaths) {
-        const SdfPath& dstPath = srcAndDest.second;
+    addProgressSteps(options, traversalRoots.size());
+    for (const SdfPath& dstPath : traversalRoots) {
         traverseLayer(dstLayer, dstPath, findTargetingsFn);
         advanceProgress(options);
     }
@@ -511,7 +567,7 @@ CopyLayerPrimsResult copyLayerPrims(
     // to be renamed based on the known list of renamed prims.
     addProgressSteps(options, targetingPaths.size());
     for (const SdfPath& layerSpecPath : targetingPaths) {
-        renameTargetingPath(dstStage, layerSpecPath, result);
+        renameTargetingPath(dstStage, layerSpecPath, index);
         advanceProgress(options);
     }
 
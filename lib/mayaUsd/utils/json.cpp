@@ -65,7 +65,12 @@ PXR_NS::JsValue convertToValue(const MDagPath& path) { return convertToValue(pat
 
 MDagPath convertToDagPath(const PXR_NS::JsValue& value)
 {
-    return PXR_NS::UsdMayaUtil::nameToDagPath(convertToString(value));
+    // An invalid DAG path is written as an empty name, no need to look it up.
+    const std::string name = convertToString(value);
+    if (name.empty())
+        return MDagPath();
+
+    return PXR_NS::UsdMayaUtil::nameToDagPath(name);
 }
 
 PXR_NS::JsArray convertToArray(const PXR_NS::JsValue& value)
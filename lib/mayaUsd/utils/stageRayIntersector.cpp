@@ -0,0 +1,229 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "stageRayIntersector.h"
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/gprim.h>
+#include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <limits>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+//! Builds the hierarchy of the mesh topology and points at \p time.
+std::unique_ptr<MayaUsd::TriangleBVH> _BuildBVH(const UsdGeomMesh& mesh, UsdTimeCode time)
+{
+    VtIntArray   faceVertexCounts;
+    VtIntArray   faceVertexIndices;
+    VtIntArray   holeIndices;
+    VtVec3fArray points;
+    TfToken      orientation = UsdGeomTokens->rightHanded;
+    mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts, time);
+    mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices, time);
+    mesh.GetHoleIndicesAttr().Get(&holeIndices, time);
+    mesh.GetOrientationAttr().Get(&orientation);
+    mesh.GetPointsAttr().Get(&points, time);
+
+    return MayaUsd::TriangleBVH::fromMesh(
+        faceVertexCounts,
+        faceVertexIndices,
+        holeIndices,
+        points,
+        orientation == UsdGeomTokens->leftHanded);
+}
+
+bool _IsTopologyAttribute(const TfToken& name)
+{
+    return name == UsdGeomTokens->faceVertexCounts || name == UsdGeomTokens->faceVertexIndices
+        || name == UsdGeomTokens->holeIndices || name == UsdGeomTokens->orientation;
+}
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+StageRayIntersector::StageRayIntersector(const UsdStageWeakPtr& stage)
+    : _stage(stage)
+{
+    _stageNoticeListener.SetStage(stage);
+    _stageNoticeListener.SetStageObjectsChangedCallback(
+        [this](const UsdNotice::ObjectsChanged& notice) { _onObjectsChanged(notice); });
+}
+
+bool StageRayIntersector::intersect(
+    const GfRay&   ray,
+    const Options& options,
+    Hit*           hit,
+    bool*          skippedGprims)
+{
+    if (skippedGprims) {
+        *skippedGprims = false;
+    }
+    if (!_stage) {
+        return false;
+    }
+    const UsdPrim root = _stage->GetPrimAtPath(options.rootPath);
+    if (!root) {
+        return false;
+    }
+
+    const SdfPathSet excludedPaths(options.excludedPaths.begin(), options.excludedPaths.end());
+    UsdGeomXformCache xformCache(options.time);
+
+    double closest = std::numeric_limits<double>::infinity();
+    bool   found = false;
+
+    UsdPrimRange range(root, UsdTraverseInstanceProxies());
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        const UsdPrim& prim = *it;
+        if (excludedPaths.count(prim.GetPath()) > 0) {
+            it.PruneChildren();
+            continue;
+        }
+
+        // Visibility and purpose are inherited: skip the whole subtree.
+        const UsdGeomImageable imageable(prim);
+        if (imageable) {
+            TfToken visibility;
+            imageable.GetVisibilityAttr().Get(&visibility, options.time);
+            TfToken purpose;
+            imageable.GetPurposeAttr().Get(&purpose);
+            if (visibility == UsdGeomTokens->invisible
+                || (purpose == UsdGeomTokens->render && !options.renderPurpose)
+                || (purpose == UsdGeomTokens->proxy && !options.proxyPurpose)
+                || (purpose == UsdGeomTokens->guide && !options.guidePurpose)) {
+                it.PruneChildren();
+                continue;
+            }
+        }
+
+        if (!prim.IsA<UsdGeomMesh>()) {
+            if (skippedGprims && prim.IsA<UsdGeomGprim>()) {
+                *skippedGprims = true;
+            }
+            continue;
+        }
+        const TriangleBVH* bvh = _getBVH(prim, options.time);
+        if (!bvh) {
+            continue;
+        }
+
+        const GfMatrix4d localToWorld = xformCache.GetLocalToWorldTransform(prim);
+        double           determinant = 0.0;
+        const GfMatrix4d worldToLocal = localToWorld.GetInverse(&determinant);
+        if (determinant == 0.0) {
+            continue;
+        }
+
+        // The transformed ray keeps the same parameterization, so distances of
+        // hits in different meshes can be compared.
+        GfRay localRay = ray;
+        localRay.Transform(worldToLocal);
+        TriangleBVH::Hit localHit;
+        if (!bvh->intersect(localRay, &localHit) || localHit.distance >= closest) {
+            continue;
+        }
+
+        closest = localHit.distance;
+        found = true;
+        if (hit) {
+            hit->distance = localHit.distance;
+            hit->point = ray.GetPoint(localHit.distance);
+            hit->normal = worldToLocal.GetTranspose().TransformDir(localHit.normal).GetNormalized();
+            hit->primPath = prim.GetPath();
+        }
+    }
+    return found;
+}
+
+const TriangleBVH* StageRayIntersector::_getBVH(const UsdPrim& prim, UsdTimeCode time)
+{
+    // Instances share the hierarchy of their prototype, which is also where
+    // the stage reports their changes.
+    const UsdPrim     meshPrim = prim.IsInstanceProxy() ? prim.GetPrimInPrototype() : prim;
+    const UsdGeomMesh mesh(meshPrim);
+
+    auto it = _meshes.find(meshPrim.GetPath());
+    if (it != _meshes.end()) {
+        _Mesh& entry = it->second;
+        if (!entry.pointsDirty && (!entry.timeVarying || entry.time == time)) {
+            return entry.bvh.get();
+        }
+
+        // Only the points changed: refit the hierarchy if the topology still matches.
+        VtVec3fArray       points;
+        const UsdAttribute pointsAttr = mesh.GetPointsAttr();
+        pointsAttr.Get(&points, time);
+        if (entry.bvh && entry.bvh->refit(points)) {
+            entry.time = time;
+            entry.timeVarying = pointsAttr.ValueMightBeTimeVarying();
+            entry.pointsDirty = false;
+            return entry.bvh.get();
+        }
+        _meshes.erase(it);
+    }
+
+    _Mesh entry;
+    entry.bvh = _BuildBVH(mesh, time);
+    entry.time = time;
+    entry.timeVarying = mesh.GetPointsAttr().ValueMightBeTimeVarying();
+    // Invalid meshes are kept too, so that they are not triangulated again
+    // at each query.
+    return _meshes.emplace(meshPrim.GetPath(), std::move(entry)).first->second.bvh.get();
+}
+
+void StageRayIntersector::_onObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+{
+    if (_meshes.empty()) {
+        return;
+    }
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (path.IsPropertyPath()) {
+            _meshes.erase(path.GetPrimPath());
+            continue;
+        }
+        // Descendants sort right after their ancestor: drop the subtree.
+        auto it = _meshes.lower_bound(path);
+        while (it != _meshes.end() && it->first.HasPrefix(path)) {
+            it = _meshes.erase(it);
+        }
+    }
+
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (!path.IsPropertyPath()) {
+            continue;
+        }
+        auto it = _meshes.find(path.GetPrimPath());
+        if (it == _meshes.end()) {
+            continue;
+        }
+        const TfToken& name = path.GetNameToken();
+        if (name == UsdGeomTokens->points) {
+            it->second.pointsDirty = true;
+        } else if (_IsTopologyAttribute(name)) {
+            _meshes.erase(it);
+        }
+    }
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,110 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_STAGE_RAY_INTERSECTOR_H
+#define MAYAUSD_STAGE_RAY_INTERSECTOR_H
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/listeners/stageNoticeListener.h>
+#include <mayaUsd/utils/triangleBVH.h>
+
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <map>
+#include <memory>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief  CPU ray queries against the meshes of a USD stage.
+
+    The triangle hierarchy of each mesh is built the first time a ray reaches
+    it, and kept until the stage changes it: a change of the points refits the
+    hierarchy at the next query, a change of the topology or a resync of the
+    mesh or one of its ancestors drops it to be built again. Meshes of
+    instances share the hierarchy of their prototype.
+
+    Rays, hit points and normals are in the space of the stage.
+*/
+class StageRayIntersector
+{
+public:
+    //! Prims considered by the queries.
+    struct Options
+    {
+        PXR_NS::UsdTimeCode   time { PXR_NS::UsdTimeCode::Default() };
+        PXR_NS::SdfPath       rootPath { PXR_NS::SdfPath::AbsoluteRootPath() };
+        PXR_NS::SdfPathVector excludedPaths;
+        bool                  renderPurpose { false };
+        bool                  proxyPurpose { true };
+        bool                  guidePurpose { false };
+    };
+
+    //! Closest intersection of a ray.
+    struct Hit
+    {
+        double          distance { 0.0 };
+        PXR_NS::GfVec3d point;
+        PXR_NS::GfVec3d normal;
+        PXR_NS::SdfPath primPath;
+    };
+
+    MAYAUSD_CORE_PUBLIC
+    explicit StageRayIntersector(const PXR_NS::UsdStageWeakPtr& stage);
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(StageRayIntersector);
+
+    const PXR_NS::UsdStageWeakPtr& getStage() const { return _stage; }
+
+    /*! \brief  Finds the closest intersection of \p ray with the meshes selected by \p options.
+
+        Other gprims are not intersected. If given, \p skippedGprims is set to
+        whether any of them was selected by \p options.
+    */
+    MAYAUSD_CORE_PUBLIC
+    bool intersect(
+        const PXR_NS::GfRay& ray,
+        const Options&       options,
+        Hit*                 hit,
+        bool*                skippedGprims = nullptr);
+
+    //! Number of meshes with a cached hierarchy.
+    size_t getCachedMeshCount() const { return _meshes.size(); }
+
+private:
+    struct _Mesh
+    {
+        std::unique_ptr<TriangleBVH> bvh;
+        PXR_NS::UsdTimeCode          time;
+        bool                         timeVarying { false };
+        bool                         pointsDirty { false };
+    };
+
+    const TriangleBVH* _getBVH(const PXR_NS::UsdPrim& prim, PXR_NS::UsdTimeCode time);
+
+    void _onObjectsChanged(const PXR_NS::UsdNotice::ObjectsChanged& notice);
+
+    PXR_NS::UsdStageWeakPtr            _stage;
+    PXR_NS::UsdMayaStageNoticeListener _stageNoticeListener;
+    std::map<PXR_NS::SdfPath, _Mesh>   _meshes;
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -0,0 +1,255 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "triangleBVH.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+//! Maximum number of triangles in a leaf.
+constexpr uint32_t kMaxLeafSize = 4;
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+std::unique_ptr<TriangleBVH> TriangleBVH::fromMesh(
+    const VtIntArray&   faceVertexCounts,
+    const VtIntArray&   faceVertexIndices,
+    const VtIntArray&   holeIndices,
+    const VtVec3fArray& points,
+    bool                leftHanded)
+{
+    std::vector<bool> isHole(faceVertexCounts.size(), false);
+    for (const int hole : holeIndices) {
+        if (hole >= 0 && size_t(hole) < isHole.size()) {
+            isHole[hole] = true;
+        }
+    }
+
+    std::vector<int> triangles;
+    triangles.reserve(faceVertexIndices.size() * 3);
+    const int numPoints = static_cast<int>(points.size());
+    size_t    offset = 0;
+    for (size_t face = 0; face < faceVertexCounts.size(); ++face) {
+        const int count = faceVertexCounts[face];
+        if (count < 0 || offset + count > faceVertexIndices.size()) {
+            return nullptr;
+        }
+        const int* indices = faceVertexIndices.cdata() + offset;
+        offset += count;
+        for (int i = 0; i < count; ++i) {
+            if (indices[i] < 0 || indices[i] >= numPoints) {
+                return nullptr;
+            }
+        }
+        if (count < 3 || isHole[face]) {
+            continue;
+        }
+        for (int i = 1; i + 1 < count; ++i) {
+            triangles.push_back(indices[0]);
+            triangles.push_back(indices[i]);
+            triangles.push_back(indices[i + 1]);
+        }
+    }
+
+    return std::make_unique<TriangleBVH>(points, std::move(triangles), leftHanded);
+}
+
+TriangleBVH::TriangleBVH(
+    const VtVec3fArray& points,
+    std::vector<int>&&  triangleIndices,
+    bool                leftHanded)
+    : _points(points)
+    , _triangleIndices(std::move(triangleIndices))
+    , _leftHanded(leftHanded)
+{
+    const uint32_t numTriangles = static_cast<uint32_t>(getTriangleCount());
+    if (numTriangles == 0) {
+        return;
+    }
+
+    std::vector<GfVec3f> centroids(numTriangles);
+    for (uint32_t triangle = 0; triangle < numTriangles; ++triangle) {
+        const int* indices = &_triangleIndices[triangle * 3];
+        centroids[triangle]
+            = (_points[indices[0]] + _points[indices[1]] + _points[indices[2]]) / 3.0f;
+    }
+
+    _triangleOrder.resize(numTriangles);
+    std::iota(_triangleOrder.begin(), _triangleOrder.end(), 0u);
+    // A binary tree with leaves of at least one triangle.
+    _nodes.reserve(2 * numTriangles);
+    _build(0, numTriangles, centroids);
+}
+
+uint32_t
+TriangleBVH::_build(uint32_t begin, uint32_t end, const std::vector<GfVec3f>& centroids)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    GfRange3f bounds;
+    GfRange3f centroidBounds;
+    for (uint32_t i = begin; i < end; ++i) {
+        bounds.UnionWith(_triangleBounds(_triangleOrder[i]));
+        centroidBounds.UnionWith(centroids[_triangleOrder[i]]);
+    }
+    _nodes[nodeIndex].bounds = bounds;
+
+    // Split at the median of the longest axis of the centroids, unless they
+    // all are at the same place.
+    const GfVec3f size = centroidBounds.GetSize();
+    const int     axis = size[0] >= size[1] ? (size[0] >= size[2] ? 0 : 2)
+                                            : (size[1] >= size[2] ? 1 : 2);
+    if (end - begin <= kMaxLeafSize || size[axis] <= 0.0f) {
+        _nodes[nodeIndex].offset = begin;
+        _nodes[nodeIndex].count = end - begin;
+        return nodeIndex;
+    }
+
+    const uint32_t middle = begin + (end - begin) / 2;
+    std::nth_element(
+        _triangleOrder.begin() + begin,
+        _triangleOrder.begin() + middle,
+        _triangleOrder.begin() + end,
+        [&centroids, axis](uint32_t a, uint32_t b) {
+            return centroids[a][axis] < centroids[b][axis];
+        });
+
+    _build(begin, middle, centroids);
+    const uint32_t secondChild = _build(middle, end, centroids);
+    _nodes[nodeIndex].offset = secondChild;
+    return nodeIndex;
+}
+
+GfRange3f TriangleBVH::_triangleBounds(uint32_t triangle) const
+{
+    const int* indices = &_triangleIndices[triangle * 3];
+    GfRange3f  bounds(_points[indices[0]], _points[indices[0]]);
+    bounds.UnionWith(_points[indices[1]]);
+    bounds.UnionWith(_points[indices[2]]);
+    return bounds;
+}
+
+bool TriangleBVH::refit(const VtVec3fArray& points)
+{
+    if (points.size() != _points.size()) {
+        return false;
+    }
+    _points = points;
+
+    // Children always follow their parent, so a reverse walk updates the
+    // children before their parent.
+    for (size_t i = _nodes.size(); i-- > 0;) {
+        _Node& node = _nodes[i];
+        if (node.count > 0) {
+            GfRange3f bounds;
+            for (uint32_t t = node.offset; t < node.offset + node.count; ++t) {
+                bounds.UnionWith(_triangleBounds(_triangleOrder[t]));
+            }
+            node.bounds = bounds;
+        } else {
+            node.bounds = GfRange3f::GetUnion(_nodes[i + 1].bounds, _nodes[node.offset].bounds);
+        }
+    }
+    return true;
+}
+
+bool TriangleBVH::intersect(const GfRay& ray, Hit* hit) const
+{
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    double   closest = std::numeric_limits<double>::infinity();
+    uint32_t closestTriangle = 0;
+    bool     found = false;
+
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const uint32_t nodeIndex = stack.back();
+        const _Node&   node = _nodes[nodeIndex];
+        stack.pop_back();
+
+        double enter = 0.0;
+        double exit = 0.0;
+        if (!ray.Intersect(
+                GfRange3d(GfVec3d(node.bounds.GetMin()), GfVec3d(node.bounds.GetMax())),
+                &enter,
+                &exit)
+            || exit < 0.0 || enter > closest) {
+            continue;
+        }
+
+        if (node.count == 0) {
+            stack.push_back(node.offset);
+            stack.push_back(nodeIndex + 1);
+            continue;
+        }
+
+        for (uint32_t t = node.offset; t < node.offset + node.count; ++t) {
+            const uint32_t triangle = _triangleOrder[t];
+            const int*     indices = &_triangleIndices[triangle * 3];
+            double         distance = 0.0;
+            if (ray.Intersect(
+                    GfVec3d(_points[indices[0]]),
+                    GfVec3d(_points[indices[1]]),
+                    GfVec3d(_points[indices[2]]),
+                    &distance,
+                    nullptr,
+                    nullptr,
+                    closest)
+                && distance < closest) {
+                closest = distance;
+                closestTriangle = triangle;
+                found = true;
+            }
+        }
+    }
+
+    if (found && hit) {
+        const int*    indices = &_triangleIndices[closestTriangle * 3];
+        const GfVec3d p0(_points[indices[0]]);
+        const GfVec3d p1(_points[indices[1]]);
+        const GfVec3d p2(_points[indices[2]]);
+        GfVec3d       normal = GfCross(p1 - p0, p2 - p0);
+        normal.Normalize();
+
+        hit->distance = closest;
+        hit->point = ray.GetPoint(closest);
+        hit->normal = _leftHanded ? -normal : normal;
+        hit->triangle = closestTriangle;
+    }
+    return found;
+}
+
+GfRange3d TriangleBVH::getBounds() const
+{
+    if (_nodes.empty()) {
+        return GfRange3d();
+    }
+    const GfRange3f& bounds = _nodes[0].bounds;
+    return GfRange3d(GfVec3d(bounds.GetMin()), GfVec3d(bounds.GetMax()));
+}
+
+} // namespace MAYAUSD_NS_DEF
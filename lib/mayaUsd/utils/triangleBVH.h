@@ -0,0 +1,125 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_TRIANGLE_BVH_H
+#define MAYAUSD_TRIANGLE_BVH_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief  Bounding volume hierarchy over the triangles of a mesh, for CPU ray queries.
+
+    The hierarchy is built once from the triangulated topology. When only the
+    points change, refit() updates the bounds of the existing hierarchy in
+    linear time instead of building it again.
+*/
+class TriangleBVH
+{
+public:
+    //! Closest intersection of a ray, in the space of the mesh points.
+    struct Hit
+    {
+        double          distance { 0.0 };
+        PXR_NS::GfVec3d point;
+        PXR_NS::GfVec3d normal;
+        size_t          triangle { 0 };
+    };
+
+    /*! \brief  Triangulates a polygonal mesh and builds its hierarchy.
+
+        Faces are fan triangulated, faces with fewer than three vertices and
+        faces listed in \p holeIndices are skipped. Hit normals point out of the
+        front faces, whose winding is given by \p leftHanded. Returns nullptr if
+        the topology is invalid for \p points.
+    */
+    MAYAUSD_CORE_PUBLIC
+    static std::unique_ptr<TriangleBVH> fromMesh(
+        const PXR_NS::VtIntArray&   faceVertexCounts,
+        const PXR_NS::VtIntArray&   faceVertexIndices,
+        const PXR_NS::VtIntArray&   holeIndices,
+        const PXR_NS::VtVec3fArray& points,
+        bool                        leftHanded = false);
+
+    /*! \brief  Builds the hierarchy of the triangles given by three point indices each.
+
+        The indices must be valid for \p points.
+    */
+    MAYAUSD_CORE_PUBLIC
+    TriangleBVH(
+        const PXR_NS::VtVec3fArray& points,
+        std::vector<int>&&          triangleIndices,
+        bool                        leftHanded = false);
+
+    /*! \brief  Updates the bounds for new positions of the same points.
+
+        Returns false, leaving the hierarchy unchanged, if the number of points
+        differs from the one the hierarchy was built with.
+    */
+    MAYAUSD_CORE_PUBLIC
+    bool refit(const PXR_NS::VtVec3fArray& points);
+
+    //! Finds the closest intersection of \p ray in front of its origin.
+    MAYAUSD_CORE_PUBLIC
+    bool intersect(const PXR_NS::GfRay& ray, Hit* hit) const;
+
+    //! Bounds of all the triangles.
+    MAYAUSD_CORE_PUBLIC
+    PXR_NS::GfRange3d getBounds() const;
+
+    size_t getTriangleCount() const { return _triangleIndices.size() / 3; }
+    size_t getPointCount() const { return _points.size(); }
+    size_t getNodeCount() const { return _nodes.size(); }
+
+    //! Triangles in the order of the leaves, which only a build changes.
+    const std::vector<uint32_t>& getTriangleOrder() const { return _triangleOrder; }
+
+private:
+    struct _Node
+    {
+        PXR_NS::GfRange3f bounds;
+        // First triangle of a leaf, or index of the second child of an inner
+        // node. The first child of an inner node always follows it.
+        uint32_t offset { 0 };
+        // Number of triangles of a leaf, zero for an inner node.
+        uint32_t count { 0 };
+    };
+
+    uint32_t _build(uint32_t begin, uint32_t end, const std::vector<PXR_NS::GfVec3f>& centroids);
+
+    PXR_NS::GfRange3f _triangleBounds(uint32_t triangle) const;
+
+    PXR_NS::VtVec3fArray _points;
+    std::vector<int>     _triangleIndices;
+    // Triangles in leaf order, the leaves reference ranges of this vector.
+    std::vector<uint32_t> _triangleOrder;
+    std::vector<_Node>    _nodes;
+    bool                  _leftHanded { false };
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
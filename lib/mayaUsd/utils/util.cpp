@@ -77,6 +77,8 @@
 #include <maya/MTime.h>
 
 #include <boost/functional/hash.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 #include <cctype>
 #include <regex>
@@ -1048,34 +1050,78 @@ static void _MergeEquivalentIndexedValues(VtArray<T>* valueData, VtIntArray* ass
         return;
     }
 
-    // We maintain a map of values to that value's index in our uniqueValues
-    // array.
-    std::unordered_map<T, size_t, _ValuesHash<T>, _ValuesEqual<T>> valuesMap;
-    VtArray<T>                                                     uniqueValues;
-    VtIntArray                                                     uniqueIndices;
+    const VtArray<T>& values = *valueData;
+    const VtIntArray& indices = *assignmentIndices;
 
-    for (int index : *assignmentIndices) {
+    // Hashing is independent for each value, so it is done up front in
+    // parallel. Assigning the unique indices must stay sequential, since the
+    // unique values are ordered by their first use in the assignment indices.
+    std::vector<size_t> hashes(numValues);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numValues, 4096),
+        [&](const tbb::blocked_range<size_t>& range) {
+            const _ValuesHash<T> hasher;
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                hashes[i] = hasher(values[i]);
+            }
+        });
+
+    // We maintain a map of value hashes to the index of the first unique value
+    // with that hash. Unique values with the same hash are chained, in order.
+    std::unordered_map<size_t, int> firstUniqueForHash;
+    std::vector<int>                nextUniqueWithSameHash;
+    std::vector<int>                uniqueForValue(numValues, -1);
+    VtArray<T>                      uniqueValues;
+    VtIntArray                      uniqueIndices(indices.size());
+    const _ValuesEqual<T>           equal;
+
+    firstUniqueForHash.reserve(numValues);
+    nextUniqueWithSameHash.reserve(numValues);
+    uniqueValues.reserve(numValues);
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const int index = indices[i];
         if (index < 0 || static_cast<size_t>(index) >= numValues) {
             // This is an unassigned or otherwise unknown index, so just keep it.
-            uniqueIndices.push_back(index);
+            uniqueIndices[i] = index;
             continue;
         }
 
-        const T value = (*valueData)[index];
+        // Values are often referenced by more than one face vertex.
+        int& uniqueIndex = uniqueForValue[index];
+        if (uniqueIndex < 0) {
+            const T& value = values[index];
 
-        int uniqueIndex = -1;
+            auto inserted = firstUniqueForHash.insert(
+                std::make_pair(hashes[index], static_cast<int>(uniqueValues.size())));
+            if (inserted.second) {
+                // This is a new value, so add it to the array.
+                uniqueIndex = static_cast<int>(uniqueValues.size());
+            } else {
+                // Look for an existing equivalent value with the same hash.
+                int candidate = inserted.first->second;
+                int last = candidate;
+                while (candidate >= 0 && !equal(uniqueValues[candidate], value)) {
+                    last = candidate;
+                    candidate = nextUniqueWithSameHash[candidate];
+                }
+                if (candidate >= 0) {
+                    // This is an existing value, so re-use the original's index.
+                    uniqueIndex = candidate;
+                } else {
+                    // This is a new value whose hash collides with another one.
+                    uniqueIndex = static_cast<int>(uniqueValues.size());
+                    nextUniqueWithSameHash[last] = uniqueIndex;
+                }
+            }
 
-        auto inserted = valuesMap.insert(std::pair<T, size_t>(value, uniqueValues.size()));
-        if (inserted.second) {
-            // This is a new value, so add it to the array.
-            uniqueValues.push_back(value);
-            uniqueIndex = uniqueValues.size() - 1;
-        } else {
-            // This is an existing value, so re-use the original's index.
-            uniqueIndex = inserted.first->second;
+            if (uniqueIndex == static_cast<int>(uniqueValues.size())) {
+                uniqueValues.push_back(value);
+                nextUniqueWithSameHash.push_back(-1);
+            }
         }
 
-        uniqueIndices.push_back(uniqueIndex);
+        uniqueIndices[i] = uniqueIndex;
     }
 
     // If we reduced the number of values by merging, copy the results back.
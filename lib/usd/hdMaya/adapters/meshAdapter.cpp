@@ -215,6 +215,8 @@ public:
         return 0;
     }
 
+    bool HasPointsMotionSamples() override { return true; }
+
     HdMeshTopology GetMeshTopology() override
     {
         MFnMesh    mesh(GetDagPath());
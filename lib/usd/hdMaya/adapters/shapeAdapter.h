@@ -35,6 +35,10 @@ public:
     HDMAYA_API
     virtual size_t
     SamplePrimvar(const TfToken& key, size_t maxSampleCount, float* times, VtValue* samples);
+    /// True if SamplePrimvar samples the points over the shutter, which are then
+    /// evaluated with Get(HdTokens->points) at each sample time.
+    HDMAYA_API
+    virtual bool HasPointsMotionSamples() { return false; }
     HDMAYA_API
     virtual HdMeshTopology GetMeshTopology();
     HDMAYA_API
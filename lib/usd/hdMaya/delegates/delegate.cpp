@@ -40,4 +40,26 @@ GfInterval HdMayaDelegate::GetCurrentTimeSamplingInterval() const
     return GfInterval(_params.motionSampleStart, _params.motionSampleEnd);
 }
 
+std::vector<double> HdMayaDelegate::GetSampleTimes(size_t maxSampleCount) const
+{
+    if (maxSampleCount == 0) {
+        return {};
+    }
+    if (maxSampleCount == 1
+        || (!GetParams().motionSamplesEnabled() && GetParams().motionSampleStart == 0)) {
+        return { 0.0 };
+    }
+
+    const GfInterval shutter = GetCurrentTimeSamplingInterval();
+    // Shutter for [-1, 1] (size 2) should have a step of 2 for 2 samples, and 1 for 3 samples.
+    const double        tStep = shutter.GetSize() / (maxSampleCount - 1);
+    std::vector<double> sampleTimes(maxSampleCount);
+    double              relTime = shutter.GetMin();
+    for (auto& sampleTime : sampleTimes) {
+        sampleTime = relTime;
+        relTime += tStep;
+    }
+    return sampleTimes;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
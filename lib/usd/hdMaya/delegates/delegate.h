@@ -39,6 +39,7 @@
 #include <ufe/selection.h>
 
 #include <memory>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -132,6 +133,12 @@ public:
     HDMAYA_API
     GfInterval GetCurrentTimeSamplingInterval() const;
 
+    /// Returns the shutter relative times of the motion samples to evaluate for
+    /// \p maxSampleCount samples, or a single sample at the current frame if
+    /// motion samples are disabled.
+    HDMAYA_API
+    std::vector<double> GetSampleTimes(size_t maxSampleCount) const;
+
     /// Common function to return templated sample types
     template <typename T, typename Getter>
     size_t SampleValues(size_t maxSampleCount, float* times, T* samples, Getter getValue)
@@ -139,24 +146,17 @@ public:
         if (ARCH_UNLIKELY(maxSampleCount == 0)) {
             return 0;
         }
+        const std::vector<double> sampleTimes = GetSampleTimes(maxSampleCount);
         // Fast path 1 sample at current-frame
-        if (maxSampleCount == 1
-            || (!GetParams().motionSamplesEnabled() && GetParams().motionSampleStart == 0)) {
+        if (sampleTimes.size() == 1) {
             times[0] = 0.0f;
             samples[0] = getValue();
             return 1;
         }
 
-        const GfInterval shutter = GetCurrentTimeSamplingInterval();
-        // Shutter for [-1, 1] (size 2) should have a step of 2 for 2 samples, and 1 for 3 samples
-        // For sample size of 1 tStep is unused and we match USD and to provide t=shutterOpen
-        // sample.
-        const double tStep = maxSampleCount > 1 ? (shutter.GetSize() / (maxSampleCount - 1)) : 0;
-        const MTime  mayaTime = MAnimControl::currentTime();
-        size_t       nSamples = 0;
-        double       relTime = shutter.GetMin();
-
-        for (size_t i = 0; i < maxSampleCount; ++i) {
+        const MTime mayaTime = MAnimControl::currentTime();
+        size_t      nSamples = 0;
+        for (const double relTime : sampleTimes) {
             T sample;
             {
                 MDGContextGuard guard(mayaTime + relTime);
@@ -169,7 +169,6 @@ public:
                 times[nSamples] = relTime;
                 ++nSamples;
             }
-            relTime += tStep;
         }
         return nSamples;
     }
@@ -0,0 +1,86 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "materialRprimIndex.h"
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+void HdMayaMaterialRprimIndex::SetMaterial(const SdfPath& rprimId, const SdfPath& materialId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _rprimToMaterial.find(rprimId);
+    if (it != _rprimToMaterial.end()) {
+        if (it->second == materialId) {
+            return;
+        }
+        _RemoveRprim(rprimId);
+    }
+
+    // Rprims without material are not tracked.
+    if (materialId.IsEmpty()) {
+        return;
+    }
+    _rprimToMaterial.emplace(rprimId, materialId);
+    _materialToRprims[materialId].insert(rprimId);
+}
+
+void HdMayaMaterialRprimIndex::RemoveRprim(const SdfPath& rprimId)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _RemoveRprim(rprimId);
+}
+
+SdfPathVector HdMayaMaterialRprimIndex::GetRprims(const SdfPath& materialId) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    SdfPathVector ret;
+    auto          it = _materialToRprims.find(materialId);
+    if (it != _materialToRprims.end()) {
+        ret.assign(it->second.begin(), it->second.end());
+        // Same order as the render index rprim ids.
+        std::sort(ret.begin(), ret.end());
+    }
+    return ret;
+}
+
+void HdMayaMaterialRprimIndex::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _rprimToMaterial.clear();
+    _materialToRprims.clear();
+}
+
+void HdMayaMaterialRprimIndex::_RemoveRprim(const SdfPath& rprimId)
+{
+    auto it = _rprimToMaterial.find(rprimId);
+    if (it == _rprimToMaterial.end()) {
+        return;
+    }
+
+    auto rprimsIt = _materialToRprims.find(it->second);
+    if (rprimsIt != _materialToRprims.end()) {
+        rprimsIt->second.erase(rprimId);
+        if (rprimsIt->second.empty()) {
+            _materialToRprims.erase(rprimsIt);
+        }
+    }
+    _rprimToMaterial.erase(it);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
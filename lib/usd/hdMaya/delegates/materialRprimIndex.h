@@ -0,0 +1,68 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HDMAYA_MATERIAL_RPRIM_INDEX_H
+#define HDMAYA_MATERIAL_RPRIM_INDEX_H
+
+#include <hdMaya/api.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \brief Reverse index of the material bound to each rprim.
+///
+/// The scene delegate records the material id it returns for each rprim, so
+/// that the rprims using a material are found without scanning every rprim
+/// of the render index. Materials are recorded while rprims sync, which can
+/// happen on several threads, so the index is guarded by a mutex.
+class HdMayaMaterialRprimIndex
+{
+public:
+    /// \brief Records that \p rprimId uses \p materialId, replacing the
+    /// material previously recorded for it.
+    HDMAYA_API
+    void SetMaterial(const SdfPath& rprimId, const SdfPath& materialId);
+
+    /// \brief Forgets the material of \p rprimId.
+    HDMAYA_API
+    void RemoveRprim(const SdfPath& rprimId);
+
+    /// \brief Returns the rprims recorded as using \p materialId, sorted.
+    HDMAYA_API
+    SdfPathVector GetRprims(const SdfPath& materialId) const;
+
+    /// \brief Forgets all the rprims.
+    HDMAYA_API
+    void Clear();
+
+private:
+    void _RemoveRprim(const SdfPath& rprimId);
+
+    using _RprimSet = std::unordered_set<SdfPath, SdfPath::Hash>;
+
+    mutable std::mutex                                    _mutex;
+    std::unordered_map<SdfPath, SdfPath, SdfPath::Hash>   _rprimToMaterial;
+    std::unordered_map<SdfPath, _RprimSet, SdfPath::Hash> _materialToRprims;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HDMAYA_MATERIAL_RPRIM_INDEX_H
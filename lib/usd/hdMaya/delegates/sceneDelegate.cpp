@@ -257,13 +257,8 @@ void HdMayaSceneDelegate::PreFrame(const MHWRender::MDrawContext& context)
                         id,
                         [](HdMayaMaterialAdapter* a) { return a->UpdateMaterialTag(); },
                         _materialAdapters)) {
-                    auto& renderIndex = GetRenderIndex();
-                    for (const auto& rprimId : renderIndex.GetRprimIds()) {
-                        const auto* rprim = renderIndex.GetRprim(rprimId);
-                        if (rprim != nullptr && rprim->GetMaterialId() == id) {
-                            RebuildAdapterOnIdle(
-                                rprim->GetId(), HdMayaDelegateCtx::RebuildFlagPrim);
-                        }
+                    for (const auto& rprimId : GetRprimsUsingMaterial(id)) {
+                        RebuildAdapterOnIdle(rprimId, HdMayaDelegateCtx::RebuildFlagPrim);
                     }
                 }
             }
@@ -298,30 +293,23 @@ void HdMayaSceneDelegate::PreFrame(const MHWRender::MDrawContext& context)
         _addedNodes.clear();
     }
     // We don't need to rebuild something that's already being recreated.
-    // Since we have a few elements, linear search over vectors is going to
-    // be okay.
     if (!_adaptersToRecreate.empty()) {
         for (const auto& it : _adaptersToRecreate) {
-            RecreateAdapter(std::get<0>(it), std::get<1>(it));
-            for (auto itr = _adaptersToRebuild.begin(); itr != _adaptersToRebuild.end(); ++itr) {
-                if (std::get<0>(it) == std::get<0>(*itr)) {
-                    _adaptersToRebuild.erase(itr);
-                    break;
-                }
-            }
+            RecreateAdapter(it.first, it.second);
+            _adaptersToRebuild.erase(it.first);
         }
         _adaptersToRecreate.clear();
     }
     if (!_adaptersToRebuild.empty()) {
         for (const auto& it : _adaptersToRebuild) {
             _FindAdapter<HdMayaAdapter>(
-                std::get<0>(it),
+                it.first,
                 [&](HdMayaAdapter* a) {
-                    if (std::get<1>(it) & HdMayaDelegateCtx::RebuildFlagCallbacks) {
+                    if (it.second & HdMayaDelegateCtx::RebuildFlagCallbacks) {
                         a->RemoveCallbacks();
                         a->CreateCallbacks();
                     }
-                    if (std::get<1>(it) & HdMayaDelegateCtx::RebuildFlagPrim) {
+                    if (it.second & HdMayaDelegateCtx::RebuildFlagPrim) {
                         a->RemovePrim();
                         a->Populate();
                     }
@@ -332,6 +320,7 @@ void HdMayaSceneDelegate::PreFrame(const MHWRender::MDrawContext& context)
         }
         _adaptersToRebuild.clear();
     }
+    _EvaluateMotionSamples();
     if (!IsHdSt()) {
         return;
     }
@@ -382,41 +371,20 @@ void HdMayaSceneDelegate::RemoveAdapter(const SdfPath& id)
             _materialAdapters)) {
         TF_WARN("HdMayaSceneDelegate::RemoveAdapter(%s) -- Adapter does not exists", id.GetText());
     }
+    _materialRprims.RemoveRprim(id);
 }
 
 void HdMayaSceneDelegate::RecreateAdapterOnIdle(const SdfPath& id, const MObject& obj)
 {
     // TODO: Thread safety?
-    // We expect this to be a small number of objects, so using a simple linear
-    // search and a vector is generally a good choice.
-    for (auto& it : _adaptersToRecreate) {
-        if (std::get<0>(it) == id) {
-            std::get<1>(it) = obj;
-            return;
-        }
-    }
-    _adaptersToRecreate.emplace_back(id, obj);
+    _adaptersToRecreate[id] = obj;
 }
 
-void HdMayaSceneDelegate::MaterialTagChanged(const SdfPath& id)
-{
-    if (std::find(_materialTagsChanged.begin(), _materialTagsChanged.end(), id)
-        == _materialTagsChanged.end()) {
-        _materialTagsChanged.push_back(id);
-    }
-}
+void HdMayaSceneDelegate::MaterialTagChanged(const SdfPath& id) { _materialTagsChanged.insert(id); }
 
 void HdMayaSceneDelegate::RebuildAdapterOnIdle(const SdfPath& id, uint32_t flags)
 {
-    // We expect this to be a small number of objects, so using a simple linear
-    // search and a vector is generally a good choice.
-    for (auto& it : _adaptersToRebuild) {
-        if (std::get<0>(it) == id) {
-            std::get<1>(it) |= flags;
-            return;
-        }
-    }
-    _adaptersToRebuild.emplace_back(id, flags);
+    _adaptersToRebuild[id] |= flags;
 }
 
 void HdMayaSceneDelegate::RecreateAdapter(const SdfPath& id, const MObject& obj)
@@ -429,6 +397,7 @@ void HdMayaSceneDelegate::RecreateAdapter(const SdfPath& id, const MObject& obj)
             },
             _shapeAdapters,
             _lightAdapters)) {
+        _materialRprims.RemoveRprim(id);
         MFnDagNode dgNode(obj);
         MDagPath   path;
         dgNode.getPath(path);
@@ -455,13 +424,9 @@ void HdMayaSceneDelegate::RecreateAdapter(const SdfPath& id, const MObject& obj)
                 a->RemovePrim();
             },
             _materialAdapters)) {
-        auto& renderIndex = GetRenderIndex();
-        auto& changeTracker = renderIndex.GetChangeTracker();
-        for (const auto& rprimId : renderIndex.GetRprimIds()) {
-            const auto* rprim = renderIndex.GetRprim(rprimId);
-            if (rprim != nullptr && rprim->GetMaterialId() == id) {
-                changeTracker.MarkRprimDirty(rprimId, HdChangeTracker::DirtyMaterialId);
-            }
+        auto& changeTracker = GetRenderIndex().GetChangeTracker();
+        for (const auto& rprimId : GetRprimsUsingMaterial(id)) {
+            changeTracker.MarkRprimDirty(rprimId, HdChangeTracker::DirtyMaterialId);
         }
         if (MObjectHandle(obj).isValid()) {
             TF_DEBUG(HDMAYA_DELEGATE_RECREATE_ADAPTER)
@@ -486,6 +451,81 @@ void HdMayaSceneDelegate::RecreateAdapter(const SdfPath& id, const MObject& obj)
     }
 }
 
+void HdMayaSceneDelegate::_EvaluateMotionSamples()
+{
+    _motionSamples.clear();
+    const std::vector<double> sampleTimes = GetSampleTimes(_motionSampleCount);
+    if (sampleTimes.size() < 2) {
+        return;
+    }
+
+    // Gather the shapes which are going to be sampled during sync.
+    struct _Sampled
+    {
+        HdMayaShapeAdapter* adapter;
+        _MotionSamples*     samples;
+        bool                transform;
+        bool                points;
+    };
+    std::vector<_Sampled> sampled;
+    auto&                 changeTracker = GetChangeTracker();
+    for (const auto& it : _shapeAdapters) {
+        const HdDirtyBits dirtyBits = changeTracker.GetRprimDirtyBits(it.first);
+        const bool        transform = (dirtyBits & HdChangeTracker::DirtyTransform) != 0;
+        const bool        points = (dirtyBits & HdChangeTracker::DirtyPoints) != 0
+            && it.second->HasPointsMotionSamples();
+        if (transform || points) {
+            sampled.push_back({ it.second.get(), &_motionSamples[it.first], transform, points });
+        }
+    }
+    if (sampled.empty()) {
+        return;
+    }
+
+    // Same samples as HdMayaDelegate::SampleValues, but each sample time is
+    // evaluated once for all the shapes instead of once per shape.
+    const MTime mayaTime = MAnimControl::currentTime();
+    for (const double relTime : sampleTimes) {
+        MDGContextGuard guard(mayaTime + relTime);
+        for (auto& shape : sampled) {
+            auto& samples = *shape.samples;
+            if (shape.transform) {
+                GfMatrix4d transform
+                    = GetGfMatrixFromMaya(shape.adapter->GetDagPath().inclusiveMatrix());
+                if (samples.transforms.empty() || transform != samples.transforms.back()) {
+                    samples.transforms.push_back(transform);
+                    samples.transformTimes.push_back(relTime);
+                }
+            }
+            if (shape.points) {
+                VtValue points = shape.adapter->Get(HdTokens->points);
+                if (samples.points.empty() || points != samples.points.back()) {
+                    samples.points.push_back(std::move(points));
+                    samples.pointsTimes.push_back(relTime);
+                }
+            }
+        }
+    }
+}
+
+SdfPathVector HdMayaSceneDelegate::GetRprimsUsingMaterial(const SdfPath& materialId)
+{
+    // The index is updated when rprims sync their material id, only keep the
+    // recorded rprims which still exist and still use the material.
+    auto&         renderIndex = GetRenderIndex();
+    SdfPathVector rprimIds = _materialRprims.GetRprims(materialId);
+    rprimIds.erase(
+        std::remove_if(
+            rprimIds.begin(),
+            rprimIds.end(),
+            [&](const SdfPath& rprimId) {
+                const auto* rprim = renderIndex.GetRprim(rprimId);
+                return rprim == nullptr || rprim->GetMaterialId() != materialId;
+            }),
+        rprimIds.end());
+    return rprimIds;
+}
+
 HdMayaShapeAdapterPtr HdMayaSceneDelegate::GetShapeAdapter(const SdfPath& id)
 {
     auto iter = _shapeAdapters.find(id);
@@ -833,6 +873,20 @@ size_t HdMayaSceneDelegate::SampleTransform(
             "HdMayaSceneDelegate::SampleTransform(%s, %u)\n",
             id.GetText(),
             static_cast<unsigned int>(maxSampleCount));
+    if (maxSampleCount > 1 && GetParams().motionSamplesEnabled()) {
+        if (maxSampleCount == _motionSampleCount) {
+            auto it = _motionSamples.find(id);
+            if (it != _motionSamples.end() && !it->second.transforms.empty()) {
+                const auto&  cached = it->second;
+                const size_t count = std::min(maxSampleCount, cached.transforms.size());
+                std::copy_n(cached.transformTimes.begin(), count, times);
+                std::copy_n(cached.transforms.begin(), count, samples);
+                return count;
+            }
+        }
+        // Evaluate the samples of the next frames for this sample count.
+        _motionSampleCount = maxSampleCount;
+    }
     return _GetValue<HdMayaDagAdapter, size_t>(
         id,
         [maxSampleCount, times, samples](HdMayaDagAdapter* a) -> size_t {
@@ -901,6 +955,20 @@ size_t HdMayaSceneDelegate::SamplePrimvar(
             _shapeAdapters);
         return 1;
     } else {
+        if (key == HdTokens->points && maxSampleCount > 1 && GetParams().motionSamplesEnabled()) {
+            if (maxSampleCount == _motionSampleCount) {
+                auto it = _motionSamples.find(id);
+                if (it != _motionSamples.end() && !it->second.points.empty()) {
+                    // The VtArray copies share the buffers of the cached samples.
+                    const auto&  cached = it->second;
+                    const size_t count = std::min(maxSampleCount, cached.points.size());
+                    std::copy_n(cached.pointsTimes.begin(), count, times);
+                    std::copy_n(cached.points.begin(), count, samples);
+                    return count;
+                }
+            }
+            _motionSampleCount = maxSampleCount;
+        }
         return _GetValue<HdMayaShapeAdapter, size_t>(
             id,
             [&key, maxSampleCount, times, samples](HdMayaShapeAdapter* a) -> size_t {
@@ -1073,6 +1141,13 @@ SdfPath HdMayaSceneDelegate::GetMaterialId(const SdfPath& id)
 {
     TF_DEBUG(HDMAYA_DELEGATE_GET_MATERIAL_ID)
         .Msg("HdMayaSceneDelegate::GetMaterialId(%s)\n", id.GetText());
+    const SdfPath materialId = _GetMaterialId(id);
+    _materialRprims.SetMaterial(id, materialId);
+    return materialId;
+}
+
+SdfPath HdMayaSceneDelegate::_GetMaterialId(const SdfPath& id)
+{
     if (!_enableMaterials)
         return {};
     auto shapeAdapter = TfMapLookupPtr(_shapeAdapters, id);
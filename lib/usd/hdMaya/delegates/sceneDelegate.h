@@ -21,8 +21,11 @@
 #include <hdMaya/adapters/materialAdapter.h>
 #include <hdMaya/adapters/shapeAdapter.h>
 #include <hdMaya/delegates/delegateCtx.h>
+#include <hdMaya/delegates/materialRprimIndex.h>
 
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/base/gf/vec4d.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/imaging/hd/meshTopology.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 #include <pxr/pxr.h>
@@ -32,6 +35,8 @@
 #include <maya/MObject.h>
 
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
 /*
  * Notes.
@@ -96,6 +101,11 @@ public:
     HDMAYA_API
     HdMayaMaterialAdapterPtr GetMaterialAdapter(const SdfPath& id);
 
+    /// \brief Returns the rprims of the render index using \p materialId,
+    /// which are the ones dirtied by a change of the material.
+    HDMAYA_API
+    SdfPathVector GetRprimsUsingMaterial(const SdfPath& materialId);
+
     HDMAYA_API
     void InsertDag(const MDagPath& dag);
 
@@ -244,6 +254,22 @@ private:
 
     bool _CreateMaterial(const SdfPath& id, const MObject& obj);
 
+    SdfPath _GetMaterialId(const SdfPath& id);
+
+    /// \brief Evaluates the motion samples of the shapes with dirty transforms
+    /// or points, switching the DG context once per sample time for all of them.
+    void _EvaluateMotionSamples();
+
+    /// \brief Motion samples of a shape evaluated by _EvaluateMotionSamples.
+    /// Consecutive samples with the same value are only stored once.
+    struct _MotionSamples
+    {
+        std::vector<float>      transformTimes;
+        std::vector<GfMatrix4d> transforms;
+        std::vector<float>      pointsTimes;
+        std::vector<VtValue>    points;
+    };
+
     template <typename T> using AdapterMap = std::unordered_map<SdfPath, T, SdfPath::Hash>;
     /// \brief Unordered Map storing the shape adapters.
     AdapterMap<HdMayaShapeAdapterPtr> _shapeAdapters;
@@ -252,12 +278,21 @@ private:
     /// \brief Unordered Map storing the camera adapters.
     AdapterMap<HdMayaCameraAdapterPtr> _cameraAdapters;
     /// \brief Unordered Map storing the material adapters.
-    AdapterMap<HdMayaMaterialAdapterPtr>       _materialAdapters;
-    std::vector<MCallbackId>                   _callbacks;
-    std::vector<std::tuple<SdfPath, MObject>>  _adaptersToRecreate;
-    std::vector<std::tuple<SdfPath, uint32_t>> _adaptersToRebuild;
+    AdapterMap<HdMayaMaterialAdapterPtr> _materialAdapters;
+    /// \brief Rprims using each material, as returned by GetMaterialId.
+    HdMayaMaterialRprimIndex _materialRprims;
+    std::vector<MCallbackId> _callbacks;
+    /// \brief Adapters to recreate or rebuild at the next frame, hashed by id
+    /// since a shared material edit can queue many of them.
+    AdapterMap<MObject>                        _adaptersToRecreate;
+    AdapterMap<uint32_t>                       _adaptersToRebuild;
     std::vector<MObject>                       _addedNodes;
-    std::vector<SdfPath>                       _materialTagsChanged;
+    std::unordered_set<SdfPath, SdfPath::Hash> _materialTagsChanged;
+
+    /// \brief Motion samples of the current frame, and the sample count they were
+    /// evaluated for, which is the last count requested by the render delegate.
+    AdapterMap<_MotionSamples> _motionSamples;
+    size_t                     _motionSampleCount = 0;
 
     SdfPath _fallbackMaterial;
     bool    _enableMaterials = false;
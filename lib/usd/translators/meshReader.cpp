@@ -137,7 +137,8 @@ bool MayaUsdPrimReaderMesh::Read(UsdMayaPrimReaderContext& context)
         meshRead.meshObject(),
         _GetArgs().GetExcludePrimvarNames(),
         _GetArgs().GetExcludePrimvarNamespaces(),
-        _GetArgs().GetUVSetNameRemappings());
+        _GetArgs().GetUVSetNameRemappings(),
+        &meshRead.primvarData());
 
     // assign invisible faces
     UsdMayaMeshReadUtils::assignInvisibleFaces(mesh, meshRead.meshObject());
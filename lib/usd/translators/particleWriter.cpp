@@ -20,6 +20,7 @@
 #include <mayaUsd/fileio/utils/adaptor.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
+#include <mayaUsd/utils/converter.h>
 
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/stringUtils.h>
@@ -39,11 +40,13 @@
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 #include <maya/MVectorArray.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
-#include <limits>
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <set>
-#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -56,81 +59,58 @@ PXRUSDMAYA_REGISTER_WRITER(nParticle, PxrUsdTranslators_ParticleWriter);
 PXRUSDMAYA_REGISTER_ADAPTOR_SCHEMA(nParticle, UsdGeomPoints);
 
 namespace {
-template <typename T> inline void _convertVector(T& t, const MVector& v)
-{
-    // I wish we had concepts
-    // We are guaranteed to have arithmetic types
-    using _t = decltype(+t[0]);
-    t[0] = static_cast<_t>(v.x);
-    t[1] = static_cast<_t>(v.y);
-    t[2] = static_cast<_t>(v.z);
-}
 
-template <typename T> using _sharedVtArray = std::shared_ptr<VtArray<T>>;
+//! Number of particle attributes converted by a single task.
+constexpr size_t kAttrGrainSize = 1;
 
-template <typename T> _sharedVtArray<T> _convertVectorArray(const MVectorArray& a)
+/// A per-particle attribute read from Maya and its conversion to USD.
+template <typename MAYA_ArrayType, typename USD_ItemType> struct _ParticleAttr
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        _convertVector<T>(ret->operator[](i), a[i]);
+    TfToken               name;
+    MAYA_ArrayType        mayaValues;
+    VtArray<USD_ItemType> usdValues;
+
+    void convert()
+    {
+        // The values of the previous frame were handed over to USD, start
+        // from a new array rather than detaching a copy of the shared one.
+        usdValues = VtArray<USD_ItemType>();
+        MayaUsd::TypedConverter<MAYA_ArrayType, VtArray<USD_ItemType>>::convert(
+            mayaValues, usdValues);
     }
-    return _sharedVtArray<T>(ret);
-}
-
-template <typename T> _sharedVtArray<T> _convertArray(const MDoubleArray& a)
-{
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
-    }
-    return _sharedVtArray<T>(ret);
-}
+};
 
-template <typename T> _sharedVtArray<T> _convertArray(const MIntArray& a)
+/// Attributes of a given type which are only exported when present on the
+/// particle system. The entries are kept from frame to frame so that the
+/// storage of the Maya arrays is reused, only the first \c count are valid for
+/// the current frame.
+template <typename MAYA_ArrayType, typename USD_ItemType> struct _ParticleAttrList
 {
-    const auto count = a.length();
-    auto*      ret = new VtArray<T>(count);
-    for (auto i = decltype(count) { 0 }; i < count; ++i) {
-        ret->operator[](i) = static_cast<T>(a[i]);
-    }
-    return _sharedVtArray<T>(ret);
-}
-
-template <typename T> using _strVecPair = std::pair<TfToken, _sharedVtArray<T>>;
+    std::vector<_ParticleAttr<MAYA_ArrayType, USD_ItemType>> attrs;
+    size_t                                                   count = 0;
 
-template <typename T> using _strVecPairVec = std::vector<_strVecPair<T>>;
-
-template <typename T> size_t _minCount(const _strVecPairVec<T>& a)
-{
-    auto mn = std::numeric_limits<size_t>::max();
-    for (const auto& v : a) {
-        mn = std::min(mn, v.second->size());
-    }
-
-    return mn;
-}
-
-template <typename T> void _resizeVectors(_strVecPairVec<T>& a, size_t size)
-{
-    for (const auto& v : a) {
-        v.second->resize(size);
+    _ParticleAttr<MAYA_ArrayType, USD_ItemType>& next(const TfToken& name)
+    {
+        if (count == attrs.size()) {
+            attrs.emplace_back();
+        }
+        auto& attr = attrs[count++];
+        attr.name = name;
+        return attr;
     }
-}
+};
 
 template <typename T>
 inline void _addAttr(
     UsdGeomPoints&             points,
     const TfToken&             name,
     const SdfValueTypeName&    typeName,
-    const VtArray<T>&          a,
+    VtArray<T>*                a,
     const UsdTimeCode&         usdTime,
     FlexibleSparseValueWriter* valueWriter)
 {
-    auto    attr = points.GetPrim().CreateAttribute(name, typeName, false, SdfVariabilityVarying);
-    VtValue val(a);
-    valueWriter->SetAttribute(attr, &val, usdTime);
+    auto attr = points.GetPrim().CreateAttribute(name, typeName, false, SdfVariabilityVarying);
+    UsdMayaWriteUtil::SetAttribute(attr, a, usdTime, valueWriter);
 }
 
 const TfToken kRgbName("rgb");
@@ -139,16 +119,17 @@ const TfToken kOpacityName("opacity");
 const TfToken kLifespanName("lifespan");
 const TfToken kMassName("mass");
 
-template <typename T>
-void _addAttrVec(
-    UsdGeomPoints&             points,
-    const SdfValueTypeName&    typeName,
-    const _strVecPairVec<T>&   a,
-    const UsdTimeCode&         usdTime,
-    FlexibleSparseValueWriter* valueWriter)
+template <typename MAYA_ArrayType, typename USD_ItemType>
+void _addAttrList(
+    UsdGeomPoints&                                   points,
+    const SdfValueTypeName&                          typeName,
+    _ParticleAttrList<MAYA_ArrayType, USD_ItemType>& list,
+    const UsdTimeCode&                               usdTime,
+    FlexibleSparseValueWriter*                       valueWriter)
 {
-    for (const auto& v : a) {
-        _addAttr(points, v.first, typeName, *v.second, usdTime, valueWriter);
+    for (size_t i = 0; i < list.count; ++i) {
+        auto& attr = list.attrs[i];
+        _addAttr(points, attr.name, typeName, &attr.usdValues, usdTime, valueWriter);
     }
 }
 
@@ -211,12 +192,94 @@ bool _isValidAttr(const std::string& attrName)
 }
 } // namespace
 
+/// The particle attributes read at each frame.
+struct PxrUsdTranslators_ParticleWriter::FrameData
+{
+    _ParticleAttr<MVectorArray, GfVec3f> positions;
+    _ParticleAttr<MVectorArray, GfVec3f> velocities;
+    _ParticleAttr<MIntArray, int64_t>    ids;
+    _ParticleAttr<MDoubleArray, float>   radii;
+    _ParticleAttr<MDoubleArray, float>   masses;
+
+    _ParticleAttrList<MVectorArray, GfVec3f> vectors;
+    _ParticleAttrList<MDoubleArray, float>   floats;
+    _ParticleAttrList<MIntArray, int>        ints;
+
+    /// Converts all the attributes to USD, one attribute per task.
+    void convert()
+    {
+        std::vector<std::function<void()>> conversions
+            = { [this]() { positions.convert(); },
+                [this]() { velocities.convert(); },
+                [this]() { ids.convert(); },
+                [this]() { radii.convert(); },
+                [this]() { masses.convert(); } };
+        for (size_t i = 0; i < vectors.count; ++i) {
+            conversions.emplace_back([this, i]() { vectors.attrs[i].convert(); });
+        }
+        for (size_t i = 0; i < floats.count; ++i) {
+            conversions.emplace_back([this, i]() { floats.attrs[i].convert(); });
+        }
+        for (size_t i = 0; i < ints.count; ++i) {
+            conversions.emplace_back([this, i]() { ints.attrs[i].convert(); });
+        }
+
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, conversions.size(), kAttrGrainSize),
+            [&conversions](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    conversions[i]();
+                }
+            });
+    }
+
+    /// Returns the number of particles which have a value for every attribute.
+    size_t minCount() const
+    {
+        size_t count = std::min({ positions.usdValues.size(),
+                                  velocities.usdValues.size(),
+                                  ids.usdValues.size(),
+                                  radii.usdValues.size(),
+                                  masses.usdValues.size() });
+        for (size_t i = 0; i < vectors.count; ++i) {
+            count = std::min(count, vectors.attrs[i].usdValues.size());
+        }
+        for (size_t i = 0; i < floats.count; ++i) {
+            count = std::min(count, floats.attrs[i].usdValues.size());
+        }
+        for (size_t i = 0; i < ints.count; ++i) {
+            count = std::min(count, ints.attrs[i].usdValues.size());
+        }
+        return count;
+    }
+
+    /// Truncates all the attributes to \p count particles.
+    void resize(size_t count)
+    {
+        positions.usdValues.resize(count);
+        velocities.usdValues.resize(count);
+        ids.usdValues.resize(count);
+        radii.usdValues.resize(count);
+        masses.usdValues.resize(count);
+        for (size_t i = 0; i < vectors.count; ++i) {
+            vectors.attrs[i].usdValues.resize(count);
+        }
+        for (size_t i = 0; i < floats.count; ++i) {
+            floats.attrs[i].usdValues.resize(count);
+        }
+        for (size_t i = 0; i < ints.count; ++i) {
+            ints.attrs[i].usdValues.resize(count);
+        }
+    }
+};
+
 PxrUsdTranslators_ParticleWriter::PxrUsdTranslators_ParticleWriter(
     const MFnDependencyNode& depNodeFn,
     const SdfPath&           usdPath,
     UsdMayaWriteJobContext&  jobCtx)
     : UsdMayaTransformWriter(depNodeFn, usdPath, jobCtx)
     , mInitialFrameDone(false)
+    , mFrameData(new FrameData)
 {
     if (!TF_VERIFY(GetDagPath().isValid())) {
         return;
@@ -238,6 +301,8 @@ PxrUsdTranslators_ParticleWriter::PxrUsdTranslators_ParticleWriter(
     initializeUserAttributes();
 }
 
+PxrUsdTranslators_ParticleWriter::~PxrUsdTranslators_ParticleWriter() = default;
+
 /* virtual */
 void PxrUsdTranslators_ParticleWriter::Write(const UsdTimeCode& usdTime)
 {
@@ -292,118 +357,98 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
         return;
     }
 
-    _strVecPairVec<GfVec3f> vectors;
-    _strVecPairVec<float>   floats;
-    _strVecPairVec<int>     ints;
-
-    MVectorArray mayaVectors;
-    MDoubleArray mayaDoubles;
-    MIntArray    mayaInts;
-
-    deformedParticleSys.position(mayaVectors);
-    auto positions = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.velocity(mayaVectors);
-    auto velocities = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.particleIds(mayaInts);
-    auto ids = _convertArray<int64_t>(mayaInts);
-    particleSys.radius(mayaDoubles);
-    auto radii = _convertArray<float>(mayaDoubles);
-    particleSys.mass(mayaDoubles);
-    auto masses = _convertArray<float>(mayaDoubles);
+    // Read all the attributes from Maya first, then convert them all at once.
+    FrameData& data = *mFrameData;
+    data.vectors.count = 0;
+    data.floats.count = 0;
+    data.ints.count = 0;
+
+    deformedParticleSys.position(data.positions.mayaValues);
+    particleSys.velocity(data.velocities.mayaValues);
+    particleSys.particleIds(data.ids.mayaValues);
+    particleSys.radius(data.radii.mayaValues);
+    particleSys.mass(data.masses.mayaValues);
 
     if (particleSys.hasRgb()) {
-        particleSys.rgb(mayaVectors);
-        vectors.emplace_back(kRgbName, _convertVectorArray<GfVec3f>(mayaVectors));
+        particleSys.rgb(data.vectors.next(kRgbName).mayaValues);
     }
 
     if (particleSys.hasEmission()) {
-        particleSys.rgb(mayaVectors);
-        vectors.emplace_back(kEmissionName, _convertVectorArray<GfVec3f>(mayaVectors));
+        particleSys.rgb(data.vectors.next(kEmissionName).mayaValues);
     }
 
     if (particleSys.hasOpacity()) {
-        particleSys.opacity(mayaDoubles);
-        floats.emplace_back(kOpacityName, _convertArray<float>(mayaDoubles));
+        particleSys.opacity(data.floats.next(kOpacityName).mayaValues);
     }
 
     if (particleSys.hasLifespan()) {
-        particleSys.lifespan(mayaDoubles);
-        floats.emplace_back(kLifespanName, _convertArray<float>(mayaDoubles));
+        particleSys.lifespan(data.floats.next(kLifespanName).mayaValues);
     }
 
     for (const auto& attr : mUserAttributes) {
         MStatus status;
         switch (std::get<2>(attr)) {
         case PER_PARTICLE_INT:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaInts, &status);
-            if (status) {
-                ints.emplace_back(std::get<0>(attr), _convertArray<int>(mayaInts));
+            particleSys.getPerParticleAttribute(
+                std::get<1>(attr), data.ints.next(std::get<0>(attr)).mayaValues, &status);
+            if (!status) {
+                --data.ints.count;
             }
             break;
         case PER_PARTICLE_DOUBLE:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaDoubles, &status);
-            if (status) {
-                floats.emplace_back(std::get<0>(attr), _convertArray<float>(mayaDoubles));
+            particleSys.getPerParticleAttribute(
+                std::get<1>(attr), data.floats.next(std::get<0>(attr)).mayaValues, &status);
+            if (!status) {
+                --data.floats.count;
             }
             break;
         case PER_PARTICLE_VECTOR:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaVectors, &status);
-            if (status) {
-                vectors.emplace_back(std::get<0>(attr), _convertVectorArray<GfVec3f>(mayaVectors));
+            particleSys.getPerParticleAttribute(
+                std::get<1>(attr), data.vectors.next(std::get<0>(attr)).mayaValues, &status);
+            if (!status) {
+                --data.vectors.count;
             }
             break;
         }
     }
 
-    const auto minSize = std::min({ _minCount(vectors),
-                                    _minCount(floats),
-                                    _minCount(ints),
-                                    positions->size(),
-                                    velocities->size(),
-                                    ids->size(),
-                                    radii->size(),
-                                    masses->size() });
+    data.convert();
 
+    const size_t minSize = data.minCount();
     if (minSize == 0) {
         return;
     }
 
-    _resizeVectors(vectors, minSize);
-    _resizeVectors(floats, minSize);
-    _resizeVectors(ints, minSize);
-    positions->resize(minSize);
-    velocities->resize(minSize);
-    ids->resize(minSize);
-    radii->resize(minSize);
-    masses->resize(minSize);
-
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetPointsAttr(), positions.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetVelocitiesAttr(), velocities.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(
-        points.GetIdsAttr(), ids.get(), usdTime, _GetSparseValueWriter());
+    data.resize(minSize);
 
     // radius -> width conversion
-    for (auto& r : *radii) {
-        r = r * 2.0f;
+    float* widths = data.radii.usdValues.data();
+    for (size_t i = 0; i < minSize; ++i) {
+        widths[i] *= 2.0f;
     }
 
     UsdMayaWriteUtil::SetAttribute(
-        points.GetWidthsAttr(), radii.get(), usdTime, _GetSparseValueWriter());
+        points.GetPointsAttr(), &data.positions.usdValues, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetVelocitiesAttr(), &data.velocities.usdValues, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetIdsAttr(), &data.ids.usdValues, usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(
+        points.GetWidthsAttr(), &data.radii.usdValues, usdTime, _GetSparseValueWriter());
 
     _addAttr(
         points,
         kMassName,
         SdfValueTypeNames->FloatArray,
-        *masses,
+        &data.masses.usdValues,
         usdTime,
         _GetSparseValueWriter());
     // TODO: check if we need the array suffix!!
-    _addAttrVec(
-        points, SdfValueTypeNames->Vector3fArray, vectors, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->FloatArray, floats, usdTime, _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->IntArray, ints, usdTime, _GetSparseValueWriter());
+    _addAttrList(
+        points, SdfValueTypeNames->Vector3fArray, data.vectors, usdTime, _GetSparseValueWriter());
+    _addAttrList(
+        points, SdfValueTypeNames->FloatArray, data.floats, usdTime, _GetSparseValueWriter());
+    _addAttrList(points, SdfValueTypeNames->IntArray, data.ints, usdTime, _GetSparseValueWriter());
 }
 
 void PxrUsdTranslators_ParticleWriter::initializeUserAttributes()
@@ -30,6 +30,7 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MString.h>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -42,6 +43,7 @@ public:
         const MFnDependencyNode& depNodeFn,
         const SdfPath&           usdPath,
         UsdMayaWriteJobContext&  jobCtx);
+    ~PxrUsdTranslators_ParticleWriter() override;
 
     void Write(const UsdTimeCode& usdTime) override;
 
@@ -58,6 +60,10 @@ private:
     std::vector<std::tuple<TfToken, MString, ParticleType>> mUserAttributes;
     bool                                                    mInitialFrameDone;
 
+    // The Maya and USD arrays of each attribute, kept across frames.
+    struct FrameData;
+    std::unique_ptr<FrameData> mFrameData;
+
     void initializeUserAttributes();
 };
 
@@ -18,6 +18,7 @@
 #include <usdUfe/ufe/Global.h>
 #include <usdUfe/ufe/UsdAttributeHolder.h>
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/connectionIndex.h>
 #include <usdUfe/utils/usdUtils.h>
 
 #include <pxr/base/tf/token.h>
@@ -29,6 +30,8 @@
 #include <ufe/runTimeMgr.h>
 #include <ufe/ufeAssert.h>
 
+#include <algorithm>
+
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #include <usdUfe/ufe/UsdShaderAttributeDef.h>
 #include <usdUfe/ufe/UsdShaderAttributeHolder.h>
@@ -443,19 +446,20 @@ bool UsdAttributes::canRemoveAttribute(const UsdSceneItem::Ptr& item, const std:
     }
     return false;
 }
-static void removeSrcAttrConnections(PXR_NS::UsdPrim& prim, const PXR_NS::UsdAttribute& srcUsdAttr)
+static void removeSrcAttrConnections(
+    const PXR_NS::UsdPrim&      scope,
+    const PXR_NS::UsdAttribute& srcUsdAttr,
+    bool                        includeScope)
 {
-    // Remove the connections with source srcUsdAttr.
-    for (const auto& attribute : prim.GetAttributes()) {
-        PXR_NS::UsdAttribute dstUsdAttr = attribute.As<PXR_NS::UsdAttribute>();
-
-        if (isConnected(srcUsdAttr, dstUsdAttr)) {
-            UsdShadeConnectableAPI::DisconnectSource(dstUsdAttr, srcUsdAttr);
-            // Check if we can remove the property.
-            if (canRemoveDstProperty(dstUsdAttr)) {
-                // Remove the property.
-                prim.RemoveProperty(dstUsdAttr.GetName());
-            }
+    // Remove the connections with source srcUsdAttr, in the children of the scope and, if
+    // requested, in the scope itself.
+    for (const auto& dstUsdAttr :
+         getConnectedDestinations(scope, srcUsdAttr.GetPath(), includeScope)) {
+        UsdShadeConnectableAPI::DisconnectSource(dstUsdAttr, srcUsdAttr);
+        // Check if we can remove the property.
+        if (canRemoveDstProperty(dstUsdAttr)) {
+            // Remove the property.
+            dstUsdAttr.GetPrim().RemoveProperty(dstUsdAttr.GetName());
         }
     }
 }
@@ -505,15 +509,6 @@ static void removeDstAttrConnections(const PXR_NS::UsdAttribute& dstUsdAttr)
     }
 }
 
-static void
-removeAllChildrenConnections(const PXR_NS::UsdPrim& prim, const PXR_NS::UsdAttribute& srcUsdAttr)
-{
-    // Remove the connections with source srcUsdAttr for all the children.
-    for (auto&& usdChild : prim.GetChildren()) {
-        removeSrcAttrConnections(usdChild, srcUsdAttr);
-    }
-}
-
 static void removeNodeGraphConnections(const PXR_NS::UsdAttribute& attr)
 {
     const auto prim = attr.GetPrim();
@@ -547,12 +542,11 @@ static void removeNodeGraphConnections(const PXR_NS::UsdAttribute& attr)
 
     if (baseNameAndType.second == PXR_NS::UsdShadeAttributeType::Output) {
         // Remove the connections from the source attribute.
-        removeAllChildrenConnections(primParent, attr);
-        removeSrcAttrConnections(primParent, attr);
+        removeSrcAttrConnections(primParent, attr, true);
     }
 
     if (baseNameAndType.second == PXR_NS::UsdShadeAttributeType::Input) {
-        removeAllChildrenConnections(prim, attr);
+        removeSrcAttrConnections(prim, attr, false);
     }
 }
 
@@ -581,9 +575,8 @@ void UsdAttributes::removeAttributesConnections(const PXR_NS::UsdPrim& prim)
         }
 
         if (kBaseNameAndType.second == PXR_NS::UsdShadeAttributeType::Output) {
-            removeAllChildrenConnections(primParent, attr);
             // Remove the connections from the source attribute.
-            removeSrcAttrConnections(primParent, attr);
+            removeSrcAttrConnections(primParent, attr, true);
         }
     }
 }
@@ -635,38 +628,18 @@ bool UsdAttributes::canRenameAttribute(
 }
 
 static void setConnections(
-    const PXR_NS::UsdPrim& prim,
+    const PXR_NS::UsdPrim& scope,
     const SdfPath&         oldPropertyPath,
-    const SdfPath&         newPropertyPath)
+    const SdfPath&         newPropertyPath,
+    bool                   includeScope)
 {
-    for (const auto& attribute : prim.GetAttributes()) {
-        PXR_NS::UsdAttribute  attr = attribute.As<PXR_NS::UsdAttribute>();
+    // Update the connections to the original property path, in the children of the scope and, if
+    // requested, in the scope itself.
+    for (const auto& attr : getConnectedDestinations(scope, oldPropertyPath, includeScope)) {
         PXR_NS::SdfPathVector sources;
         attr.GetConnections(&sources);
-
-        bool hasChanged = false;
-        // Check if the node attribute is connected to the original property path.
-        for (size_t i = 0; i < sources.size(); ++i) {
-            if (sources[i] == oldPropertyPath) {
-                sources[i] = newPropertyPath;
-                hasChanged = true;
-            }
-        }
-        // Update the connections with the new property path.
-        if (hasChanged) {
-            attr.SetConnections(sources);
-        }
-    }
-}
-
-static void setConnectionsOfAllChildren(
-    const PXR_NS::UsdPrim& prim,
-    const SdfPath&         oldPropertyPath,
-    const SdfPath&         newPropertyPath)
-{
-    // Update the connections with the new attribute name.
-    for (const auto& node : prim.GetChildren()) {
-        setConnections(node, oldPropertyPath, newPropertyPath);
+        std::replace(sources.begin(), sources.end(), oldPropertyPath, newPropertyPath);
+        attr.SetConnections(sources);
     }
 }
 
@@ -732,11 +705,10 @@ Ufe::Attribute::Ptr UsdAttributes::doRenameAttribute(
         // Given the unidirectional nature of connections, we discriminate whether the source is
         // input or output
         if (baseNameAndType.second == PXR_NS::UsdShadeAttributeType::Input) {
-            setConnectionsOfAllChildren(prim, kOldPropertyPath, kNewPropertyPath);
+            setConnections(prim, kOldPropertyPath, kNewPropertyPath, false);
         }
         if (baseNameAndType.second == PXR_NS::UsdShadeAttributeType::Output) {
-            setConnectionsOfAllChildren(prim.GetParent(), kOldPropertyPath, kNewPropertyPath);
-            setConnections(prim.GetParent(), kOldPropertyPath, kNewPropertyPath);
+            setConnections(prim.GetParent(), kOldPropertyPath, kNewPropertyPath, true);
         }
     }
 
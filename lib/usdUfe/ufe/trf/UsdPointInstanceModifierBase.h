@@ -30,6 +30,12 @@
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
 
+#include <ufe/path.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace USDUFE_NS_DEF {
 
 //! \brief Shared data for USD point instance read and write batching.
@@ -44,12 +50,25 @@ namespace USDUFE_NS_DEF {
 // expensive operation than writing to or reading from the point instancer
 // attribute.
 //
+// While the batch is under construction, the modifiers joining it read their
+// initial value from a single snapshot of the point instancer attribute, and
+// the last modifier to write is responsible for the Transform3d notification
+// of all the point instances of the batch.
+//
 template <class UsdValueType> struct USDUFE_PUBLIC UsdPointInstanceBatch
 {
     inline bool isReader() const { return (count % nbInstances) == 0; }
     inline bool isWriter() const { return ((count + 1) % nbInstances) == 0; }
 
     PXR_NS::VtArray<UsdValueType> usdValues;
+    // Values of the point instancer attribute at snapshotTime, read once by
+    // UsdPointInstanceModifierBase::getBatchedUsdValue() for all the modifiers
+    // joining the batch.  Released when the batch is closed.
+    PXR_NS::VtArray<UsdValueType> snapshot;
+    PXR_NS::UsdTimeCode           snapshotTime;
+    bool                          hasSnapshot { false };
+    // Paths of the point instances in the batch, in joining order.
+    std::vector<Ufe::Path> paths;
     // Number of instances in the batch.  Incremented by
     // UsdPointInstanceModifierBase::joinBatch().
     unsigned int nbInstances { 0 };
@@ -129,36 +148,29 @@ public:
 
     UsdValueType getUsdValue(PXR_NS::UsdTimeCode usdTime = PXR_NS::UsdTimeCode::Default()) const
     {
-        UsdValueType usdValue = this->getDefaultUsdValue();
-
-        PXR_NS::UsdGeomPointInstancer pointInstancer = getPointInstancer();
-        if (!pointInstancer) {
-            return usdValue;
-        }
-
-        if (_instanceIndex < 0) {
-            return usdValue;
-        }
-
-        const size_t instanceIndex = static_cast<size_t>(_instanceIndex);
-
-        PXR_NS::UsdAttribute usdAttr = getAttribute();
-        if (!usdAttr) {
-            return usdValue;
-        }
-
         PXR_NS::VtArray<UsdValueType> usdValues;
-        if (!usdAttr.Get(&usdValues, usdTime)) {
-            return usdValue;
+        _readUsdValues(usdTime, &usdValues);
+        return _getUsdValue(usdValues);
+    }
+
+    // Same as getUsdValue(), but once a batch has been joined the point
+    // instancer attribute is read only by the first modifier of the batch,
+    // and the others get their value from that snapshot.  Meant to be used
+    // while the batch is under construction, before any value is set.
+    UsdValueType getBatchedUsdValue(PXR_NS::UsdTimeCode usdTime = PXR_NS::UsdTimeCode::Default())
+    {
+        if (!_batch) {
+            return getUsdValue(usdTime);
         }
 
-        if (instanceIndex >= usdValues.size()) {
-            return usdValue;
+        if (!_batch->hasSnapshot || _batch->snapshotTime != usdTime) {
+            _batch->snapshot = PXR_NS::VtArray<UsdValueType>();
+            _readUsdValues(usdTime, &_batch->snapshot);
+            _batch->snapshotTime = usdTime;
+            _batch->hasSnapshot = true;
         }
 
-        // Avoid triggering a copy-on-write by making sure that
-        // we invoke operator[] on a const reference to the array.
-        return usdValues.AsConst()[instanceIndex];
+        return _getUsdValue(_batch->snapshot);
     }
 
     bool setValue(
@@ -250,10 +262,23 @@ public:
             found = inserted.first;
         }
         found->second->nbInstances++;
+        found->second->paths.push_back(_path);
 
         _batch = found->second;
     }
 
+    // Returns true if the next call to setValue() will write the values of
+    // the batch to the point instancer attribute.  Modifiers that did not join
+    // a batch always write.
+    bool isBatchWriter() const { return !_batch || _batch->isWriter(); }
+
+    // Returns the paths of the point instances written by the batch, or only
+    // the path of this modifier if it did not join a batch.
+    std::vector<Ufe::Path> batchPaths() const
+    {
+        return _batch ? _batch->paths : std::vector<Ufe::Path> { _path };
+    }
+
     virtual UsdValueType convertValueToUsd(const UfeValueType& ufeValue) const = 0;
 
     virtual UfeValueType convertValueToUfe(const UsdValueType& usdValue) const = 0;
@@ -263,6 +288,36 @@ public:
     virtual PXR_NS::UsdAttribute getAttribute() const = 0;
 
 protected:
+    void _readUsdValues(
+        PXR_NS::UsdTimeCode            usdTime,
+        PXR_NS::VtArray<UsdValueType>* usdValues) const
+    {
+        PXR_NS::UsdGeomPointInstancer pointInstancer = getPointInstancer();
+        if (!pointInstancer || _instanceIndex < 0) {
+            return;
+        }
+
+        PXR_NS::UsdAttribute usdAttr = getAttribute();
+        if (!usdAttr) {
+            return;
+        }
+
+        if (!usdAttr.Get(usdValues, usdTime)) {
+            usdValues->clear();
+        }
+    }
+
+    UsdValueType _getUsdValue(const PXR_NS::VtArray<UsdValueType>& usdValues) const
+    {
+        if (_instanceIndex < 0 || static_cast<size_t>(_instanceIndex) >= usdValues.size()) {
+            return this->getDefaultUsdValue();
+        }
+
+        // Avoid triggering a copy-on-write by making sure that
+        // we invoke operator[] on a const reference to the array.
+        return usdValues.AsConst()[static_cast<size_t>(_instanceIndex)];
+    }
+
     // Retrieve the active batches (one per point instancer path) for the
     // derived attribute type (i.e. position, orientation, or scale).  We keep
     // one active batch map per attribute type (3 batch maps), rather than a
@@ -373,11 +428,15 @@ protected:
         // construction, and thus it can no longer be joined.  If a batch was
         // created, erase() will harmlessly fail for all modifiers except the
         // first one.  If no batch was created, make a trivial, unshared batch
-        // just for this modifier.
+        // just for this modifier.  The read snapshot is no longer needed.
         batches().erase(pointInstancerPath());
         if (!_batch) {
             _batch = std::make_shared<UsdPointInstanceBatch<UsdValueType>>();
             _batch->nbInstances = 1;
+            _batch->paths.push_back(_path);
+        } else if (_batch->hasSnapshot) {
+            _batch->snapshot = PXR_NS::VtArray<UsdValueType>();
+            _batch->hasSnapshot = false;
         }
     }
 
@@ -59,35 +59,20 @@ public:
 
         _modifier.setSceneItem(item);
         // We're using a modifier to change a point instancer attribute, so
-        // batch the reads and writes, for efficiency.
+        // batch the reads and writes, for efficiency.  The commands of a batch
+        // also share a single read of the attribute for their initial value.
         _modifier.joinBatch();
 
-        _prevValue = _modifier.getUsdValue(_readTime);
+        _prevValue = _modifier.getBatchedUsdValue(_readTime);
         _newValue = _prevValue;
     }
 
     USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdPointInstanceUndoableCommandBase);
 
     // Ufe::UndoableCommand overrides.
-    void undo() override
-    {
-        // Block the USD change notice handling from running in response to the
-        // USD authoring we're about to do. We notify afterwards only on the
-        // specific point instance scene item being manipulated.
-        UsdUfe::InTransform3dChange guard(this->path());
-        _modifier.setValue(_prevValue, _writeTime);
-        Ufe::Transform3d::notify(this->path());
-    }
+    void undo() override { _setValue(_prevValue); }
 
-    void redo() override
-    {
-        // Block the USD change notice handling from running in response to the
-        // USD authoring we're about to do. We notify afterwards only on the
-        // specific point instance scene item being manipulated.
-        UsdUfe::InTransform3dChange guard(this->path());
-        _modifier.setValue(_newValue, _writeTime);
-        Ufe::Transform3d::notify(this->path());
-    }
+    void redo() override { _setValue(_newValue); }
 
     bool set(double x, double y, double z) override
     {
@@ -98,6 +83,32 @@ public:
     }
 
 protected:
+    void _setValue(const UsdValueType& value)
+    {
+        // Only the last command of a batch authors to USD, the others only
+        // update the batched values, so there is nothing to notify yet.
+        if (!_modifier.isBatchWriter()) {
+            _modifier.setValue(value, _writeTime);
+            return;
+        }
+
+        {
+            // Block the USD change notice handling from running in response to
+            // the USD authoring we're about to do. The guard notifies on this
+            // point instance when it goes out of scope.
+            UsdUfe::InTransform3dChange guard(this->path());
+            _modifier.setValue(value, _writeTime);
+        }
+
+        // Notify once on each of the other point instances of the batch, now
+        // that their values have been written.
+        for (const Ufe::Path& path : _modifier.batchPaths()) {
+            if (path != this->path()) {
+                Ufe::Transform3d::notify(path);
+            }
+        }
+    }
+
     PointInstanceModifierType _modifier;
     const PXR_NS::UsdTimeCode _readTime;
     const PXR_NS::UsdTimeCode _writeTime;
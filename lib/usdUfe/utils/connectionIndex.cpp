@@ -0,0 +1,249 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "connectionIndex.h"
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/primFlags.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+using PathsByPath = std::unordered_map<SdfPath, SdfPathVector, SdfPath::Hash>;
+
+//! Connections of the attributes of a scope prim and of its children.
+struct ScopeIndex
+{
+    // Connection sources of each connected attribute.
+    PathsByPath sources;
+    // Connected attributes of each connection source.
+    PathsByPath destinations;
+
+    void add(const UsdAttribute& attr)
+    {
+        SdfPathVector attrSources;
+        if (!attr.GetConnections(&attrSources) || attrSources.empty()) {
+            return;
+        }
+        const SdfPath& attrPath = attr.GetPath();
+        for (const SdfPath& srcPath : attrSources) {
+            SdfPathVector& dstPaths = destinations[srcPath];
+            // The sources of an attribute are added together: a repeated source ends up last.
+            if (dstPaths.empty() || dstPaths.back() != attrPath) {
+                dstPaths.push_back(attrPath);
+            }
+        }
+        sources[attrPath] = std::move(attrSources);
+    }
+
+    void remove(const SdfPath& attrPath)
+    {
+        auto it = sources.find(attrPath);
+        if (it == sources.end()) {
+            return;
+        }
+        for (const SdfPath& srcPath : it->second) {
+            auto dstIt = destinations.find(srcPath);
+            if (dstIt == destinations.end()) {
+                continue;
+            }
+            SdfPathVector& dstPaths = dstIt->second;
+            dstPaths.erase(std::remove(dstPaths.begin(), dstPaths.end(), attrPath), dstPaths.end());
+            if (dstPaths.empty()) {
+                destinations.erase(dstIt);
+            }
+        }
+        sources.erase(it);
+    }
+};
+
+ScopeIndex buildScopeIndex(const UsdPrim& scope)
+{
+    ScopeIndex index;
+    for (const auto& attr : scope.GetAttributes()) {
+        index.add(attr);
+    }
+    for (const auto& child : scope.GetChildren()) {
+        for (const auto& attr : child.GetAttributes()) {
+            index.add(attr);
+        }
+    }
+    return index;
+}
+
+//! Connection indexes of the scopes of a stage, updated from the changes of the stage.
+class StageConnections : public TfWeakBase
+{
+public:
+    explicit StageConnections(const UsdStageWeakPtr& stage)
+        : _stage(stage)
+    {
+        TfWeakPtr<StageConnections> me(this);
+        _objectsChangedKey = TfNotice::Register(me, &StageConnections::_onObjectsChanged, stage);
+    }
+
+    ~StageConnections() { TfNotice::Revoke(_objectsChangedKey); }
+
+    StageConnections(const StageConnections&) = delete;
+    StageConnections& operator=(const StageConnections&) = delete;
+
+    bool isExpired() const { return !_stage; }
+
+    const ScopeIndex& getScopeIndex(const UsdPrim& scope)
+    {
+        auto it = _scopes.find(scope.GetPath());
+        if (it == _scopes.end()) {
+            it = _scopes.emplace(scope.GetPath(), buildScopeIndex(scope)).first;
+        }
+        return it->second;
+    }
+
+private:
+    void _onObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr&)
+    {
+        if (_scopes.empty()) {
+            return;
+        }
+
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            if (path.IsPropertyPath()) {
+                _updateAttribute(path);
+                continue;
+            }
+            // The resync changes the children of the parent prim and everything below the
+            // path. Descendants sort right after their ancestor.
+            _scopes.erase(path.GetParentPath());
+            auto it = _scopes.lower_bound(path);
+            while (it != _scopes.end() && it->first.HasPrefix(path)) {
+                it = _scopes.erase(it);
+            }
+        }
+
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+            if (!path.IsPropertyPath()) {
+                continue;
+            }
+            const TfTokenVector fields = notice.GetChangedFields(path);
+            if (std::find(fields.begin(), fields.end(), SdfFieldKeys->ConnectionPaths)
+                != fields.end()) {
+                _updateAttribute(path);
+            }
+        }
+    }
+
+    //! Read again the connections of the attribute in the scopes that contain it.
+    void _updateAttribute(const SdfPath& attrPath)
+    {
+        const SdfPath      primPath = attrPath.GetPrimPath();
+        const UsdAttribute attr = _stage->GetAttributeAtPath(attrPath);
+        for (const SdfPath& scopePath : { primPath, primPath.GetParentPath() }) {
+            auto it = _scopes.find(scopePath);
+            if (it == _scopes.end()) {
+                continue;
+            }
+            it->second.remove(attrPath);
+            // Children are indexed only when the scope traversal sees them.
+            if (attr && (scopePath == primPath || UsdPrimDefaultPredicate(attr.GetPrim()))) {
+                it->second.add(attr);
+            }
+        }
+    }
+
+    UsdStageWeakPtr               _stage;
+    TfNotice::Key                 _objectsChangedKey;
+    std::map<SdfPath, ScopeIndex> _scopes;
+};
+
+StageConnections& getStageConnections(const UsdStageWeakPtr& stage)
+{
+    static std::unordered_map<const UsdStage*, std::unique_ptr<StageConnections>> allStages;
+
+    // Forget the stages that were closed since the last query, before their address is reused.
+    for (auto it = allStages.begin(); it != allStages.end();) {
+        it = it->second->isExpired() ? allStages.erase(it) : std::next(it);
+    }
+
+    auto& connections = allStages[get_pointer(stage)];
+    if (!connections) {
+        connections = std::make_unique<StageConnections>(stage);
+    }
+    return *connections;
+}
+
+} // namespace
+
+namespace USDUFE_NS_DEF {
+
+std::vector<UsdAttribute>
+getConnectedDestinations(const UsdPrim& scope, const SdfPath& srcPath, bool includeScope)
+{
+    std::vector<UsdAttribute> dstAttrs;
+    if (!scope) {
+        return dstAttrs;
+    }
+
+    // The changes of instance proxies are reported on their prototype: do not keep their index.
+    ScopeIndex        proxyIndex;
+    const ScopeIndex* index = nullptr;
+    if (scope.IsInstanceProxy()) {
+        proxyIndex = buildScopeIndex(scope);
+        index = &proxyIndex;
+    } else {
+        index = &getStageConnections(scope.GetStage()).getScopeIndex(scope);
+    }
+
+    auto it = index->destinations.find(srcPath);
+    if (it == index->destinations.end()) {
+        return dstAttrs;
+    }
+
+    const UsdStageWeakPtr stage = scope.GetStage();
+    for (const SdfPath& dstPath : it->second) {
+        if (!includeScope && dstPath.GetPrimPath() == scope.GetPath()) {
+            continue;
+        }
+        if (const UsdAttribute dstAttr = stage->GetAttributeAtPath(dstPath)) {
+            dstAttrs.push_back(dstAttr);
+        }
+    }
+
+    // Changes made in an open change block are not notified yet: keep only the attributes that
+    // are still connected to the source.
+    dstAttrs.erase(
+        std::remove_if(
+            dstAttrs.begin(),
+            dstAttrs.end(),
+            [&srcPath](const UsdAttribute& dstAttr) {
+                SdfPathVector connections;
+                dstAttr.GetConnections(&connections);
+                return std::find(connections.begin(), connections.end(), srcPath)
+                    == connections.end();
+            }),
+        dstAttrs.end());
+    return dstAttrs;
+}
+
+} // namespace USDUFE_NS_DEF
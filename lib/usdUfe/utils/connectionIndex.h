@@ -0,0 +1,45 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_CONNECTIONINDEX_H
+#define USDUFE_CONNECTIONINDEX_H
+
+#include <usdUfe/base/api.h>
+
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+
+#include <vector>
+
+namespace USDUFE_NS_DEF {
+
+/*! \brief Return the attributes connected to the source \p srcPath, among the attributes of the
+ * children of \p scope and, if \p includeScope is true, of \p scope itself.
+ *
+ * These are the attributes that can connect to the boundary and to the nodes of a node graph.
+ * The reverse index of their connections is built on the first query for \p scope and kept up
+ * to date with the changes of the stage, so that editing the connections of one attribute does
+ * not scan the whole node graph again.
+ */
+USDUFE_PUBLIC
+std::vector<PXR_NS::UsdAttribute> getConnectedDestinations(
+    const PXR_NS::UsdPrim& scope,
+    const PXR_NS::SdfPath& srcPath,
+    bool                   includeScope = true);
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_CONNECTIONINDEX_H
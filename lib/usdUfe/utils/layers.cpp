@@ -15,10 +15,17 @@
 //
 #include "layers.h"
 
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/pcp/layerStack.h>
+#include <pxr/usd/sdf/notice.h>
 #include <pxr/usd/usd/primCompositionQuery.h>
 
 #include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace USDUFE_NS_DEF {
 
@@ -26,27 +33,208 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {
 
+// Sublayers with the path that found them.
+using Sublayers = std::vector<std::pair<std::string, SdfLayerHandle>>;
+
+// Strength of the layers of a layer tree: the lower, the stronger.
+using LayerStrengths = std::unordered_map<SdfLayerHandle, size_t, TfHash>;
+
+template <class T> using LayerMap = std::unordered_map<SdfLayerHandle, T, TfHash>;
+using LayerSet = std::unordered_set<SdfLayerHandle, TfHash>;
+
+bool isValidLayer(const SdfLayerHandle& layer) { return bool(layer); }
+bool isValidLayer(const std::pair<std::string, SdfLayerHandle>& sublayer)
+{
+    return bool(sublayer.second);
+}
+bool isValidLayer(const std::pair<const SdfLayerHandle, size_t>& strength)
+{
+    return bool(strength.first);
+}
+
+// Sublayer hierarchies of the layers, found once and reused by the editability
+// checks made for each prim. Everything is dropped when a layer changes its own
+// metadata, which includes its sublayers, or its whole content. Hierarchies with
+// a sublayer that cannot be found are not kept, since a later search could find it,
+// and those with a layer that has since been deleted are searched again. Entries
+// of deleted layers are dropped when new ones are stored.
+//
+// The lock is not held while searching, since opening a layer sends notices.
+class LayerTopologyCache : public TfWeakBase
+{
+public:
+    static LayerTopologyCache& instance()
+    {
+        static LayerTopologyCache cache;
+        return cache;
+    }
+
+    // Sublayers found breadth-first from the layer, all relative to that layer.
+    Sublayers getSublayerClosure(const SdfLayerHandle& layer)
+    {
+        Sublayers closure;
+        if (find(_closures, layer, closure))
+            return closure;
+
+        bool                       complete = true;
+        LayerSet                   processed { layer };
+        std::deque<SdfLayerHandle> processing { layer };
+        while (!processing.empty()) {
+            const SdfLayerHandle layerToProcess = processing.front();
+            processing.pop_front();
+            for (const std::string& path : layerToProcess->GetSubLayerPaths()) {
+                const SdfLayerHandle sublayer = SdfLayer::FindRelativeToLayer(layer, path);
+                if (!sublayer) {
+                    complete = false;
+                    continue;
+                }
+                closure.emplace_back(path, sublayer);
+                // Each layer is expanded once, so that cycles end.
+                if (processed.insert(sublayer).second)
+                    processing.push_back(sublayer);
+            }
+        }
+
+        if (complete)
+            store(_closures, layer, closure);
+        return closure;
+    }
+
+    // The stronger of two layers in the tree of the root layer, each sublayer
+    // found relative to its parent. The first of the layers that a depth-first
+    // search finds is the stronger one. Returns null if neither is in the tree.
+    SdfLayerHandle getStrongerLayer(
+        const SdfLayerHandle& root,
+        const SdfLayerHandle& layer1,
+        const SdfLayerHandle& layer2)
+    {
+        LayerStrengths strengths;
+        if (!find(_strengths, root, strengths)) {
+            bool complete = true;
+            addStrengths(root, strengths, complete);
+            if (complete)
+                store(_strengths, root, strengths);
+        }
+
+        const auto strength1 = strengths.find(layer1);
+        const auto strength2 = strengths.find(layer2);
+        if (strength1 == strengths.end())
+            return strength2 == strengths.end() ? SdfLayerHandle() : layer2;
+        if (strength2 == strengths.end())
+            return layer1;
+        return strength1->second <= strength2->second ? layer1 : layer2;
+    }
+
+    // Sublayers of the layer, found or opened from their path.
+    SdfLayerHandleVector getOpenedSublayers(const SdfLayerHandle& layer)
+    {
+        SdfLayerHandleVector sublayers;
+        if (find(_openedSublayers, layer, sublayers))
+            return sublayers;
+
+        bool complete = true;
+        for (const std::string& path : layer->GetSubLayerPaths()) {
+            const SdfLayerHandle sublayer = SdfLayer::FindOrOpen(path);
+            if (sublayer)
+                sublayers.push_back(sublayer);
+            else
+                complete = false;
+        }
+
+        if (complete)
+            store(_openedSublayers, layer, sublayers);
+        return sublayers;
+    }
+
+private:
+    LayerTopologyCache()
+    {
+        TfWeakPtr<LayerTopologyCache> me(this);
+        TfNotice::Register(me, &LayerTopologyCache::onLayersChanged);
+    }
+
+    template <class T> bool find(const LayerMap<T>& cache, const SdfLayerHandle& layer, T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto found = cache.find(layer);
+        if (found == cache.end())
+            return false;
+
+        for (const auto& item : found->second)
+            if (!isValidLayer(item))
+                return false;
+
+        value = found->second;
+        return true;
+    }
+
+    template <class T> void store(LayerMap<T>& cache, const SdfLayerHandle& layer, const T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Drop the entries of the layers that have since been deleted, so that
+        // they do not pile up.
+        for (auto it = cache.begin(); it != cache.end();) {
+            if (it->first)
+                ++it;
+            else
+                it = cache.erase(it);
+        }
+
+        cache[layer] = value;
+    }
+
+    static void addStrengths(const SdfLayerHandle& layer, LayerStrengths& strengths, bool& complete)
+    {
+        // A layer found again is weaker than where it was found first.
+        if (!strengths.emplace(layer, strengths.size()).second)
+            return;
+
+        for (const std::string& path : layer->GetSubLayerPaths()) {
+            const SdfLayerHandle sublayer = SdfLayer::FindRelativeToLayer(layer, path);
+            if (sublayer)
+                addStrengths(sublayer, strengths, complete);
+            else
+                complete = false;
+        }
+    }
+
+    void onLayersChanged(const SdfNotice::LayersDidChange& notice)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+            for (const auto& pathAndEntry : layerAndChanges.second.GetEntryList()) {
+                if (pathAndEntry.first != SdfPath::AbsoluteRootPath())
+                    continue;
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                _closures.clear();
+                _strengths.clear();
+                _openedSublayers.clear();
+                return;
+            }
+        }
+    }
+
+    std::mutex                     _mutex;
+    LayerMap<Sublayers>            _closures;
+    LayerMap<LayerStrengths>       _strengths;
+    LayerMap<SdfLayerHandleVector> _openedSublayers;
+};
+
 void getAllSublayers(
     const SdfLayerRefPtr&     layer,
     std::set<std::string>*    layerIds,
     std::set<SdfLayerRefPtr>* layerRefs)
 {
-    std::deque<SdfLayerRefPtr> processing;
-    processing.push_back(layer);
-    while (!processing.empty()) {
-        auto layerToProcess = processing.front();
-        processing.pop_front();
-        SdfSubLayerProxy sublayerPaths = layerToProcess->GetSubLayerPaths();
-        for (auto path : sublayerPaths) {
-            SdfLayerRefPtr sublayer = SdfLayer::FindRelativeToLayer(layer, path);
-            if (sublayer) {
-                if (layerIds)
-                    layerIds->insert(path);
-                if (layerRefs)
-                    layerRefs->insert(sublayer);
-                processing.push_back(sublayer);
-            }
-        }
+    if (!layer)
+        return;
+
+    for (const auto& sublayer : LayerTopologyCache::instance().getSublayerClosure(layer)) {
+        if (layerIds)
+            layerIds->insert(sublayer.first);
+        if (layerRefs)
+            layerRefs->insert(sublayer.second);
     }
 }
 
@@ -88,6 +276,12 @@ getAllSublayers(const std::vector<std::string>& layerPaths, bool includeParents)
 
 bool hasMutedLayer(const PXR_NS::UsdPrim& prim)
 {
+    // Layers are muted through the stage: the layer stacks of its prims can only
+    // have muted layers when the stage has some.
+    const PXR_NS::UsdStagePtr stage = prim.GetStage();
+    if (!stage || stage->GetMutedLayers().empty())
+        return false;
+
     const PXR_NS::PcpPrimIndex& primIndex = prim.GetPrimIndex();
 
     for (const PXR_NS::PcpNodeRef node : primIndex.GetNodeRange()) {
@@ -196,19 +390,10 @@ SdfLayerHandle getStrongerLayer(
     if (root == layer2)
         return layer2;
 
-    for (auto path : root->GetSubLayerPaths()) {
-        SdfLayerRefPtr subLayer = SdfLayer::FindRelativeToLayer(root, path);
-        if (!subLayer)
-            continue;
-
-        SdfLayerHandle stronger = getStrongerLayer(subLayer, layer1, layer2);
-        if (!stronger)
-            continue;
-
-        return stronger;
-    }
+    if (!root)
+        return SdfLayerHandle();
 
-    return SdfLayerHandle();
+    return LayerTopologyCache::instance().getStrongerLayer(root, layer1, layer2);
 }
 
 SdfLayerHandle getStrongerLayer(
@@ -277,8 +462,8 @@ static void addSubLayers(const SdfLayerHandle& layer, std::set<SdfLayerHandle>&
         return;
 
     layers.insert(layer);
-    for (const std::string layerPath : layer->GetSubLayerPaths())
-        addSubLayers(SdfLayer::FindOrOpen(layerPath), layers);
+    for (const SdfLayerHandle& subLayer : LayerTopologyCache::instance().getOpenedSublayers(layer))
+        addSubLayers(subLayer, layers);
 }
 
 static bool hasSubLayerInSet(const SdfLayerHandle& layer, const std::set<SdfLayerHandle>& layers)
@@ -286,8 +471,8 @@ static bool hasSubLayerInSet(const SdfLayerHandle& layer, const std::set<SdfLaye
     if (!layer)
         return false;
 
-    for (const std::string layerPath : layer->GetSubLayerPaths())
-        if (layers.count(SdfLayer::FindOrOpen(layerPath)) > 0)
+    for (const SdfLayerHandle& subLayer : LayerTopologyCache::instance().getOpenedSublayers(layer))
+        if (layers.count(subLayer) > 0)
             return true;
 
     return false;
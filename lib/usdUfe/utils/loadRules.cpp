@@ -23,9 +23,19 @@ void duplicateLoadRules(
     const PXR_NS::SdfPath& fromPath,
     const PXR_NS::SdfPath& destPath)
 {
-    // Note: get a *copy* of the rules since we are going to insert new rules as we iterate.
+    // Note: get a *copy* of the rules, since the stage rules can only be set as a whole.
     auto loadRules = stage.GetLoadRules();
+    duplicateLoadRules(loadRules, fromPath, destPath);
+
+    // Update the rules in the stage since we were operating on a copy.
+    stage.SetLoadRules(loadRules);
+}
 
+void duplicateLoadRules(
+    PXR_NS::UsdStageLoadRules& loadRules,
+    const PXR_NS::SdfPath&     fromPath,
+    const PXR_NS::SdfPath&     destPath)
+{
     // Retrieve the effective rule for the source path.
     //
     // The reason we retrieve the effective rule is that even
@@ -50,6 +60,7 @@ void duplicateLoadRules(
     // We do this by iterating over all rules and duplicating all rules that
     // contain the source path to create rules with the destination path.
 
+    // Note: get a *copy* of the rules since we are going to insert new rules as we iterate.
     auto oldRules = loadRules.GetRules();
     for (const auto& rule : oldRules) {
         const PXR_NS::SdfPath& rulePath = rule.first;
@@ -78,10 +89,6 @@ void duplicateLoadRules(
     if (desiredRule != loadRules.GetEffectiveRuleForPath(destPath)) {
         loadRules.AddRule(destPath, desiredRule);
     }
-
-    // Update the rules in the load rules object and then in the stage
-    // since we were operating on a copy.
-    stage.SetLoadRules(loadRules);
 }
 
 void removeRulesForPath(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
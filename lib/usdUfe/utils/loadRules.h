@@ -35,6 +35,15 @@ void duplicateLoadRules(
     const PXR_NS::SdfPath& fromPath,
     const PXR_NS::SdfPath& destPath);
 
+/*! \brief modify the load rules so that the rules governing fromPath are replicated for
+ * destPath. Allows duplicating the rules of many paths before setting them once on the stage.
+ */
+USDUFE_PUBLIC
+void duplicateLoadRules(
+    PXR_NS::UsdStageLoadRules& loadRules,
+    const PXR_NS::SdfPath&     fromPath,
+    const PXR_NS::SdfPath&     destPath);
+
 /*! \brief modify the stage load rules so that all rules governing the path are removed.
  */
 USDUFE_PUBLIC
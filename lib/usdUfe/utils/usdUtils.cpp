@@ -17,6 +17,7 @@
 #include "usdUtils.h"
 
 #include <usdUfe/utils/Utils.h>
+#include <usdUfe/utils/connectionIndex.h>
 
 #include <pxr/usd/pcp/layerStack.h>
 #include <pxr/usd/sdf/layer.h>
@@ -587,22 +588,10 @@ bool canRemoveSrcProperty(const PXR_NS::UsdAttribute& srcAttr)
             return false;
         }
 
-        // Do not remove if there is a connection with a prim.
-        for (const auto& childPrim : primParent.GetChildren()) {
-            if (childPrim != prim) {
-                for (const auto& attribute : childPrim.GetAttributes()) {
-                    const PXR_NS::UsdAttribute dstUsdAttr = attribute.As<PXR_NS::UsdAttribute>();
-                    if (isConnected(srcAttr, dstUsdAttr)) {
-                        return false;
-                    }
-                }
-            }
-        }
-
-        // Do not remove if there is a connection with the parent prim.
-        for (const auto& attribute : primParent.GetAttributes()) {
-            const PXR_NS::UsdAttribute dstUsdAttr = attribute.As<PXR_NS::UsdAttribute>();
-            if (isConnected(srcAttr, dstUsdAttr)) {
+        // Do not remove if there is a connection with another prim or with the parent prim.
+        for (const auto& dstUsdAttr :
+             getConnectedDestinations(primParent, srcAttr.GetPath(), true)) {
+            if (dstUsdAttr.GetPrim() != prim) {
                 return false;
             }
         }
@@ -23,6 +23,7 @@
 #include <maya/MSelectionList.h>
 
 #include <string>
+#include <unordered_set>
 
 namespace {
 const int _translatorContextProfilerCategory
@@ -62,6 +63,25 @@ UsdStageRefPtr TranslatorContext::getUsdStage() const
     return UsdStageRefPtr();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TranslatorContext::PrimLookup& TranslatorContext::insertLookup(PrimLookup&& lookup)
+{
+    const SdfPath path = lookup.path();
+    auto          inserted = m_primMapping.emplace(path, std::move(lookup));
+    if (inserted.second) {
+        m_primMappingPaths.insert(path);
+    }
+    return inserted.first->second;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::eraseLookup(const SdfPath& path)
+{
+    if (m_primMapping.erase(path)) {
+        m_primMappingPaths.erase(path);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void TranslatorContext::validatePrims()
 {
@@ -69,12 +89,12 @@ void TranslatorContext::validatePrims()
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Validate prims");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::validatePrims ** VALIDATE PRIMS **\n");
-    for (auto it : m_primMapping) {
-        if (it.objectHandle().isValid() && it.objectHandle().isAlive()) {
+    for (const auto& it : m_primMapping) {
+        if (it.second.objectHandle().isValid() && it.second.objectHandle().isAlive()) {
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
                     "TranslatorContext::validatePrims ** VALID HANDLE DETECTED %s **\n",
-                    it.path().GetText());
+                    it.first.GetText());
         }
     }
 }
@@ -86,14 +106,13 @@ bool TranslatorContext::getTransform(const SdfPath& path, MObjectHandle& object)
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Get transform from path");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getTransform %s\n", path.GetText());
-    auto it = find(path);
-    if (it != m_primMapping.end()) {
-        if (!it->objectHandle().isValid()) {
+    if (PrimLookup* lookup = find(path)) {
+        if (!lookup->objectHandle().isValid()) {
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg("TranslatorContext::getTransform - invalid handle\n");
             return false;
         }
-        object = it->object();
+        object = lookup->object();
         return true;
     }
     return false;
@@ -106,28 +125,23 @@ void TranslatorContext::updatePrimTypes(const SdfPathSet& affectedPaths)
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Update prim types");
 
     auto stage = m_proxyShape->usdStage();
-    for (auto it = m_primMapping.begin(); it != m_primMapping.end();) {
-        SdfPath path(it->path());
+    for (auto it = m_primMappingPaths.begin(); it != m_primMappingPaths.end();) {
+        SdfPath path(*it);
+        ++it;
         UsdPrim prim = stage->GetPrimAtPath(path);
-        bool    modifiedIt = false;
         if (!prim) {
             // Check if the registered prim path is affected
             if (isDescendantPath(affectedPaths, path)) {
-                it = m_primMapping.erase(it);
-                modifiedIt = true;
+                eraseLookup(path);
             }
         } else {
             std::string translatorId
                 = m_proxyShape->translatorManufacture().generateTranslatorId(prim);
-            if (it->translatorId() != translatorId) {
-                it->translatorId() = translatorId;
-                ++it;
-                modifiedIt = true;
+            PrimLookup& lookup = m_primMapping.at(path);
+            if (lookup.translatorId() != translatorId) {
+                lookup.translatorId() = translatorId;
             }
         }
-        if (!modifiedIt) {
-            ++it;
-        }
     }
 }
 
@@ -139,11 +153,10 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObject '%s' \n", path.GetText());
 
-    auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (PrimLookup* lookup = find(path)) {
         const MTypeId zero(0);
         if (zero != typeId) {
-            for (auto temp : it->createdNodes()) {
+            for (auto temp : lookup->createdNodes()) {
                 MFnDependencyNode fn(temp.object());
                 TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                     .Msg("TranslatorContext::getMObject getting %s\n", fn.typeName().asChar());
@@ -159,12 +172,12 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
                 }
             }
         } else {
-            if (!it->createdNodes().empty()) {
+            if (!lookup->createdNodes().empty()) {
                 TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                     .Msg(
                         "TranslatorContext::getMObject getting anything %s\n",
                         path.GetString().c_str());
-                object = it->createdNodes()[0];
+                object = lookup->createdNodes()[0];
 
                 if (!object.isAlive())
                     MGlobal::displayError(
@@ -187,11 +200,10 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObject '%s' \n", path.GetText());
 
-    auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (PrimLookup* lookup = find(path)) {
         const MTypeId zero(0);
         if (MFn::kInvalid != type) {
-            for (auto temp : it->createdNodes()) {
+            for (auto temp : lookup->createdNodes()) {
                 TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                     .Msg("TranslatorContext::getMObject getting: %s\n", temp.object().apiTypeStr());
                 if (temp.object().apiType() == type) {
@@ -206,12 +218,12 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
                 }
             }
         } else {
-            if (!it->createdNodes().empty()) {
+            if (!lookup->createdNodes().empty()) {
                 TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                     .Msg(
                         "TranslatorContext::getMObject getting anything: %s\n",
                         path.GetString().c_str());
-                object = it->createdNodes()[0];
+                object = lookup->createdNodes()[0];
 
                 if (!object.isAlive())
                     MGlobal::displayError(
@@ -233,9 +245,8 @@ bool TranslatorContext::getMObjects(const SdfPath& path, MObjectHandleArray& ret
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Get MObjects");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObjects: %s\n", path.GetText());
-    auto it = find(path);
-    if (it != m_primMapping.end()) {
-        returned = it->createdNodes();
+    if (const PrimLookup* lookup = find(path)) {
+        returned = lookup->createdNodes();
         return true;
     }
     return false;
@@ -252,16 +263,15 @@ void TranslatorContext::registerItem(const UsdPrim& prim, MObjectHandle object)
             "TranslatorContext::registerItem adding entry %s[%s]\n",
             prim.GetPath().GetText(),
             object.object().apiTypeStr());
-    auto iter = findLocation(prim.GetPath());
-    if (iter == m_primMapping.end() || iter->path() != prim.GetPath()) {
+    PrimLookup* iter = find(prim.GetPath());
+    if (!iter) {
         // We keep around this legacy plugin identification by type only to allow tests which don't
         // create a proxy shape to run..
         std::string translatorId = m_proxyShape
             ? m_proxyShape->translatorManufacture().generateTranslatorId(prim)
             : "schematype:" + prim.GetTypeName().GetString();
 
-        iter
-            = m_primMapping.insert(iter, PrimLookup(prim.GetPath(), translatorId, object.object()));
+        iter = &insertLookup(PrimLookup(prim.GetPath(), translatorId, object.object()));
     } else {
         iter->setNode(object.object());
     }
@@ -294,15 +304,15 @@ void TranslatorContext::insertItem(const UsdPrim& prim, MObjectHandle object)
             prim.GetPath().GetText(),
             object.object().apiTypeStr());
 
-    auto iter = findLocation(prim.GetPath());
-    if (iter == m_primMapping.end() || iter->path() != prim.GetPath()) {
+    PrimLookup* iter = find(prim.GetPath());
+    if (!iter) {
         // We keep around this legacy plugin identification by type only to allow tests which don't
         // create a proxy shape to run..
         std::string translatorId = m_proxyShape
             ? m_proxyShape->translatorManufacture().generateTranslatorId(prim)
             : "schematype:" + prim.GetTypeName().GetString();
 
-        iter = m_primMapping.insert(iter, PrimLookup(prim.GetPath(), translatorId, MObject()));
+        iter = &insertLookup(PrimLookup(prim.GetPath(), translatorId, MObject()));
     }
 
     if (object.object() == MObject::kNullObj) {
@@ -335,10 +345,9 @@ void TranslatorContext::removeItems(const SdfPath& path)
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS)
         .Msg("TranslatorContext::removeItems remove under primPath=%s\n", path.GetText());
-    auto it = find(path);
-    if (it != m_primMapping.end() && it->path() == path) {
+    if (PrimLookup* lookup = find(path)) {
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
-            .Msg("TranslatorContext::removeItems removing path=%s\n", it->path().GetText());
+            .Msg("TranslatorContext::removeItems removing path=%s\n", path.GetText());
         MDGModifier        modifier1;
         MDagModifier       modifier2;
         MObjectHandleArray tempXforms;
@@ -347,7 +356,7 @@ void TranslatorContext::removeItems(const SdfPath& path)
         // Store the DAG nodes to delete in a vector which we will sort via their path length
         std::vector<std::pair<int, MObject>> dagNodesToDelete;
 
-        auto& nodes = it->createdNodes();
+        auto& nodes = lookup->createdNodes();
         for (std::size_t j = 0, n = nodes.size(); j < n; ++j) {
             if (nodes[j].isAlive() && nodes[j].isValid()) {
                 // Need to reparent nodes first to avoid transform getting deleted and triggering
@@ -415,7 +424,7 @@ void TranslatorContext::removeItems(const SdfPath& path)
             }
             AL_MAYA_CHECK_ERROR2(status, "failed to delete dag nodes");
         }
-        m_primMapping.erase(it);
+        eraseLookup(path);
     }
     validatePrims();
 }
@@ -450,7 +459,9 @@ MString TranslatorContext::serialise() const
     oss.str("");
     oss.clear();
 
-    for (auto it : m_primMapping) {
+    // written in path order, as the mappings used to be stored
+    for (const SdfPath& path : m_primMappingPaths) {
+        const PrimLookup& it = m_primMapping.at(path);
         oss << it.path() << "=" << it.translatorId() << ",";
         oss << getNodeName(it.object());
         for (uint32_t i = 0; i < it.createdNodes().size(); ++i) {
@@ -517,15 +528,10 @@ void TranslatorContext::deserialise(const MString& string)
             lookup.createdNodes().push_back(obj);
         }
 
-        // Check for any prim lookup duplicates.
+        // Any prim lookup duplicate is ignored.
         // This assumes lookups have 1:1 mapping of prim to translator, and that
         // multiple translators can not be registered against the same prim type.
-        auto iter
-            = std::find_if(m_primMapping.begin(), m_primMapping.end(), [&](const PrimLookup& p) {
-                  return p.path() == lookup.path();
-              });
-        if (iter == m_primMapping.end())
-            m_primMapping.push_back(lookup);
+        insertLookup(std::move(lookup));
     }
 
     SdfPathVector vec = m_proxyShape->getPrimPathsFromCommaJoinedString(
@@ -547,15 +553,14 @@ void TranslatorContext::preRemoveEntry(
     TF_DEBUG(ALUSDMAYA_TRANSLATORS)
         .Msg("TranslatorContext::preRemoveEntry primPath=%s\n", primPath.GetText());
 
-    PrimLookups::iterator end = m_primMapping.end();
-    PrimLookups::iterator range_begin
-        = std::lower_bound(m_primMapping.begin(), end, primPath, value_compare());
-    PrimLookups::iterator range_end = range_begin;
+    PrimLookupPaths::iterator end = m_primMappingPaths.end();
+    PrimLookupPaths::iterator range_begin = m_primMappingPaths.lower_bound(primPath);
+    PrimLookupPaths::iterator range_end = range_begin;
     for (; range_end != end; ++range_end) {
         // due to the joys of sorting, any child prims of this prim being destroyed should appear
         // next to each other (one would assume); So if compare does not find a match (the value is
         // something other than zero), we are no longer in the same prim root
-        const SdfPath& childPath = range_end->path();
+        const SdfPath& childPath = *range_end;
 
         if (!childPath.HasPrefix(primPath)) {
             break;
@@ -564,17 +569,21 @@ void TranslatorContext::preRemoveEntry(
 
     auto stage = m_proxyShape->usdStage();
 
+    // preRemoveEntry is often called several times before the items are removed, so check the
+    // paths already queued through a hashed set rather than searching itemsToRemove.
+    std::unordered_set<SdfPath, SdfPath::Hash> queuedItems(
+        itemsToRemove.begin(), itemsToRemove.end());
+
     // run the preTearDown stage on each prim. We will walk over the prims in the reverse order here
     // (which will guarentee the the itemsToRemove will be ordered such that the child prims will be
     // destroyed before their parents).
     auto iter = range_end;
-    itemsToRemove.reserve(itemsToRemove.size() + (range_end - range_begin));
+    itemsToRemove.reserve(itemsToRemove.size() + std::distance(range_begin, range_end));
     while (iter != range_begin) {
         --iter;
-        PrimLookup& node = *iter;
+        PrimLookup& node = m_primMapping.at(*iter);
 
-        if (std::find(itemsToRemove.begin(), itemsToRemove.end(), node.path())
-            != itemsToRemove.end()) {
+        if (!queuedItems.insert(node.path()).second) {
             // Same exact path has already been processed and added to the list of itemsToRemove.
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -607,15 +616,13 @@ void TranslatorContext::removeEntries(const SdfPathVector& itemsToRemove)
     // before children)
     auto iter = itemsToRemove.begin();
     while (iter != itemsToRemove.end()) {
-        auto path = *iter;
-        auto node
-            = std::lower_bound(m_primMapping.begin(), m_primMapping.end(), path, value_compare());
-        if (node == m_primMapping.end()) {
+        auto              path = *iter;
+        const PrimLookup* node = find(path);
+        if (!node) {
             ++iter;
             continue;
         }
         bool isInTransformChain = isPrimInTransformChain(path);
-        auto primMappingSize = m_primMapping.size();
 
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg("TranslatorContext::removeEntries removing: %s\n", iter->GetText());
@@ -623,11 +630,8 @@ void TranslatorContext::removeEntries(const SdfPathVector& itemsToRemove)
             unloadPrim(path, node->object());
         }
 
-        // The item might already have been removed by a translator...
-        if (primMappingSize == m_primMapping.size()) {
-            // remove nodes from map
-            m_primMapping.erase(node);
-        }
+        // remove nodes from map (the item might already have been removed by a translator...)
+        eraseLookup(path);
 
         if (isInTransformChain) {
             m_proxyShape->removeUsdTransformChain(path, modifier, nodes::ProxyShape::kRequired);
@@ -646,7 +650,8 @@ void TranslatorContext::updateUniqueKeys()
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Update unique keys");
 
     auto stage = getUsdStage();
-    for (auto& lookup : m_primMapping) {
+    for (auto& it : m_primMapping) {
+        PrimLookup& lookup = it.second;
         const auto& prim = stage->GetPrimAtPath(lookup.path());
         if (prim) {
             std::string translatorId = getTranslatorIdForPath(lookup.path());
@@ -684,8 +689,7 @@ void TranslatorContext::updateUniqueKey(const UsdPrim& prim)
     std::string translatorId = getTranslatorIdForPath(path);
     auto translator = m_proxyShape->translatorManufacture().getTranslatorFromId(translatorId);
     if (translator) {
-        auto it = find(path);
-        if (it != m_primMapping.end() && it->path() == path) {
+        if (PrimLookup* it = find(path)) {
             auto key(translator->generateUniqueKey(prim));
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -33,7 +33,9 @@
 #include <maya/MObjectHandle.h>
 #include <maya/MPxData.h>
 
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -248,9 +250,8 @@ public:
     /// \return the type name for that prim
     std::string getTranslatorIdForPath(SdfPath path) const
     {
-        const auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return it->translatorId();
+        if (const PrimLookup* lookup = find(path)) {
+            return lookup->translatorId();
         }
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg(
@@ -297,9 +298,8 @@ public:
     /// \return true if an entry is found that matches, false otherwise
     bool hasEntry(const SdfPath& path, const std::string& translatorId)
     {
-        auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return translatorId == it->translatorId();
+        if (const PrimLookup* lookup = find(path)) {
+            return translatorId == lookup->translatorId();
         }
         return false;
     }
@@ -327,9 +327,8 @@ public:
     /// \return unique key value
     std::size_t getUniqueKeyForPath(const SdfPath& path)
     {
-        auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return it->uniqueKey();
+        if (const PrimLookup* lookup = find(path)) {
+            return lookup->uniqueKey();
         }
         return 0;
     }
@@ -415,8 +414,11 @@ public:
         MObjectHandleArray m_createdNodes;
     };
 
-    /// a sorted array of prim mappings
-    typedef std::vector<PrimLookup> PrimLookups;
+    /// the prim mappings, hashed by prim path
+    typedef std::unordered_map<SdfPath, PrimLookup, SdfPath::Hash> PrimLookups;
+
+    /// the paths of the prim mappings, sorted so that the prims of a subtree are contiguous
+    typedef std::set<SdfPath> PrimLookupPaths;
 
     /// comparison utility (for sorting array of pointers to node references based on their path)
     struct value_compare
@@ -445,7 +447,11 @@ public:
     };
 
     /// \brief  This is used for testing only. Do not call.
-    void clearPrimMappings() { m_primMapping.clear(); }
+    void clearPrimMappings()
+    {
+        m_primMapping.clear();
+        m_primMappingPaths.clear();
+    }
 
     /// \brief  add geometry to the exclusion list
     /// \param  newPath the path to add as an excluded translator path
@@ -488,37 +494,26 @@ private:
     /// MObject. \return true if the prim maps to a MObject inside the Maya Dag tree.
     bool isPrimInTransformChain(const SdfPath& path);
 
-    inline PrimLookups::iterator find(const SdfPath& path)
+    inline PrimLookup* find(const SdfPath& path)
     {
-        PrimLookups::iterator end = m_primMapping.end();
-        PrimLookups::iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        if (it != end) {
-            if (it->path() == path)
-                return it;
-        }
-        return end;
+        auto it = m_primMapping.find(path);
+        return it != m_primMapping.end() ? &it->second : nullptr;
     }
 
-    inline PrimLookups::const_iterator find(const SdfPath& path) const
+    inline const PrimLookup* find(const SdfPath& path) const
     {
-        PrimLookups::const_iterator end = m_primMapping.end();
-        PrimLookups::const_iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        if (it != end) {
-            if (it->path() == path)
-                return it;
-        }
-        return end;
+        auto it = m_primMapping.find(path);
+        return it != m_primMapping.end() ? &it->second : nullptr;
     }
 
-    inline PrimLookups::iterator findLocation(const SdfPath& path)
-    {
-        PrimLookups::iterator end = m_primMapping.end();
-        PrimLookups::iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        return it;
-    }
+    /// \brief  adds the lookup to the mappings, unless the mappings already have one for its path
+    /// \param  lookup the lookup to add
+    /// \return the lookup stored in the mappings for the path
+    PrimLookup& insertLookup(PrimLookup&& lookup);
+
+    /// \brief  removes the lookup of the given path from the mappings, if there is one
+    /// \param  path the prim path of the lookup to remove
+    void eraseLookup(const SdfPath& path);
 
     TranslatorContext(nodes::ProxyShape* proxyShape)
         : m_proxyShape(proxyShape)
@@ -532,6 +527,9 @@ private:
     // a dependency node
     PrimLookups m_primMapping;
 
+    // the keys of m_primMapping, in path order
+    PrimLookupPaths m_primMappingPaths;
+
     // list of geometry that has been request to be excluded during the translation
     SdfInstanceMap m_excludedGeometry;
     bool           m_isExcludedGeometryDirty;
@@ -71,6 +71,10 @@ public:
 
     virtual void initialiseToPrim(bool readFromPrim = true, Scope* node = 0) { }
 
+    /// \brief  called when attributes of the prim have been edited on the stage, so that any
+    ///         value cached from the prim can be discarded.
+    virtual void invalidateCachedValues() { }
+
     /// \brief  the type ID of the transformation matrix
     AL_USDMAYA_PUBLIC
     static const MTypeId kTypeId;
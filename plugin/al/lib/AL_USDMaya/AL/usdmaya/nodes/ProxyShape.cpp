@@ -1053,18 +1053,24 @@ void ProxyShape::processChangedObjects(
         }
     }
 
-    // check to see if any transform ops have been modified (update the bounds accordingly)
-    if (!shouldCleanBBoxCache) {
-        for (const SdfPath& path : changedOnlyPaths) {
-            UsdPrim changedPrim = m_stage->GetPrimAtPath(path);
-            if (path.IsPrimPropertyPath()) {
-                const std::string tokenString = path.GetElementString();
-                if (std::strncmp(tokenString.c_str(), ".xformOp", 8) == 0
-                    || std::strncmp(tokenString.c_str(), ".visibility", 11) == 0) {
-                    shouldCleanBBoxCache = true;
-                    break;
+    // check to see if any transform ops have been modified (update the bounds accordingly, and
+    // drop the values cached by the transforms of the modified prims)
+    for (const SdfPath& path : changedOnlyPaths) {
+        if (!path.IsPrimPropertyPath()) {
+            continue;
+        }
+        const std::string tokenString = path.GetElementString();
+        if (std::strncmp(tokenString.c_str(), ".xformOp", 8) == 0) {
+            shouldCleanBBoxCache = true;
+            auto it = m_requiredPaths.find(path.GetPrimPath());
+            if (it != m_requiredPaths.end()) {
+                Scope* tm = it->second.getTransformNode();
+                if (tm && tm->transform()) {
+                    tm->transform()->invalidateCachedValues();
                 }
             }
+        } else if (std::strncmp(tokenString.c_str(), ".visibility", 11) == 0) {
+            shouldCleanBBoxCache = true;
         }
     }
 
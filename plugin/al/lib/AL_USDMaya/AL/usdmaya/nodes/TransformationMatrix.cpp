@@ -28,6 +28,8 @@
 #include <maya/MProfiler.h>
 #include <maya/MViewport2Renderer.h>
 
+#include <limits>
+
 #define AL_USDMAYA_XFORM_COMP_EPSILON 1e-7
 
 namespace {
@@ -91,6 +93,344 @@ template <> inline bool isClose(const GfHalf& x, const GfHalf& y)
     return GfIsClose(x, y, AL_USDMAYA_XFORM_COMP_EPSILON);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+bool readVectorImpl(MVector& result, const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readVector\n");
+    const SdfValueTypeName vtn = op.GetTypeName();
+    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
+    switch (attr_type) {
+    case UsdDataType::kVec3d: {
+        GfVec3d    value;
+        const bool retValue = op.template GetAs<GfVec3d>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = value[0];
+        result.y = value[1];
+        result.z = value[2];
+    } break;
+
+    case UsdDataType::kVec3f: {
+        GfVec3f    value;
+        const bool retValue = op.template GetAs<GfVec3f>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    case UsdDataType::kVec3h: {
+        GfVec3h    value;
+        const bool retValue = op.template GetAs<GfVec3h>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    case UsdDataType::kVec3i: {
+        GfVec3i    value;
+        const bool retValue = op.template GetAs<GfVec3i>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    default: return false;
+    }
+
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
+        .Msg(
+            "TransformationMatrix::readVector %f %f %f\n%s\n",
+            result.x,
+            result.y,
+            result.z,
+            op.GetOpName().GetText());
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+bool readShearImpl(MVector& result, const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readShear\n");
+    const SdfValueTypeName vtn = op.GetTypeName();
+    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
+    switch (attr_type) {
+    case UsdDataType::kMatrix4d: {
+        GfMatrix4d value;
+        const bool retValue = op.template GetAs<GfMatrix4d>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = value[1][0];
+        result.y = value[2][0];
+        result.z = value[2][1];
+    } break;
+
+    default: return false;
+    }
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
+        .Msg(
+            "TransformationMatrix::readShear %f %f %f\n%s\n",
+            result.x,
+            result.y,
+            result.z,
+            op.GetOpName().GetText());
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+bool readPointImpl(MPoint& result, const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readPoint\n");
+    const SdfValueTypeName vtn = op.GetTypeName();
+    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
+    switch (attr_type) {
+    case UsdDataType::kVec3d: {
+        GfVec3d    value;
+        const bool retValue = op.template GetAs<GfVec3d>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = value[0];
+        result.y = value[1];
+        result.z = value[2];
+    } break;
+
+    case UsdDataType::kVec3f: {
+        GfVec3f    value;
+        const bool retValue = op.template GetAs<GfVec3f>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    case UsdDataType::kVec3h: {
+        GfVec3h    value;
+        const bool retValue = op.template GetAs<GfVec3h>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    case UsdDataType::kVec3i: {
+        GfVec3i    value;
+        const bool retValue = op.template GetAs<GfVec3i>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        result.x = double(value[0]);
+        result.y = double(value[1]);
+        result.z = double(value[2]);
+    } break;
+
+    default: return false;
+    }
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
+        .Msg(
+            "TransformationMatrix::readPoint %f %f %f\n%s\n",
+            result.x,
+            result.y,
+            result.z,
+            op.GetOpName().GetText());
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+bool readMatrixImpl(MMatrix& result, const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readMatrix\n");
+    const SdfValueTypeName vtn = op.GetTypeName();
+    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
+    switch (attr_type) {
+    case UsdDataType::kMatrix4d: {
+        GfMatrix4d value;
+        const bool retValue = op.template GetAs<GfMatrix4d>(&value, timeCode);
+        if (!retValue) {
+            return false;
+        }
+        auto vtemp = (const void*)&value;
+        auto mtemp = (const MMatrix*)vtemp;
+        result = *mtemp;
+    } break;
+
+    default: return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+double readDoubleImpl(const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readDouble\n");
+    double      result = 0;
+    UsdDataType attr_type = AL::usdmaya::utils::getAttributeType(op.GetTypeName());
+    switch (attr_type) {
+    case UsdDataType::kHalf: {
+        GfHalf     value;
+        const bool retValue = op.template Get<GfHalf>(&value, timeCode);
+        if (retValue) {
+            result = float(value);
+        }
+    } break;
+
+    case UsdDataType::kFloat: {
+        float      value;
+        const bool retValue = op.template Get<float>(&value, timeCode);
+        if (retValue) {
+            result = double(value);
+        }
+    } break;
+
+    case UsdDataType::kDouble: {
+        double     value;
+        const bool retValue = op.template Get<double>(&value, timeCode);
+        if (retValue) {
+            result = value;
+        }
+    } break;
+
+    case UsdDataType::kInt: {
+        int32_t    value;
+        const bool retValue = op.template Get<int32_t>(&value, timeCode);
+        if (retValue) {
+            result = double(value);
+        }
+    } break;
+
+    default: break;
+    }
+    TF_DEBUG(ALUSDMAYA_EVALUATION)
+        .Msg("TransformationMatrix::readDouble %f\n%s\n", result, op.GetOpName().GetText());
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+template <typename XformOp>
+bool readRotationImpl(MEulerRotation& result, const XformOp& op, UsdTimeCode timeCode)
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
+        .Msg(
+            "TransformationMatrix::readRotation %f %f %f\n%s\n",
+            result.x,
+            result.y,
+            result.z,
+            op.GetOpName().GetText());
+    const double degToRad = M_PI / 180.0;
+    switch (op.GetOpType()) {
+    case UsdGeomXformOp::TypeRotateX: {
+        result.x = readDoubleImpl(op, timeCode) * degToRad;
+        result.y = 0.0;
+        result.z = 0.0;
+        result.order = MEulerRotation::kXYZ;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateY: {
+        result.x = 0.0;
+        result.y = readDoubleImpl(op, timeCode) * degToRad;
+        result.z = 0.0;
+        result.order = MEulerRotation::kXYZ;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateZ: {
+        result.x = 0.0;
+        result.y = 0.0;
+        result.z = readDoubleImpl(op, timeCode) * degToRad;
+        result.order = MEulerRotation::kXYZ;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateXYZ: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kXYZ;
+        } else
+            return false;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateXZY: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kXZY;
+        } else
+            return false;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateYXZ: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kYXZ;
+        } else
+            return false;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateYZX: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kYZX;
+        } else
+            return false;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateZXY: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kZXY;
+        } else
+            return false;
+    } break;
+
+    case UsdGeomXformOp::TypeRotateZYX: {
+        MVector v;
+        if (readVectorImpl(v, op, timeCode)) {
+            result.x = v.x * degToRad;
+            result.y = v.y * degToRad;
+            result.z = v.z * degToRad;
+            result.order = MEulerRotation::kZYX;
+        } else
+            return false;
+    } break;
+
+    default: return false;
+    }
+    return true;
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -220,65 +560,7 @@ bool TransformationMatrix::readVector(
     const UsdGeomXformOp& op,
     UsdTimeCode           timeCode)
 {
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readVector\n");
-    const SdfValueTypeName vtn = op.GetTypeName();
-    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
-    switch (attr_type) {
-    case UsdDataType::kVec3d: {
-        GfVec3d    value;
-        const bool retValue = op.GetAs<GfVec3d>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = value[0];
-        result.y = value[1];
-        result.z = value[2];
-    } break;
-
-    case UsdDataType::kVec3f: {
-        GfVec3f    value;
-        const bool retValue = op.GetAs<GfVec3f>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    case UsdDataType::kVec3h: {
-        GfVec3h    value;
-        const bool retValue = op.GetAs<GfVec3h>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    case UsdDataType::kVec3i: {
-        GfVec3i    value;
-        const bool retValue = op.GetAs<GfVec3i>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    default: return false;
-    }
-
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
-        .Msg(
-            "TransformationMatrix::readVector %f %f %f\n%s\n",
-            result.x,
-            result.y,
-            result.z,
-            op.GetOpName().GetText());
-    return true;
+    return readVectorImpl(result, op, timeCode);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -353,181 +635,81 @@ bool TransformationMatrix::pushVector(
     return true;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
-bool TransformationMatrix::pushShear(
-    const MVector&  result,
-    UsdGeomXformOp& op,
-    UsdTimeCode     timeCode)
-{
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
-        .Msg(
-            "TransformationMatrix::pushShear %f %f %f\n%s\n",
-            result.x,
-            result.y,
-            result.z,
-            op.GetOpName().GetText());
-
-    if (timeCode.IsDefault() && op.GetNumTimeSamples()) {
-        if (!hasEmptyDefaultValue(op, timeCode)) {
-            return false;
-        }
-    }
-
-    const SdfValueTypeName vtn = op.GetTypeName();
-    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
-    switch (attr_type) {
-    case UsdDataType::kMatrix4d: {
-        GfMatrix4d m(
-            1.0,
-            0.0,
-            0.0,
-            0.0,
-            result.x,
-            1.0,
-            0.0,
-            0.0,
-            result.y,
-            result.z,
-            1.0,
-            0.0,
-            0.0,
-            0.0,
-            0.0,
-            1.0);
-        GfMatrix4d oldValue;
-        oldValue.SetIdentity();
-        op.Get(&oldValue, timeCode);
-        if (!isClose(m, oldValue))
-            op.Set(m, getTimeCodeForOp(op, timeCode));
-    } break;
-
-    default: return false;
-    }
-    return false;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-bool TransformationMatrix::readShear(
-    MVector&              result,
-    const UsdGeomXformOp& op,
-    UsdTimeCode           timeCode)
-{
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readShear\n");
-    const SdfValueTypeName vtn = op.GetTypeName();
-    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
-    switch (attr_type) {
-    case UsdDataType::kMatrix4d: {
-        GfMatrix4d value;
-        const bool retValue = op.GetAs<GfMatrix4d>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = value[1][0];
-        result.y = value[2][0];
-        result.z = value[2][1];
-    } break;
-
-    default: return false;
-    }
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
-        .Msg(
-            "TransformationMatrix::readShear %f %f %f\n%s\n",
-            result.x,
-            result.y,
-            result.z,
-            op.GetOpName().GetText());
-    return true;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-bool TransformationMatrix::readPoint(MPoint& result, const UsdGeomXformOp& op, UsdTimeCode timeCode)
-{
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readPoint\n");
-    const SdfValueTypeName vtn = op.GetTypeName();
-    UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
-    switch (attr_type) {
-    case UsdDataType::kVec3d: {
-        GfVec3d    value;
-        const bool retValue = op.GetAs<GfVec3d>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = value[0];
-        result.y = value[1];
-        result.z = value[2];
-    } break;
-
-    case UsdDataType::kVec3f: {
-        GfVec3f    value;
-        const bool retValue = op.GetAs<GfVec3f>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    case UsdDataType::kVec3h: {
-        GfVec3h    value;
-        const bool retValue = op.GetAs<GfVec3h>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    case UsdDataType::kVec3i: {
-        GfVec3i    value;
-        const bool retValue = op.GetAs<GfVec3i>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        result.x = double(value[0]);
-        result.y = double(value[1]);
-        result.z = double(value[2]);
-    } break;
-
-    default: return false;
-    }
+//----------------------------------------------------------------------------------------------------------------------
+bool TransformationMatrix::pushShear(
+    const MVector&  result,
+    UsdGeomXformOp& op,
+    UsdTimeCode     timeCode)
+{
     TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
         .Msg(
-            "TransformationMatrix::readPoint %f %f %f\n%s\n",
+            "TransformationMatrix::pushShear %f %f %f\n%s\n",
             result.x,
             result.y,
             result.z,
             op.GetOpName().GetText());
 
-    return true;
-}
+    if (timeCode.IsDefault() && op.GetNumTimeSamples()) {
+        if (!hasEmptyDefaultValue(op, timeCode)) {
+            return false;
+        }
+    }
 
-//----------------------------------------------------------------------------------------------------------------------
-bool TransformationMatrix::readMatrix(
-    MMatrix&              result,
-    const UsdGeomXformOp& op,
-    UsdTimeCode           timeCode)
-{
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readMatrix\n");
     const SdfValueTypeName vtn = op.GetTypeName();
     UsdDataType            attr_type = AL::usdmaya::utils::getAttributeType(vtn);
     switch (attr_type) {
     case UsdDataType::kMatrix4d: {
-        GfMatrix4d value;
-        const bool retValue = op.GetAs<GfMatrix4d>(&value, timeCode);
-        if (!retValue) {
-            return false;
-        }
-        auto vtemp = (const void*)&value;
-        auto mtemp = (const MMatrix*)vtemp;
-        result = *mtemp;
+        GfMatrix4d m(
+            1.0,
+            0.0,
+            0.0,
+            0.0,
+            result.x,
+            1.0,
+            0.0,
+            0.0,
+            result.y,
+            result.z,
+            1.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            1.0);
+        GfMatrix4d oldValue;
+        oldValue.SetIdentity();
+        op.Get(&oldValue, timeCode);
+        if (!isClose(m, oldValue))
+            op.Set(m, getTimeCodeForOp(op, timeCode));
     } break;
 
     default: return false;
     }
+    return false;
+}
 
-    return true;
+//----------------------------------------------------------------------------------------------------------------------
+bool TransformationMatrix::readShear(
+    MVector&              result,
+    const UsdGeomXformOp& op,
+    UsdTimeCode           timeCode)
+{
+    return readShearImpl(result, op, timeCode);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool TransformationMatrix::readPoint(MPoint& result, const UsdGeomXformOp& op, UsdTimeCode timeCode)
+{
+    return readPointImpl(result, op, timeCode);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool TransformationMatrix::readMatrix(
+    MMatrix&              result,
+    const UsdGeomXformOp& op,
+    UsdTimeCode           timeCode)
+{
+    return readMatrixImpl(result, op, timeCode);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -659,47 +841,7 @@ bool TransformationMatrix::pushPoint(const MPoint& result, UsdGeomXformOp& op, U
 //----------------------------------------------------------------------------------------------------------------------
 double TransformationMatrix::readDouble(const UsdGeomXformOp& op, UsdTimeCode timeCode)
 {
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::readDouble\n");
-    double      result = 0;
-    UsdDataType attr_type = AL::usdmaya::utils::getAttributeType(op.GetTypeName());
-    switch (attr_type) {
-    case UsdDataType::kHalf: {
-        GfHalf     value;
-        const bool retValue = op.Get<GfHalf>(&value, timeCode);
-        if (retValue) {
-            result = float(value);
-        }
-    } break;
-
-    case UsdDataType::kFloat: {
-        float      value;
-        const bool retValue = op.Get<float>(&value, timeCode);
-        if (retValue) {
-            result = double(value);
-        }
-    } break;
-
-    case UsdDataType::kDouble: {
-        double     value;
-        const bool retValue = op.Get<double>(&value, timeCode);
-        if (retValue) {
-            result = value;
-        }
-    } break;
-
-    case UsdDataType::kInt: {
-        int32_t    value;
-        const bool retValue = op.Get<int32_t>(&value, timeCode);
-        if (retValue) {
-            result = double(value);
-        }
-    } break;
-
-    default: break;
-    }
-    TF_DEBUG(ALUSDMAYA_EVALUATION)
-        .Msg("TransformationMatrix::readDouble %f\n%s\n", result, op.GetOpName().GetText());
-    return result;
+    return readDoubleImpl(op, timeCode);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -754,105 +896,7 @@ bool TransformationMatrix::readRotation(
     const UsdGeomXformOp& op,
     UsdTimeCode           timeCode)
 {
-    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX)
-        .Msg(
-            "TransformationMatrix::readRotation %f %f %f\n%s\n",
-            result.x,
-            result.y,
-            result.z,
-            op.GetOpName().GetText());
-    const double degToRad = M_PI / 180.0;
-    switch (op.GetOpType()) {
-    case UsdGeomXformOp::TypeRotateX: {
-        result.x = readDouble(op, timeCode) * degToRad;
-        result.y = 0.0;
-        result.z = 0.0;
-        result.order = MEulerRotation::kXYZ;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateY: {
-        result.x = 0.0;
-        result.y = readDouble(op, timeCode) * degToRad;
-        result.z = 0.0;
-        result.order = MEulerRotation::kXYZ;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateZ: {
-        result.x = 0.0;
-        result.y = 0.0;
-        result.z = readDouble(op, timeCode) * degToRad;
-        result.order = MEulerRotation::kXYZ;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateXYZ: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kXYZ;
-        } else
-            return false;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateXZY: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kXZY;
-        } else
-            return false;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateYXZ: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kYXZ;
-        } else
-            return false;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateYZX: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kYZX;
-        } else
-            return false;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateZXY: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kZXY;
-        } else
-            return false;
-    } break;
-
-    case UsdGeomXformOp::TypeRotateZYX: {
-        MVector v;
-        if (readVector(v, op, timeCode)) {
-            result.x = v.x * degToRad;
-            result.y = v.y * degToRad;
-            result.z = v.z * degToRad;
-            result.order = MEulerRotation::kZYX;
-        } else
-            return false;
-    } break;
-
-    default: return false;
-    }
-    return true;
+    return readRotationImpl(result, op, timeCode);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -920,6 +964,7 @@ void TransformationMatrix::initialiseToPrim(bool readFromPrim, Scope* transformN
     bool resetsXformStack = false;
     m_xformops = m_xform.GetOrderedXformOps(&resetsXformStack);
     m_orderedOps.resize(m_xformops.size());
+    m_xformOpCache.clear();
 
     if (!resetsXformStack) {
         m_flags |= kInheritsTransform;
@@ -1170,6 +1215,89 @@ void TransformationMatrix::initialiseToPrim(bool readFromPrim, Scope* transformN
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TransformationMatrix::XformOpCache::XformOpCache(
+    const UsdGeomXformOp& op,
+    UsdInterpolationType  interpolation)
+    : query(op.GetAttr())
+    , typeName(op.GetTypeName())
+    , opName(op.GetOpName())
+    , opType(op.GetOpType())
+    , heldInterpolation(interpolation == UsdInterpolationTypeHeld)
+{
+    hasTimeSamples = query.GetNumTimeSamples() >= 1;
+    if (hasTimeSamples) {
+        double lower = 0, upper = 0;
+        bool   hasSamples = false;
+        query.GetBracketingTimeSamples(
+            std::numeric_limits<double>::lowest(), &lower, &upper, &hasSamples);
+        firstSampleTime = lower;
+        query.GetBracketingTimeSamples(
+            std::numeric_limits<double>::max(), &lower, &upper, &hasSamples);
+        lastSampleTime = upper;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool TransformationMatrix::XformOpCache::isValueValidAt(const UsdTimeCode& timeCode) const
+{
+    if (!valueValid) {
+        return false;
+    }
+    if (timeCode.IsDefault() || valueReadAtDefault) {
+        return timeCode.IsDefault() && valueReadAtDefault;
+    }
+    const double time = timeCode.GetValue();
+    return time >= validFrom && (validToInclusive ? time <= validTo : time < validTo);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TransformationMatrix::XformOpCache::setValueReadAt(const UsdTimeCode& timeCode)
+{
+    valueValid = true;
+    valueReadAtDefault = timeCode.IsDefault();
+    if (valueReadAtDefault) {
+        return;
+    }
+
+    // USD holds the first and last samples outside of the sampled range, and held interpolation
+    // keeps the value constant between two samples. Any other time has to be read again.
+    const double time = timeCode.GetValue();
+    validToInclusive = true;
+    validFrom = time;
+    validTo = time;
+    if (time <= firstSampleTime) {
+        validFrom = std::numeric_limits<double>::lowest();
+        validTo = firstSampleTime;
+    } else if (time >= lastSampleTime) {
+        validFrom = lastSampleTime;
+        validTo = std::numeric_limits<double>::max();
+    } else if (heldInterpolation) {
+        double lower = 0, upper = 0;
+        bool   hasSamples = false;
+        if (query.GetBracketingTimeSamples(time, &lower, &upper, &hasSamples) && lower < upper) {
+            validFrom = lower;
+            validTo = upper;
+            validToInclusive = false;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TransformationMatrix::buildXformOpCache()
+{
+    TF_DEBUG(ALUSDMAYA_TRANSFORM_MATRIX).Msg("TransformationMatrix::buildXformOpCache\n");
+    const UsdInterpolationType interpolation = m_prim.GetStage()
+        ? m_prim.GetStage()->GetInterpolationType()
+        : UsdInterpolationTypeLinear;
+
+    m_xformOpCache.clear();
+    m_xformOpCache.reserve(m_xformops.size());
+    for (const UsdGeomXformOp& op : m_xformops) {
+        m_xformOpCache.emplace_back(op, interpolation);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void TransformationMatrix::updateToTime(const UsdTimeCode& time)
 {
@@ -1184,79 +1312,88 @@ void TransformationMatrix::updateToTime(const UsdTimeCode& time)
     }
     if (m_time != time) {
         m_time = time;
-        {
-            auto opIt = m_orderedOps.begin();
-            for (std::vector<UsdGeomXformOp>::const_iterator it = m_xformops.begin(),
-                                                             e = m_xformops.end();
-                 it != e;
-                 ++it, ++opIt) {
-                const UsdGeomXformOp& op = *it;
-                switch (*opIt) {
-                case kTranslate: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedTranslation;
-                        internal_readVector(m_translationFromUsd, op);
-                        MPxTransformationMatrix::translationValue
-                            = m_translationFromUsd + m_translationTweak;
-                    }
-                } break;
-
-                case kRotate: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedRotation;
-                        internal_readRotation(m_rotationFromUsd, op);
-                        MPxTransformationMatrix::rotationValue = m_rotationFromUsd;
-                        MPxTransformationMatrix::rotationValue.x += m_rotationTweak.x;
-                        MPxTransformationMatrix::rotationValue.y += m_rotationTweak.y;
-                        MPxTransformationMatrix::rotationValue.z += m_rotationTweak.z;
-                    }
-                } break;
 
-                case kScale: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedScale;
-                        internal_readVector(m_scaleFromUsd, op);
-                        MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
-                    }
-                } break;
+        // The op queries, the sample ranges and the last read values are cached per op, so static
+        // ops are skipped and animated ops are only read when their value may have changed.
+        if (m_xformOpCache.size() != m_xformops.size()) {
+            buildXformOpCache();
+        }
+        const UsdTimeCode timeCode = getTimeCode();
 
-                case kShear: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedShear;
-                        internal_readShear(m_shearFromUsd, op);
-                        MPxTransformationMatrix::shearValue = m_shearFromUsd + m_shearTweak;
-                    }
-                } break;
-
-                case kTransform: {
-                    if (op.GetNumTimeSamples() >= 1) {
-                        m_flags |= kAnimatedMatrix;
-                        GfMatrix4d matrix;
-                        matrix.SetIdentity();
-                        op.Get<GfMatrix4d>(&matrix, getTimeCode());
-                        double T[3] {};
-                        double S[3] {};
-                        AL::usdmaya::utils::matrixToSRT(matrix, S, m_rotationFromUsd, T);
-                        m_scaleFromUsd.x = S[0];
-                        m_scaleFromUsd.y = S[1];
-                        m_scaleFromUsd.z = S[2];
-                        m_translationFromUsd.x = T[0];
-                        m_translationFromUsd.y = T[1];
-                        m_translationFromUsd.z = T[2];
-                        MPxTransformationMatrix::rotationValue.x
-                            = m_rotationFromUsd.x + m_rotationTweak.x;
-                        MPxTransformationMatrix::rotationValue.y
-                            = m_rotationFromUsd.y + m_rotationTweak.y;
-                        MPxTransformationMatrix::rotationValue.z
-                            = m_rotationFromUsd.z + m_rotationTweak.z;
-                        MPxTransformationMatrix::translationValue
-                            = m_translationFromUsd + m_translationTweak;
-                        MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
-                    }
-                } break;
+        for (size_t i = 0, n = m_xformops.size(); i < n; ++i) {
+            XformOpCache& cache = m_xformOpCache[i];
+            if (!cache.hasTimeSamples) {
+                continue;
+            }
+            const bool needsRead = !cache.isValueValidAt(timeCode);
+
+            switch (m_orderedOps[i]) {
+            case kTranslate: {
+                m_flags |= kAnimatedTranslation;
+                if (needsRead) {
+                    readVectorImpl(m_translationFromUsd, cache, timeCode);
+                    cache.setValueReadAt(timeCode);
+                }
+                MPxTransformationMatrix::translationValue
+                    = m_translationFromUsd + m_translationTweak;
+            } break;
+
+            case kRotate: {
+                m_flags |= kAnimatedRotation;
+                if (needsRead) {
+                    readRotationImpl(m_rotationFromUsd, cache, timeCode);
+                    cache.setValueReadAt(timeCode);
+                }
+                MPxTransformationMatrix::rotationValue = m_rotationFromUsd;
+                MPxTransformationMatrix::rotationValue.x += m_rotationTweak.x;
+                MPxTransformationMatrix::rotationValue.y += m_rotationTweak.y;
+                MPxTransformationMatrix::rotationValue.z += m_rotationTweak.z;
+            } break;
+
+            case kScale: {
+                m_flags |= kAnimatedScale;
+                if (needsRead) {
+                    readVectorImpl(m_scaleFromUsd, cache, timeCode);
+                    cache.setValueReadAt(timeCode);
+                }
+                MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
+            } break;
+
+            case kShear: {
+                m_flags |= kAnimatedShear;
+                if (needsRead) {
+                    readShearImpl(m_shearFromUsd, cache, timeCode);
+                    cache.setValueReadAt(timeCode);
+                }
+                MPxTransformationMatrix::shearValue = m_shearFromUsd + m_shearTweak;
+            } break;
 
-                default: break;
+            case kTransform: {
+                m_flags |= kAnimatedMatrix;
+                if (needsRead) {
+                    GfMatrix4d matrix;
+                    matrix.SetIdentity();
+                    cache.Get<GfMatrix4d>(&matrix, timeCode);
+                    cache.setValueReadAt(timeCode);
+                    double T[3] {};
+                    double S[3] {};
+                    AL::usdmaya::utils::matrixToSRT(matrix, S, m_rotationFromUsd, T);
+                    m_scaleFromUsd.x = S[0];
+                    m_scaleFromUsd.y = S[1];
+                    m_scaleFromUsd.z = S[2];
+                    m_translationFromUsd.x = T[0];
+                    m_translationFromUsd.y = T[1];
+                    m_translationFromUsd.z = T[2];
                 }
+                MPxTransformationMatrix::rotationValue.x = m_rotationFromUsd.x + m_rotationTweak.x;
+                MPxTransformationMatrix::rotationValue.y = m_rotationFromUsd.y + m_rotationTweak.y;
+                MPxTransformationMatrix::rotationValue.z = m_rotationFromUsd.z + m_rotationTweak.z;
+                MPxTransformationMatrix::translationValue
+                    = m_translationFromUsd + m_translationTweak;
+                MPxTransformationMatrix::scaleValue = m_scaleFromUsd + m_scaleTweak;
+            } break;
+
+            default: break;
             }
         }
     }
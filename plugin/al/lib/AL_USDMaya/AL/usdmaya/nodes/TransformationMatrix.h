@@ -19,6 +19,7 @@
 #include "AL/usdmaya/TransformOperation.h"
 #include "AL/usdmaya/nodes/BasicTransformationMatrix.h"
 
+#include <pxr/usd/usd/attributeQuery.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdGeom/xformable.h>
 
@@ -45,10 +46,64 @@ class TransformationMatrix : public BasicTransformationMatrix
 
     friend class Transform;
 
+    /// \brief  Cached read state of one transform op. It lets updateToTime skip the attribute
+    ///         lookup and value resolution of the op when its value cannot have changed.
+    ///         It provides the read accessors of UsdGeomXformOp used by the read helpers.
+    struct XformOpCache
+    {
+        UsdAttributeQuery    query;
+        SdfValueTypeName     typeName;
+        TfToken              opName;
+        UsdGeomXformOp::Type opType = UsdGeomXformOp::TypeInvalid;
+        bool                 hasTimeSamples = false;
+        bool                 heldInterpolation = false;
+        double               firstSampleTime = 0;
+        double               lastSampleTime = 0;
+
+        // time interval over which the last value read remains valid
+        bool   valueValid = false;
+        bool   valueReadAtDefault = false;
+        bool   validToInclusive = true;
+        double validFrom = 0;
+        double validTo = 0;
+
+        XformOpCache(const UsdGeomXformOp& op, UsdInterpolationType interpolation);
+
+        /// \brief  true if the value read last is still the value at \p timeCode
+        bool isValueValidAt(const UsdTimeCode& timeCode) const;
+        /// \brief  records that the value has just been read at \p timeCode
+        void setValueReadAt(const UsdTimeCode& timeCode);
+
+        const SdfValueTypeName& GetTypeName() const { return typeName; }
+        const TfToken&          GetOpName() const { return opName; }
+        UsdGeomXformOp::Type    GetOpType() const { return opType; }
+        template <typename T> bool Get(T* value, UsdTimeCode timeCode) const
+        {
+            return query.Get(value, timeCode);
+        }
+        template <typename T> bool GetAs(T* value, UsdTimeCode timeCode) const
+        {
+            VtValue v;
+            if (!query.Get(&v, timeCode)) {
+                return false;
+            }
+            v.Cast<T>();
+            if (!v.IsHolding<T>()) {
+                return false;
+            }
+            *value = v.UncheckedGet<T>();
+            return true;
+        }
+    };
+
     UsdGeomXformable                m_xform;
     UsdTimeCode                     m_time;
     std::vector<UsdGeomXformOp>     m_xformops;
     std::vector<TransformOperation> m_orderedOps;
+    std::vector<XformOpCache>       m_xformOpCache;
+
+    /// \brief  (re)builds the cached state of the transform ops, one entry per op in m_xformops
+    void buildXformOpCache();
 
     // tweak values. These are applied on top of the USD transform values to produce the final
     // result.
@@ -178,26 +233,32 @@ class TransformationMatrix : public BasicTransformationMatrix
 
     bool internal_pushVector(const MVector& result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         return pushVector(result, op, getTimeCode());
     }
     bool internal_pushPoint(const MPoint& result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         return pushPoint(result, op, getTimeCode());
     }
     bool internal_pushRotation(const MEulerRotation& result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         return pushRotation(result, op, getTimeCode());
     }
     void internal_pushDouble(const double result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         pushDouble(result, op, getTimeCode());
     }
     bool internal_pushShear(const MVector& result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         return pushShear(result, op, getTimeCode());
     }
     bool internal_pushMatrix(const MMatrix& result, UsdGeomXformOp& op)
     {
+        m_xformOpCache.clear();
         return pushMatrix(result, op, getTimeCode());
     }
 
@@ -543,6 +604,11 @@ public:
     /// prim will be extracted from)
     AL_USDMAYA_PUBLIC
     void initialiseToPrim(bool readFromPrim = true, Scope* node = 0) override;
+
+    /// \brief  discards the cached transform op queries and values, so that the next call to
+    ///         updateToTime reads the ops from the prim again.
+    void invalidateCachedValues() override { m_xformOpCache.clear(); }
+
     AL_USDMAYA_PUBLIC
     void pushTranslateToPrim();
     AL_USDMAYA_PUBLIC
@@ -22,6 +22,8 @@
 #include <maya/MGlobal.h>
 #include <maya/MModelMessage.h>
 
+#include <pxr/base/tf/pyLock.h>
+
 #include <iostream>
 
 namespace AL {
@@ -1777,6 +1779,42 @@ public:
         return MGlobal::executeCommand(code, false, true);
     }
 
+    void* compilePython(const char* const code) override
+    {
+        PXR_NS::TfPyLock pyLock;
+
+        PyObject* compiledCode = Py_CompileString(code, "<AL event callback>", Py_file_input);
+        if (!compiledCode) {
+            // Let executePython report the error.
+            PyErr_Clear();
+        }
+        return compiledCode;
+    }
+
+    bool executeCompiledPython(void* compiledCode) override
+    {
+        PXR_NS::TfPyLock pyLock;
+        // Run in the same namespace as MGlobal::executePythonCommand.
+        PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+#if PY_MAJOR_VERSION >= 3
+        PyObject* result = PyEval_EvalCode((PyObject*)compiledCode, globals, globals);
+#else
+        PyObject* result = PyEval_EvalCode((PyCodeObject*)compiledCode, globals, globals);
+#endif
+        if (!result) {
+            PyErr_Print();
+            return false;
+        }
+        Py_DECREF(result);
+        return true;
+    }
+
+    void releaseCompiledPython(void* compiledCode) override
+    {
+        PXR_NS::TfPyLock pyLock;
+        Py_DECREF((PyObject*)compiledCode);
+    }
+
     void writeLog(EventSystemBinding::Type severity, const char* const text) override
     {
         switch (severity) {
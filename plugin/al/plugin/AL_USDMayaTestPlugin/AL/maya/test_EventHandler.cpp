@@ -441,6 +441,115 @@ TEST(EventScheduler, registerCallbackAgainstEventThatDoesNotExist)
     EXPECT_TRUE(eventInfo == nullptr);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Registers as many events as the nodes of a large scene would, and checks the lookups by id and
+// by name, and the reuse of the ids of the unregistered events.
+TEST(EventScheduler, registerManyEvents)
+{
+    EventScheduler   registrar(&g_eventSystem);
+    const uint32_t   numEvents = 100000;
+    std::vector<int> nodes(numEvents);
+
+    // node events share their name, and differ by their associated data
+    uint32_t numErrors = 0;
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        EventId id = registrar.registerEvent("NodeEvent", kUserSpecifiedEventType, &nodes[i], 0);
+        numErrors += (id != i + 1);
+    }
+    EXPECT_EQ(numErrors, 0u);
+    EXPECT_EQ(registrar.registeredEvents().size(), numEvents);
+    EXPECT_EQ(registrar.event("NodeEvent")->eventId(), 1u);
+    EXPECT_EQ(registrar.registerEvent("NodeEvent", kUserSpecifiedEventType, &nodes[42], 0), 0u);
+
+    // unregister every other event
+    for (uint32_t i = 0; i < numEvents; i += 2) {
+        numErrors += !registrar.unregisterEvent(i + 1);
+    }
+    EXPECT_EQ(numErrors, 0u);
+    EXPECT_EQ(registrar.registeredEvents().size(), numEvents / 2);
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        const EventDispatcher* dispatcher = registrar.event(i + 1);
+        if (i % 2) {
+            numErrors += (!dispatcher || dispatcher->associatedData() != &nodes[i]);
+        } else {
+            numErrors += (dispatcher != nullptr);
+        }
+    }
+    EXPECT_EQ(numErrors, 0u);
+    EXPECT_EQ(registrar.event("NodeEvent")->eventId(), 2u);
+
+    // the released ids are reused, the lowest first
+    for (uint32_t i = 0; i < numEvents; i += 2) {
+        EventId id = registrar.registerEvent("OtherEvent", kUserSpecifiedEventType, &nodes[i], 0);
+        numErrors += (id != i + 1);
+    }
+    EXPECT_EQ(numErrors, 0u);
+    EXPECT_EQ(registrar.event("OtherEvent")->eventId(), 1u);
+    EXPECT_EQ(registrar.registerEvent("GlobalEvent", kUserSpecifiedEventType), numEvents + 1);
+
+    EXPECT_TRUE(registrar.unregisterEvent("GlobalEvent"));
+    EXPECT_TRUE(registrar.event("GlobalEvent") == nullptr);
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        numErrors += !registrar.unregisterEvent(i + 1);
+    }
+    EXPECT_EQ(numErrors, 0u);
+    EXPECT_TRUE(registrar.registeredEvents().empty());
+    EXPECT_TRUE(registrar.event("NodeEvent") == nullptr);
+    EXPECT_TRUE(registrar.event("OtherEvent") == nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// A binding that counts how often python code is compiled and executed.
+class CompilingEventSystemBinding : public TestEventSystemBinding
+{
+public:
+    void* compilePython(const char* const code) override
+    {
+        ++numCompiled;
+        return new std::string(code);
+    }
+
+    bool executeCompiledPython(void* compiledCode) override
+    {
+        ++numExecuted;
+        return true;
+    }
+
+    void releaseCompiledPython(void* compiledCode) override
+    {
+        ++numReleased;
+        delete static_cast<std::string*>(compiledCode);
+    }
+
+    int numCompiled = 0;
+    int numExecuted = 0;
+    int numReleased = 0;
+};
+
+TEST(EventDispatcher, triggerCompiledPython)
+{
+    CompilingEventSystemBinding system;
+    {
+        EventScheduler registrar(&system);
+        EventId        id = registrar.registerEvent("eventName", kUserSpecifiedEventType);
+        CallbackId     cb = registrar.registerCallback(id, "tag", "print('triggered')", 1000, true);
+        EXPECT_TRUE(cb != 0);
+
+        // the code is compiled on the first trigger only
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_TRUE(registrar.triggerEvent(id));
+        }
+        EXPECT_EQ(system.numCompiled, 1);
+        EXPECT_EQ(system.numExecuted, 3);
+        EXPECT_EQ(system.numReleased, 0);
+
+        // the compiled code is released with its callback
+        EXPECT_TRUE(registrar.unregisterCallback(cb));
+        EXPECT_EQ(system.numReleased, 1);
+    }
+    EXPECT_EQ(system.numCompiled, 1);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 static const char* const runBasicNodeEventTest = R"(
 
@@ -42,6 +42,7 @@
 #include <maya/MSelectionList.h>
 #include <maya/MVector.h>
 
+#include <algorithm>
 #include <iostream>
 
 using AL::maya::test::buildTempPath;
@@ -1573,3 +1574,133 @@ TEST(Transform, checkTwistedRotation)
         }
     }
 }
+
+// Scrub the timeline over many animated transforms, and check that the values cached per transform
+// op match the values authored in USD, including after the time samples have been edited.
+TEST(Transform, cachedTransformOpValues)
+{
+    const int numXforms = 50;
+    const int firstFrame = 1;
+    const int lastFrame = 24;
+
+    auto translationAt = [](int index, double frame) {
+        const double t = std::min(std::max(frame, double(firstFrame)), double(lastFrame));
+        return GfVec3d(index, t, -t);
+    };
+
+    MFileIO::newFile(true);
+    MGlobal::executeCommand(MString("evaluationManager -mode \"parallel\";"));
+
+    const std::string temp_path
+        = buildTempPath("AL_USDMayaTests_transform_cachedTransformOpValues.usda");
+
+    // generate some data for the proxy shape: an animated translation and static rotation and
+    // scale on every transform
+    {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        UsdGeomXform::Define(stage, SdfPath("/root"));
+        for (int i = 0; i < numXforms; ++i) {
+            UsdGeomXform xform = UsdGeomXform::Define(
+                stage, SdfPath("/root").AppendChild(TfToken("xform" + std::to_string(i))));
+            auto translateOp = xform.AddTranslateOp();
+            for (int frame = firstFrame; frame <= lastFrame; ++frame) {
+                translateOp.Set(translationAt(i, frame), UsdTimeCode(frame));
+            }
+            xform.AddRotateXYZOp().Set(GfVec3f(10.0f, 20.0f, 30.0f));
+            xform.AddScaleOp().Set(GfVec3f(2.0f));
+        }
+        stage->Export(temp_path, false);
+    }
+
+    MFnDagNode fn;
+    MObject    xform = fn.create("transform");
+    MObject    shape = fn.create("AL_usdmaya_ProxyShape", xform);
+
+    AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+    MGlobal::executeCommand(
+        MString("connectAttr -f \"time1.outTime\" \"") + fn.name() + ".time\";");
+
+    // force the stage to load
+    proxy->filePathPlug().setString(temp_path.c_str());
+
+    auto stage = proxy->getUsdStage();
+
+    MDagModifier modifier1;
+    MDGModifier  modifier2;
+    proxy->makeUsdTransforms(
+        stage->GetPrimAtPath(SdfPath("/root")),
+        modifier1,
+        AL::usdmaya::nodes::ProxyShape::kRequested,
+        &modifier2);
+    EXPECT_EQ(MStatus(MS::kSuccess), modifier1.doIt());
+    EXPECT_EQ(MStatus(MS::kSuccess), modifier2.doIt());
+
+    std::vector<std::pair<int, MObject>> transforms;
+    for (MItDependencyNodes it(MFn::kPluginTransformNode); !it.isDone(); it.next()) {
+        MFnDependencyNode              fnNode(it.item());
+        AL::usdmaya::nodes::Transform* ptr = (AL::usdmaya::nodes::Transform*)fnNode.userNode();
+        const std::string              path = ptr->primPathPlug().asString().asChar();
+        const std::string              prefix = "/root/xform";
+        if (path.compare(0, prefix.size(), prefix) == 0) {
+            transforms.emplace_back(std::stoi(path.substr(prefix.size())), it.item());
+        }
+    }
+    ASSERT_EQ(size_t(numXforms), transforms.size());
+
+    // the translate op of each transform, to compare the cached values with the values read from
+    // USD at the same time
+    std::vector<UsdGeomXformOp> translateOps;
+    for (const auto& transform : transforms) {
+        UsdGeomXformable xformable(
+            stage->GetPrimAtPath(SdfPath("/root/xform" + std::to_string(transform.first))));
+        bool resetsXformStack = false;
+        auto ops = xformable.GetOrderedXformOps(&resetsXformStack);
+        ASSERT_FALSE(ops.empty());
+        translateOps.push_back(ops[0]);
+    }
+
+    auto checkFrame = [&](double frame) {
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            const auto&  transform = transforms[i];
+            MFnTransform fnx(transform.second);
+            GfVec3d      expected;
+            ASSERT_TRUE(translateOps[i].Get(&expected, UsdTimeCode(frame)));
+            const MVector translation = fnx.getTranslation(MSpace::kTransform);
+            EXPECT_NEAR(expected[0], translation.x, 1e-5);
+            EXPECT_NEAR(expected[1], translation.y, 1e-5);
+            EXPECT_NEAR(expected[2], translation.z, 1e-5);
+
+            MEulerRotation rotation;
+            fnx.getRotation(rotation);
+            EXPECT_NEAR(10.0 * M_PI / 180.0, rotation.x, 1e-5);
+            EXPECT_NEAR(30.0 * M_PI / 180.0, rotation.z, 1e-5);
+        }
+    };
+
+    // scrub forward and backward, including frames before and after the sampled range
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int frame = firstFrame - 5; frame <= lastFrame + 5; ++frame) {
+            const int current = pass ? (lastFrame + firstFrame - frame) : frame;
+            MAnimControl::setCurrentTime(MTime(current, MTime::uiUnit()));
+            checkFrame(current);
+        }
+    }
+
+    // editing the time samples on the stage invalidates the cached values, here the value read
+    // after the last sample
+    MAnimControl::setCurrentTime(MTime(lastFrame + 5, MTime::uiUnit()));
+    checkFrame(lastFrame + 5);
+    for (const auto& translateOp : translateOps) {
+        translateOp.Set(GfVec3d(0.0, 0.0, 0.0), UsdTimeCode(lastFrame + 10));
+    }
+    MAnimControl::setCurrentTime(MTime(lastFrame + 10, MTime::uiUnit()));
+    for (const auto& transform : transforms) {
+        MFnTransform fnx(transform.second);
+        EXPECT_TRUE(fnx.getTranslation(MSpace::kTransform).isEquivalent(MVector::zero, 1e-5));
+    }
+    // the value read before the edit is now interpolated towards the new sample
+    MAnimControl::setCurrentTime(MTime(lastFrame + 5, MTime::uiUnit()));
+    checkFrame(lastFrame + 5);
+    MAnimControl::setCurrentTime(MTime(lastFrame, MTime::uiUnit()));
+    checkFrame(lastFrame);
+}
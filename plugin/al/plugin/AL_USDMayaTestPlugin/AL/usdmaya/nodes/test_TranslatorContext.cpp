@@ -277,3 +277,98 @@ TEST(TranslatorContext, TranslatorContext)
 // bool callPreUnload=true); void TranslatorContext::removeEntries(const SdfPathVector&
 // itemsToRemove);
 TEST(SchemaNodeRefDB, addRemoveEntries) { AL_USDMAYA_UNTESTED; }
+
+// Register, look up, serialise and remove the mappings of many prims, registered out of order.
+TEST(TranslatorContext, bulkRegisterAndRemove)
+{
+    const int numGroups = 50;
+    const int numPrimsPerGroup = 20;
+
+    MFileIO::newFile(true);
+
+    const std::string temp_path = buildTempPath("AL_USDMayaTests_bulkTranslatorContext.usda");
+    {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        UsdGeomXform::Define(stage, SdfPath("/root"));
+        for (int g = 0; g < numGroups; ++g) {
+            const SdfPath groupPath("/root/group" + std::to_string(g));
+            UsdGeomXform::Define(stage, groupPath);
+            for (int i = 0; i < numPrimsPerGroup; ++i) {
+                UsdGeomXform::Define(
+                    stage, groupPath.AppendChild(TfToken("prim" + std::to_string(i))));
+            }
+        }
+        stage->Export(temp_path, false);
+    }
+
+    MFnDagNode fn;
+    MObject    xform = fn.create("transform");
+    MObject    shape = fn.create("AL_usdmaya_ProxyShape", xform);
+
+    AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+    proxy->filePathPlug().setString(temp_path.c_str());
+    auto stage = proxy->getUsdStage();
+
+    AL::usdmaya::fileio::translators::TranslatorContextPtr context = proxy->context();
+    context->clearPrimMappings();
+
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim& prim : stage->GetPrimAtPath(SdfPath("/root")).GetDescendants()) {
+        prims.push_back(prim);
+    }
+    ASSERT_EQ(size_t(numGroups * (numPrimsPerGroup + 1)), prims.size());
+
+    // register in reverse order, the worst case for a sorted array
+    for (auto it = prims.rbegin(); it != prims.rend(); ++it) {
+        context->registerItem(*it, MObjectHandle());
+    }
+
+    for (const UsdPrim& prim : prims) {
+        EXPECT_FALSE(context->getTranslatorIdForPath(prim.GetPath()).empty());
+    }
+    EXPECT_TRUE(context->getTranslatorIdForPath(SdfPath("/root/nothere")).empty());
+
+    // the serialised mappings stay in path order, and survive a round trip
+    const MString text = context->serialise();
+    context->clearPrimMappings();
+    context->deserialise(text);
+    EXPECT_EQ(text, context->serialise());
+
+    MStringArray entries;
+    text.split(';', entries);
+    ASSERT_EQ(prims.size(), entries.length());
+    for (unsigned int i = 1; i < entries.length(); ++i) {
+        MStringArray previous, current;
+        entries[i - 1].split('=', previous);
+        entries[i].split('=', current);
+        EXPECT_TRUE(SdfPath(previous[0].asChar()) < SdfPath(current[0].asChar()));
+    }
+
+    // a subtree query only returns the prims of that subtree, children before their parents
+    {
+        SdfPathVector itemsToRemove;
+        const SdfPath groupPath("/root/group42");
+        context->preRemoveEntry(groupPath, itemsToRemove, false);
+        ASSERT_EQ(size_t(numPrimsPerGroup + 1), itemsToRemove.size());
+        for (const SdfPath& path : itemsToRemove) {
+            EXPECT_TRUE(path.HasPrefix(groupPath));
+        }
+        EXPECT_EQ(groupPath, itemsToRemove.back());
+
+        // querying the same subtree again does not add its prims twice
+        context->preRemoveEntry(SdfPath("/root"), itemsToRemove, false);
+        EXPECT_EQ(prims.size(), itemsToRemove.size());
+    }
+
+    // remove everything, one subtree at a time
+    for (int g = 0; g < numGroups; ++g) {
+        SdfPathVector itemsToRemove;
+        context->preRemoveEntry(SdfPath("/root/group" + std::to_string(g)), itemsToRemove, false);
+        context->removeEntries(itemsToRemove);
+    }
+
+    for (const UsdPrim& prim : prims) {
+        EXPECT_TRUE(context->getTranslatorIdForPath(prim.GetPath()).empty());
+    }
+    EXPECT_EQ(MString(), context->serialise());
+}
@@ -215,6 +215,15 @@ bool EventDispatcher::unregisterCallback(CallbackId callbackId, Callback& info)
     return false;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+size_t EventScheduler::EventKeyHash::operator()(const EventKey& key) const
+{
+    size_t hash = std::hash<std::string>()(key.name);
+    hash ^= std::hash<const void*>()(key.associatedData) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<CallbackId>()(key.parentCallback) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 EventId EventScheduler::registerEvent(
     const char* eventName,
@@ -222,44 +231,83 @@ EventId EventScheduler::registerEvent(
     const void* associatedData,
     CallbackId  parentCallback)
 {
-    auto    insertLocation = m_registeredEvents.end();
-    EventId unusedId = 1;
-    for (auto& it : m_registeredEvents) {
-        if (it.name() == eventName) {
-            if (it.eventType() == kUnknownEventType) {
-                it.m_eventType = eventType;
-                it.m_associatedData = associatedData;
-                it.m_parentCallback = parentCallback;
-                return it.eventId();
-            } else if (
-                it.parentCallbackId() == parentCallback && it.associatedData() == associatedData) {
-                m_system->error("The event \"%s\" has already been registered", eventName);
-                return 0;
-            }
-        }
+    EventKey key { eventName, associatedData, parentCallback };
+    auto     existing = m_eventKeys.find(key);
+    if (existing == m_eventKeys.end()) {
+        // Callbacks built against an event that does not exist yet register it with an unknown
+        // type and no associated data: the first registration of that name takes it over.
+        existing = m_eventKeys.find(EventKey { eventName, nullptr, 0 });
     }
-    for (auto it = m_registeredEvents.begin(), e = m_registeredEvents.end(); it != e;
-         ++it, ++unusedId) {
-        if (it->eventId() != unusedId) {
-            insertLocation = it;
-            break;
+    if (existing != m_eventKeys.end()) {
+        EventDispatcher& dispatcher = m_registeredEvents[m_eventIndices[existing->second]];
+        if (dispatcher.eventType() == kUnknownEventType) {
+            const EventId eventId = existing->second;
+            dispatcher.m_eventType = eventType;
+            dispatcher.m_associatedData = associatedData;
+            dispatcher.m_parentCallback = parentCallback;
+            m_eventKeys.erase(existing);
+            m_eventKeys.emplace(std::move(key), eventId);
+            return eventId;
+        } else if (
+            dispatcher.parentCallbackId() == parentCallback
+            && dispatcher.associatedData() == associatedData) {
+            m_system->error("The event \"%s\" has already been registered", eventName);
+            return 0;
         }
     }
 
-    m_registeredEvents.emplace(
-        insertLocation, m_system, eventName, unusedId, eventType, associatedData, parentCallback);
-    return unusedId;
+    // Reuse the lowest id released by an unregistered event.
+    EventId eventId = m_nextEventId;
+    if (!m_freeEventIds.empty()) {
+        eventId = m_freeEventIds.top();
+        m_freeEventIds.pop();
+    } else if (eventId >= (EventId(1) << kNumEventIdBits)) {
+        m_system->error(
+            "The event \"%s\" can not be registered, too many events are registered", eventName);
+        return 0;
+    } else {
+        ++m_nextEventId;
+    }
+
+    m_eventIndices.emplace(eventId, m_registeredEvents.size());
+    m_eventNames[eventName].insert(eventId);
+    m_eventKeys.emplace(std::move(key), eventId);
+    m_registeredEvents.emplace_back(
+        m_system, eventName, eventId, eventType, associatedData, parentCallback);
+    return eventId;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void EventScheduler::removeEvent(size_t index)
+{
+    const EventDispatcher& dispatcher = m_registeredEvents[index];
+    const EventId          eventId = dispatcher.eventId();
+
+    auto names = m_eventNames.find(dispatcher.name());
+    names->second.erase(eventId);
+    if (names->second.empty()) {
+        m_eventNames.erase(names);
+    }
+    m_eventKeys.erase(
+        EventKey { dispatcher.name(), dispatcher.associatedData(), dispatcher.parentCallbackId() });
+    m_eventIndices.erase(eventId);
+    m_freeEventIds.push(eventId);
+
+    // Move the last event in the free slot rather than shifting all the following events.
+    if (index + 1 != m_registeredEvents.size()) {
+        m_registeredEvents[index] = std::move(m_registeredEvents.back());
+        m_eventIndices[m_registeredEvents[index].eventId()] = index;
+    }
+    m_registeredEvents.pop_back();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 bool EventScheduler::unregisterEvent(EventId eventId)
 {
-    auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
-    if (it != m_registeredEvents.end()) {
-        if (it->eventId() == eventId) {
-            m_registeredEvents.erase(it);
-            return true;
-        }
+    auto it = m_eventIndices.find(eventId);
+    if (it != m_eventIndices.end()) {
+        removeEvent(it->second);
+        return true;
     }
     return false;
 }
@@ -267,10 +315,14 @@ bool EventScheduler::unregisterEvent(EventId eventId)
 //----------------------------------------------------------------------------------------------------------------------
 bool EventScheduler::unregisterEvent(const char* const eventName)
 {
-    for (auto it = m_registeredEvents.begin(), e = m_registeredEvents.end(); it != e; ++it) {
-        if (it->name() == eventName && it->associatedData() == 0) {
-            m_registeredEvents.erase(it);
-            return true;
+    auto names = m_eventNames.find(eventName);
+    if (names != m_eventNames.end()) {
+        for (EventId eventId : names->second) {
+            const size_t index = m_eventIndices[eventId];
+            if (m_registeredEvents[index].associatedData() == 0) {
+                removeEvent(index);
+                return true;
+            }
         }
     }
     return false;
@@ -279,11 +331,9 @@ bool EventScheduler::unregisterEvent(const char* const eventName)
 //----------------------------------------------------------------------------------------------------------------------
 EventDispatcher* EventScheduler::event(EventId eventId)
 {
-    auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
-    if (it != m_registeredEvents.end()) {
-        if (it->eventId() == eventId) {
-            return m_registeredEvents.data() + (it - m_registeredEvents.begin());
-        }
+    auto it = m_eventIndices.find(eventId);
+    if (it != m_eventIndices.end()) {
+        return m_registeredEvents.data() + it->second;
     }
     return nullptr;
 }
@@ -291,11 +341,9 @@ EventDispatcher* EventScheduler::event(EventId eventId)
 //----------------------------------------------------------------------------------------------------------------------
 const EventDispatcher* EventScheduler::event(EventId eventId) const
 {
-    auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
-    if (it != m_registeredEvents.end()) {
-        if (it->eventId() == eventId) {
-            return m_registeredEvents.data() + (it - m_registeredEvents.begin());
-        }
+    auto it = m_eventIndices.find(eventId);
+    if (it != m_eventIndices.end()) {
+        return m_registeredEvents.data() + it->second;
     }
     return nullptr;
 }
@@ -303,10 +351,9 @@ const EventDispatcher* EventScheduler::event(EventId eventId) const
 //----------------------------------------------------------------------------------------------------------------------
 EventDispatcher* EventScheduler::event(const char* const eventName)
 {
-    for (auto it = m_registeredEvents.begin(), e = m_registeredEvents.end(); it != e; ++it) {
-        if (it->name() == eventName) {
-            return m_registeredEvents.data() + (it - m_registeredEvents.begin());
-        }
+    auto names = m_eventNames.find(eventName);
+    if (names != m_eventNames.end()) {
+        return event(*names->second.begin());
     }
     return nullptr;
 }
@@ -314,10 +361,9 @@ EventDispatcher* EventScheduler::event(const char* const eventName)
 //----------------------------------------------------------------------------------------------------------------------
 const EventDispatcher* EventScheduler::event(const char* const eventName) const
 {
-    for (auto it = m_registeredEvents.begin(), e = m_registeredEvents.end(); it != e; ++it) {
-        if (it->name() == eventName) {
-            return m_registeredEvents.data() + (it - m_registeredEvents.begin());
-        }
+    auto names = m_eventNames.find(eventName);
+    if (names != m_eventNames.end()) {
+        return event(*names->second.begin());
     }
     return nullptr;
 }
@@ -18,6 +18,10 @@
 #include "AL/event/Api.h"
 
 #include <cstdarg>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -187,6 +191,22 @@ public:
     /// \return true if executed correctly
     virtual bool executeMEL(const char* const code) = 0;
 
+    /// \brief  override to compile python code once, so that the callbacks triggered many times
+    ///         do not parse their code again. The default implementation does not compile.
+    /// \param  code the code to compile
+    /// \return the compiled code passed to executeCompiledPython, or nullptr if the code has to be
+    ///         executed with executePython
+    virtual void* compilePython(const char* const code) { return nullptr; }
+
+    /// \brief  override to execute python code returned by compilePython
+    /// \param  compiledCode the compiled code to execute
+    /// \return true if executed correctly
+    virtual bool executeCompiledPython(void* compiledCode) { return false; }
+
+    /// \brief  override to release python code returned by compilePython
+    /// \param  compiledCode the compiled code to release
+    virtual void releaseCompiledPython(void* compiledCode) { }
+
     /// \brief  override to implement the logging system
     /// \param  severity
     /// \param  text the text to log
@@ -291,6 +311,7 @@ public:
         : m_tag(std::move(rhs.m_tag))
         , m_userData(rhs.m_userData)
         , m_callbackId(rhs.m_callbackId)
+        , m_compiledCode(std::move(rhs.m_compiledCode))
     {
         m_callback = rhs.m_callback;
         rhs.m_callback = nullptr;
@@ -310,6 +331,7 @@ public:
         rhs.m_callback = nullptr;
         m_weight = rhs.m_weight;
         m_functionType = rhs.m_functionType;
+        m_compiledCode = std::move(rhs.m_compiledCode);
         return *this;
     }
 
@@ -371,6 +393,7 @@ private:
         uint32_t m_weight : 30;      ///< the weighting value for the event
         uint32_t m_functionType : 2; ///< the type of callback (e.g. C++, python, MEL)
     };
+    std::shared_ptr<void> m_compiledCode; ///< the python code compiled on the first trigger
 };
 typedef std::vector<Callback> Callbacks;
 
@@ -583,7 +606,7 @@ public:
             if (callback.isCCallback()) {
                 binder(callback.userData(), callback.callback());
             } else if (callback.isPythonCallback()) {
-                if (!m_system->executePython(callback.callbackText())) {
+                if (!executePythonCallback(callback)) {
                     m_system->error(
                         "The python callback of event name \"%s\" and tag \"%s\" failed to execute "
                         "correctly",
@@ -613,7 +636,7 @@ public:
                 defaultEventFunction basic = (defaultEventFunction)callback.callback();
                 basic(callback.userData());
             } else if (callback.isPythonCallback()) {
-                if (!m_system->executePython(callback.callbackText())) {
+                if (!executePythonCallback(callback)) {
                     m_system->error(
                         "The python callback of event name \"%s\" and tag \"%s\" failed to execute "
                         "correctly",
@@ -666,6 +689,24 @@ public:
     }
 
 private:
+    /// \brief  executes a python callback, compiling its code on the first call when the system
+    ///         binding supports it
+    bool executePythonCallback(Callback& callback)
+    {
+        if (!callback.m_compiledCode) {
+            if (void* compiledCode = m_system->compilePython(callback.callbackText())) {
+                EventSystemBinding* system = m_system;
+                callback.m_compiledCode.reset(compiledCode, [system](void* code) {
+                    system->releaseCompiledPython(code);
+                });
+            }
+        }
+        if (callback.m_compiledCode) {
+            return m_system->executeCompiledPython(callback.m_compiledCode.get());
+        }
+        return m_system->executePython(callback.callbackText());
+    }
+
     AL_EVENT_PUBLIC
     CallbackId registerCallbackInternal(
         const char* const tag,
@@ -1014,7 +1055,7 @@ public:
         return InvalidCallbackId;
     }
 
-    /// \brief  provides internal access to the registered events
+    /// \brief  provides internal access to the registered events, in no particular order
     /// \return the registered events
     const EventDispatchers& registeredEvents() const { return m_registeredEvents; }
 
@@ -1036,9 +1077,42 @@ public:
     }
 
 private:
+    /// \brief  the name, associated data and parent callback that identify a registered event
+    struct EventKey
+    {
+        std::string name;
+        const void* associatedData;
+        CallbackId  parentCallback;
+
+        bool operator==(const EventKey& rhs) const
+        {
+            return associatedData == rhs.associatedData && parentCallback == rhs.parentCallback
+                && name == rhs.name;
+        }
+    };
+
+    struct EventKeyHash
+    {
+        size_t operator()(const EventKey& key) const;
+    };
+
+    /// \brief  removes the event at the specified index of m_registeredEvents, moving the last
+    ///         event in its place
+    void removeEvent(size_t index);
+
     EventSystemBinding*                                m_system;
     EventDispatchers                                   m_registeredEvents;
     std::unordered_map<EventType, CustomEventHandler*> m_customHandlers;
+    /// the index of each event in m_registeredEvents
+    std::unordered_map<EventId, size_t> m_eventIndices;
+    /// the ids of the events of each name, the lowest first
+    std::unordered_map<std::string, std::set<EventId>> m_eventNames;
+    /// the id of the event of each key
+    std::unordered_map<EventKey, EventId, EventKeyHash> m_eventKeys;
+    /// the ids released by unregistered events, the lowest first
+    std::priority_queue<EventId, std::vector<EventId>, std::greater<EventId>> m_freeEventIds;
+    /// the lowest id never used by an event
+    EventId m_nextEventId = 1;
 };
 
 class NodeEvents;
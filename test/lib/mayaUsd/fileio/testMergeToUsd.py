@@ -304,6 +304,63 @@ class MergeToUsdTestCase(unittest.TestCase):
         primSpecB = layers[1].GetPrimAtPath("/A/B")
         self.assertEqual(primSpecB.specifier, Sdf.SpecifierOver)
 
+    @unittest.skipUnless(ufeFeatureSetVersion() >= 3, 'Test only available in UFE v3 or greater.')
+    def testMergeAllToUsd(self):
+        '''Merge several edited hierarchies back to USD in one undoable operation.'''
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+
+        count = 8
+        xlateOps = []
+        usdPathStrs = []
+        for i in range(count):
+            prim = stage.DefinePrim('/X%d' % i, 'Xform')
+            xlateOp = UsdGeom.Xformable(prim).AddTranslateOp()
+            xlateOp.Set(Gf.Vec3d(i, 0, 0))
+            xlateOps.append(xlateOp)
+            usdPathStrs.append(psPathStr + ',/X%d' % i)
+
+        mayaPathStrs = []
+        mayaMatrices = []
+        for i, usdPathStr in enumerate(usdPathStrs):
+            with mayaUsd.lib.OpUndoItemList():
+                self.assertTrue(mayaUsd.lib.PrimUpdaterManager.editAsMaya(usdPathStr))
+            mayaItem = ufe.GlobalSelection.get().front()
+            (_, mayaPathStr, _, mayaMatrix) = \
+                setMayaTranslation(mayaItem, om.MVector(i, 10, 20))
+            mayaPathStrs.append(mayaPathStr)
+            mayaMatrices.append(mayaMatrix)
+
+        def verifyMerged():
+            for (usdPathStr, xlateOp, mayaPathStr, mayaMatrix) in \
+                    zip(usdPathStrs, xlateOps, mayaPathStrs, mayaMatrices):
+                usdMatrix = xlateOp.GetOpTransform(mayaUsd.ufe.getTime(usdPathStr))
+                assertVectorAlmostEqual(
+                    self, [v for v in mayaMatrix], [v for row in usdMatrix for v in row])
+                with self.assertRaises(RuntimeError):
+                    om.MSelectionList().add(mayaPathStr)
+
+        def verifyEdited():
+            for (usdPathStr, mayaPathStr) in zip(usdPathStrs, mayaPathStrs):
+                om.MSelectionList().add(mayaPathStr)
+                prim = mayaUsd.ufe.ufePathToPrim(usdPathStr)
+                self.assertTrue(mayaUsd.lib.PrimUpdaterManager.readPullInformation(prim))
+
+        # Merge all edits back to USD at once.
+        undoItems = mayaUsd.lib.OpUndoItemList()
+        with undoItems:
+            self.assertTrue(
+                mayaUsd.lib.PrimUpdaterManager.mergeAllToUsd(mayaPathStrs))
+        verifyMerged()
+
+        # A single undo restores every edited hierarchy.
+        undoItems.undo()
+        verifyEdited()
+
+        undoItems.redo()
+        verifyMerged()
+
     def testEquivalentTransformMergeToUsd(self):
         '''Merge edits on a USD transform back to USD when the new transform is equivalent.'''
 
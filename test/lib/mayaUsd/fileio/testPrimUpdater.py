@@ -16,11 +16,13 @@
 #
 
 import mayaUsd.lib as mayaUsdLib
+import mayaUsd.ufe as mayaUsdUfe
+import mayaUsd_createStageWithNewLayer
 
 from mayaUtils import setMayaTranslation
 from usdUtils import createSimpleXformScene
 
-from pxr import Usd
+from pxr import Sdf, Usd
 
 from maya import cmds
 from maya import standalone
@@ -84,6 +86,16 @@ class primUpdaterTest(mayaUsdLib.PrimUpdater):
         primUpdaterTest.pushEndCalled = True
         return super(primUpdaterTest, self).pushEnd()
 
+class primUpdaterAutoEditCounter(mayaUsdLib.PrimUpdater):
+    instanceCount = 0
+
+    def __init__(self, *args, **kwargs):
+        super(primUpdaterAutoEditCounter, self).__init__(*args, **kwargs)
+        primUpdaterAutoEditCounter.instanceCount += 1
+
+    def shouldAutoEdit(self):
+        return False
+
 class testPrimUpdater(unittest.TestCase):
     @classmethod
     def setUpClass(cls):
@@ -137,5 +149,46 @@ class testPrimUpdater(unittest.TestCase):
         # self.assertFalse(primUpdaterTest.additionalCmd.undoCalled)
         # self.assertFalse(primUpdaterTest.additionalCmd.redoCalled)
 
+    def testAutoEditScanInstantiations(self):
+        supports = primUpdaterAutoEditCounter.Supports
+        autoPull = supports.Push.value + supports.Pull.value + supports.Clear.value + supports.AutoPull.value
+        mayaUsdLib.PrimUpdater.Register(primUpdaterAutoEditCounter, "UsdGeomSphere", "mesh", autoPull)
+
+        try:
+            proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+            stage = mayaUsdUfe.getStage(proxyShape)
+
+            # A resync: only the spheres support auto-pull, so only they get
+            # an updater, once each.
+            groupCount = 20
+            scopeCount = 20
+            properties = [('radius', 1.0, 2.0),
+                          ('purpose', 'default', 'render'),
+                          ('visibility', 'inherited', 'invisible')]
+            primUpdaterAutoEditCounter.instanceCount = 0
+            with Sdf.ChangeBlock():
+                for group in range(groupCount):
+                    groupPath = '/Group%d' % group
+                    stage.DefinePrim(groupPath, 'Xform')
+                    sphere = stage.DefinePrim(groupPath + '/Sphere', 'Sphere')
+                    for name, value, _ in properties:
+                        sphere.GetAttribute(name).Set(value)
+                    for scope in range(scopeCount):
+                        stage.DefinePrim('%s/Scope%d' % (groupPath, scope), 'Scope')
+            self.assertEqual(primUpdaterAutoEditCounter.instanceCount, groupCount)
+
+            # Modifying multiple properties of a prim only checks it once. The
+            # prim used to be checked once per modified property, which would
+            # count len(properties) updaters per sphere.
+            primUpdaterAutoEditCounter.instanceCount = 0
+            with Sdf.ChangeBlock():
+                for group in range(groupCount):
+                    sphere = stage.GetPrimAtPath('/Group%d/Sphere' % group)
+                    for name, _, value in properties:
+                        sphere.GetAttribute(name).Set(value)
+            self.assertEqual(primUpdaterAutoEditCounter.instanceCount, groupCount)
+        finally:
+            mayaUsdLib.PrimUpdater.Unregister(primUpdaterAutoEditCounter, "UsdGeomSphere", "mesh", autoPull)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -0,0 +1,118 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <hdMaya/delegates/materialRprimIndex.h>
+
+#include <pxr/usd/sdf/path.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+SdfPath _RprimPath(size_t index)
+{
+    return SdfPath("/HdMayaSceneDelegate/rprim_" + std::to_string(index));
+}
+
+SdfPath _MaterialPath(size_t index)
+{
+    return SdfPath("/HdMayaSceneDelegate/material_" + std::to_string(index));
+}
+
+} // namespace
+
+TEST(MaterialRprimIndex, setAndRemove)
+{
+    HdMayaMaterialRprimIndex index;
+    const SdfPath            rprimA = _RprimPath(0);
+    const SdfPath            rprimB = _RprimPath(1);
+    const SdfPath            material1 = _MaterialPath(1);
+    const SdfPath            material2 = _MaterialPath(2);
+
+    index.SetMaterial(rprimB, material1);
+    index.SetMaterial(rprimA, material1);
+    EXPECT_EQ(index.GetRprims(material1), SdfPathVector({ rprimA, rprimB }));
+    EXPECT_TRUE(index.GetRprims(material2).empty());
+
+    // Reassignment moves the rprim to the new material.
+    index.SetMaterial(rprimA, material2);
+    EXPECT_EQ(index.GetRprims(material1), SdfPathVector({ rprimB }));
+    EXPECT_EQ(index.GetRprims(material2), SdfPathVector({ rprimA }));
+
+    // Setting the same material twice doesn't duplicate the rprim.
+    index.SetMaterial(rprimA, material2);
+    EXPECT_EQ(index.GetRprims(material2), SdfPathVector({ rprimA }));
+
+    // An empty material id is the same as no material.
+    index.SetMaterial(rprimB, SdfPath());
+    EXPECT_TRUE(index.GetRprims(material1).empty());
+    EXPECT_TRUE(index.GetRprims(SdfPath()).empty());
+
+    index.RemoveRprim(rprimA);
+    EXPECT_TRUE(index.GetRprims(material2).empty());
+
+    index.SetMaterial(rprimA, material1);
+    index.Clear();
+    EXPECT_TRUE(index.GetRprims(material1).empty());
+}
+
+TEST(MaterialRprimIndex, manyRprims)
+{
+    const size_t numRprims = 2000;
+    const size_t numMaterials = 10;
+
+    SdfPathVector rprims(numRprims);
+    SdfPathVector materials(numMaterials);
+    for (size_t i = 0; i < numRprims; ++i) {
+        rprims[i] = _RprimPath(i);
+    }
+    for (size_t i = 0; i < numMaterials; ++i) {
+        materials[i] = _MaterialPath(i);
+    }
+
+    HdMayaMaterialRprimIndex index;
+    for (size_t i = 0; i < numRprims; ++i) {
+        index.SetMaterial(rprims[i], materials[i % numMaterials]);
+    }
+
+    // Each material only gets its own rprims.
+    size_t found = 0;
+    for (size_t i = 0; i < numMaterials; ++i) {
+        const SdfPathVector materialRprims = index.GetRprims(materials[i]);
+        EXPECT_EQ(materialRprims.size(), numRprims / numMaterials);
+        for (const SdfPath& rprim : materialRprims) {
+            EXPECT_EQ(rprim.GetName().back(), '0' + static_cast<char>(i));
+        }
+        found += materialRprims.size();
+    }
+    EXPECT_EQ(found, numRprims);
+
+    // Move every rprim of the first material to the second one, then remove them.
+    const SdfPathVector firstMaterialRprims = index.GetRprims(materials[0]);
+    for (const SdfPath& rprim : firstMaterialRprims) {
+        index.SetMaterial(rprim, materials[1]);
+    }
+    EXPECT_TRUE(index.GetRprims(materials[0]).empty());
+    EXPECT_EQ(index.GetRprims(materials[1]).size(), 2 * numRprims / numMaterials);
+
+    for (const SdfPath& rprim : firstMaterialRprims) {
+        index.RemoveRprim(rprim);
+    }
+    EXPECT_EQ(index.GetRprims(materials[1]).size(), numRprims / numMaterials);
+}
@@ -0,0 +1,57 @@
+import maya.cmds as cmds
+
+import fixturesUtils
+import mtohUtils
+
+class TestMaterialRprims(mtohUtils.MtohTestCase):
+    _file = __file__
+
+    def setUp(self):
+        self.makeCubeScene()
+
+        self.cube2Trans = cmds.polyCube()[0]
+        self.cube2Shape = cmds.listRelatives(self.cube2Trans)[0]
+        self.sphereTrans = cmds.polySphere()[0]
+        self.sphereShape = cmds.listRelatives(self.sphereTrans)[0]
+
+        self.redSG = self.makeMaterial('red', (1, 0, 0))
+        self.blueSG = self.makeMaterial('blue', (0, 0, 1))
+        cmds.sets(self.cubeShape, self.cube2Shape, edit=True, forceElement=self.redSG)
+        cmds.sets(self.sphereShape, edit=True, forceElement=self.blueSG)
+        cmds.refresh(force=True)
+
+    def makeMaterial(self, name, color):
+        shader = cmds.shadingNode('lambert', asShader=True, name=name)
+        cmds.setAttr(shader + '.color', type='float3', *color)
+        sg = cmds.sets(renderable=True, noSurfaceShader=True, empty=True, name=name + 'SG')
+        cmds.connectAttr(shader + '.outColor', sg + '.surfaceShader')
+        return sg
+
+    def materialRprims(self, sg):
+        materialId = '/'.join([self.delegateId, 'materials', sg])
+        return sorted(cmds.mtoh(renderer=mtohUtils.HD_STORM, materialRprims=materialId))
+
+    def test_materialRprims(self):
+        cubeRprim = self.rprimPath(self.cubeShape)
+        cube2Rprim = self.rprimPath(self.cube2Shape)
+        sphereRprim = self.rprimPath(self.sphereShape)
+
+        # A change of a material only dirties the rprims bound to it.
+        self.assertEqual(self.materialRprims(self.redSG), sorted([cubeRprim, cube2Rprim]))
+        self.assertEqual(self.materialRprims(self.blueSG), [sphereRprim])
+
+        # Reassigned rprims move to their new material.
+        cmds.sets(self.cube2Shape, edit=True, forceElement=self.blueSG)
+        cmds.refresh(force=True)
+        self.assertEqual(self.materialRprims(self.redSG), [cubeRprim])
+        self.assertEqual(self.materialRprims(self.blueSG), sorted([cube2Rprim, sphereRprim]))
+
+        # Deleted rprims are no longer dirtied.
+        cmds.delete(self.cubeTrans)
+        cmds.refresh(force=True)
+        self.assertEqual(self.materialRprims(self.redSG), [])
+        self.assertEqual(self.materialRprims(self.blueSG), sorted([cube2Rprim, sphereRprim]))
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -0,0 +1,79 @@
+import maya.cmds as cmds
+
+import fixturesUtils
+import mtohUtils
+
+class TestMotionSamples(mtohUtils.MtohTestCase):
+    _file = __file__
+
+    SAMPLE_COUNT = 3
+    SAMPLE_TIMES = (-0.5, 0.0, 0.5)
+
+    def setUp(self):
+        self.makeCubeScene()
+        cmds.currentTime(1)
+
+        # Animate the cube from frame 1 to 10, then hold it.
+        for attr, value in (('translateX', 9), ('rotateY', 90)):
+            cmds.setKeyframe(self.cubeTrans, attribute=attr, time=1, value=0)
+            cmds.setKeyframe(self.cubeTrans, attribute=attr, time=10, value=value)
+            cmds.keyTangent(self.cubeTrans, attribute=attr,
+                            inTangentType='linear', outTangentType='linear')
+
+        cmds.mtoh(createRenderGlobals=True)
+        cmds.setAttr('defaultRenderGlobals.mtohMotionSampleStart', self.SAMPLE_TIMES[0])
+        cmds.setAttr('defaultRenderGlobals.mtohMotionSampleEnd', self.SAMPLE_TIMES[-1])
+        cmds.mtoh(updateRenderGlobals='mtohMotionSampleStart')
+        cmds.mtoh(updateRenderGlobals='mtohMotionSampleEnd')
+        cmds.refresh(force=True)
+
+    def sampleTransform(self):
+        values = cmds.mtoh(renderer=mtohUtils.HD_STORM, sampleTransform=self.cubeRprim,
+                           sampleCount=self.SAMPLE_COUNT)
+        return [(values[i], values[i + 1:i + 17]) for i in range(0, len(values), 17)]
+
+    def mayaSamples(self, frame):
+        # What the adapter evaluates at each sample time, consecutive equal samples being
+        # only returned once.
+        samples = []
+        for time in self.SAMPLE_TIMES:
+            matrix = cmds.getAttr(self.cubeShape + '.worldMatrix[0]', time=frame + time)
+            if not samples or matrix != samples[-1][1]:
+                samples.append((time, matrix))
+        return samples
+
+    def assertSamplesEqual(self, samples, expected):
+        self.assertEqual(len(samples), len(expected))
+        for (time, matrix), (expectedTime, expectedMatrix) in zip(samples, expected):
+            self.assertAlmostEqual(time, expectedTime, places=6)
+            self.assertEqual(len(matrix), 16)
+            for value, expectedValue in zip(matrix, expectedMatrix):
+                self.assertAlmostEqual(value, expectedValue, places=6)
+
+    def test_cachedSamplesMatchUncached(self):
+        # Nothing is cached for the first frame, the samples are evaluated per adapter and the
+        # sample count is recorded for the cache of the next frames.
+        firstFrame = self.sampleTransform()
+        self.assertEqual(len(firstFrame), self.SAMPLE_COUNT)
+        self.assertSamplesEqual(firstFrame, self.mayaSamples(1))
+
+        # Frame 15 is held, all its samples are the same and only returned once.
+        for frame in (2, 3, 7, 15):
+            # The animated transform is dirty after the frame change, so its samples are
+            # evaluated once for the whole scene and cached.
+            cmds.currentTime(frame)
+            cmds.refresh(force=True)
+            cached = self.sampleTransform()
+
+            # Nothing is dirty in the next refresh, so nothing is cached and the samples are
+            # evaluated per adapter again.
+            cmds.refresh(force=True)
+            uncached = self.sampleTransform()
+
+            self.assertSamplesEqual(cached, uncached)
+            self.assertSamplesEqual(cached, self.mayaSamples(frame))
+            self.assertEqual(len(cached), 1 if frame == 15 else self.SAMPLE_COUNT)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
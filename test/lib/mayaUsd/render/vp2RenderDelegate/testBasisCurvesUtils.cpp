@@ -0,0 +1,414 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/vp2RenderDelegate/basisCurvesUtils.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/iterator.h>
+#include <pxr/base/vt/value.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// The sequential builders that HdVP2BasisCurves used before they were
+// parallelized. They are the reference the new builders are compared against.
+
+template <typename T>
+VtArray<T> _ReferenceInterpolateVarying(
+    size_t            numVerts,
+    VtIntArray const& vertexCounts,
+    TfToken           wrap,
+    TfToken           basis,
+    VtArray<T> const& authoredValues)
+{
+    VtArray<T> outputValues(numVerts);
+
+    size_t srcIndex = 0;
+    size_t dstIndex = 0;
+
+    if (wrap == HdTokens->periodic) {
+        // XXX : Add support for periodic curves
+        TF_WARN("Varying data is only supported for non-periodic curves.");
+    }
+
+    TF_FOR_ALL(itVertexCount, vertexCounts)
+    {
+        int nVerts = *itVertexCount;
+
+        // Handling for the case of potentially incorrect vertex counts
+        if (nVerts < 1) {
+            continue;
+        }
+
+        if (basis == HdTokens->catmullRom || basis == HdTokens->bSpline) {
+            // For splines with a vstep of 1, we are doing linear interpolation
+            // between segments, so all we do here is duplicate the first and
+            // last outputValues. Since these are never acutally used during
+            // drawing, it would also work just to set the to 0.
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex;
+            for (int i = 1; i < nVerts - 2; ++i) {
+                outputValues[dstIndex] = authoredValues[srcIndex];
+                ++dstIndex;
+                ++srcIndex;
+            }
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex;
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex;
+            ++srcIndex;
+        } else if (basis == HdTokens->bezier) {
+            // For bezier splines, we map the linear values to cubic values
+            // the begin value gets mapped to the first two vertices and
+            // the end value gets mapped to the last two vertices in a segment.
+            // shaders can choose to access value[1] and value[2] when linearly
+            // interpolating a value, which happens to match up with the
+            // indexing to use for catmullRom and bSpline basis.
+            int vStep = 3;
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex; // don't increment the srcIndex
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex;
+            ++srcIndex;
+
+            // vstep - 1 control points will have an interpolated value
+            for (int i = 2; i < nVerts - 2; i += vStep) {
+                outputValues[dstIndex] = authoredValues[srcIndex];
+                ++dstIndex; // don't increment the srcIndex
+                outputValues[dstIndex] = authoredValues[srcIndex];
+                ++dstIndex; // don't increment the srcIndex
+                outputValues[dstIndex] = authoredValues[srcIndex];
+                ++dstIndex;
+                ++srcIndex;
+            }
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex; // don't increment the srcIndex
+            outputValues[dstIndex] = authoredValues[srcIndex];
+            ++dstIndex;
+            ++srcIndex;
+        } else {
+            TF_WARN("Unsupported basis: '%s'", basis.GetText());
+        }
+    }
+    TF_VERIFY(srcIndex == authoredValues.size());
+    TF_VERIFY(dstIndex == numVerts);
+
+    return outputValues;
+}
+
+VtValue _ReferenceCubicIndexArray(const HdBasisCurvesTopology& topology)
+{
+    std::vector<GfVec4i> indices;
+
+    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
+    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    int                vStep;
+    TfToken            basis = topology.GetCurveBasis();
+    if (basis == HdTokens->bezier) {
+        vStep = 3;
+    } else {
+        vStep = 1;
+    }
+
+    int vertexIndex = 0;
+    TF_FOR_ALL(itCounts, vertexCounts)
+    {
+        int count = *itCounts;
+        // The first segment always eats up 4 verts, not just vstep, so to
+        // compensate, we break at count - 3.
+        int numSegs;
+
+        // If we're closing the curve, make sure that we have enough
+        // segments to wrap all the way back to the beginning.
+        if (wrap) {
+            numSegs = count / vStep;
+        } else {
+            numSegs = ((count - 4) / vStep) + 1;
+        }
+
+        for (int i = 0; i < numSegs; ++i) {
+
+            // Set up curve segments based on curve basis
+            GfVec4i seg;
+            int     offset = i * vStep;
+            for (int v = 0; v < 4; ++v) {
+                // If there are not enough verts to round out the segment
+                // just repeat the last vert.
+                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
+                              : vertexIndex + std::min(offset + v, (count - 1));
+            }
+            indices.push_back(seg);
+        }
+        vertexIndex += count;
+    }
+
+    VtVec4iArray      finalIndices(indices.size());
+    VtIntArray const& curveIndices = topology.GetCurveIndices();
+
+    // If have topology has indices set, map the generated indices
+    // with the given indices.
+    if (curveIndices.empty()) {
+        std::copy(indices.begin(), indices.end(), finalIndices.begin());
+    } else {
+        size_t lineCount = indices.size();
+        int    maxIndex = curveIndices.size() - 1;
+
+        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
+            const GfVec4i& line = indices[lineNum];
+
+            int i0 = std::min(line[0], maxIndex);
+            int i1 = std::min(line[1], maxIndex);
+            int i2 = std::min(line[2], maxIndex);
+            int i3 = std::min(line[3], maxIndex);
+
+            int v0 = curveIndices[i0];
+            int v1 = curveIndices[i1];
+            int v2 = curveIndices[i2];
+            int v3 = curveIndices[i3];
+
+            finalIndices[lineNum].Set(v0, v1, v2, v3);
+        }
+    }
+
+    return VtValue(finalIndices);
+}
+
+VtValue _ReferenceLinesIndexArray(const HdBasisCurvesTopology& topology)
+{
+    std::vector<GfVec2i> indices;
+    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
+
+    int vertexIndex = 0;
+    TF_FOR_ALL(itCounts, vertexCounts)
+    {
+        for (int i = 0; i < *itCounts; i += 2) {
+            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
+            vertexIndex += 2;
+        }
+    }
+
+    VtVec2iArray      finalIndices(indices.size());
+    VtIntArray const& curveIndices = topology.GetCurveIndices();
+
+    // If have topology has indices set, map the generated indices
+    // with the given indices.
+    if (curveIndices.empty()) {
+        std::copy(indices.begin(), indices.end(), finalIndices.begin());
+    } else {
+        size_t lineCount = indices.size();
+        int    maxIndex = curveIndices.size() - 1;
+
+        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
+            const GfVec2i& line = indices[lineNum];
+
+            int i0 = std::min(line[0], maxIndex);
+            int i1 = std::min(line[1], maxIndex);
+
+            int v0 = curveIndices[i0];
+            int v1 = curveIndices[i1];
+
+            finalIndices[lineNum].Set(v0, v1);
+        }
+    }
+
+    return VtValue(finalIndices);
+}
+
+VtValue _ReferenceLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
+{
+    const TfToken basis = topology.GetCurveBasis();
+    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
+
+    std::vector<GfVec2i> indices;
+    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
+    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    int                  vertexIndex = 0; // Index of next vertex to emit
+    // For each curve
+    TF_FOR_ALL(itCounts, vertexCounts)
+    {
+        int v0 = vertexIndex;
+        int v1;
+        // Store first vert index incase we are wrapping
+        const int firstVert = v0;
+        ++vertexIndex;
+        for (int i = 1; i < *itCounts; ++i) {
+            v1 = vertexIndex;
+            ++vertexIndex;
+            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
+                indices.push_back(GfVec2i(v0, v1));
+            }
+            v0 = v1;
+        }
+        if (wrap) {
+            indices.push_back(GfVec2i(v0, firstVert));
+        }
+    }
+
+    VtVec2iArray      finalIndices(indices.size());
+    VtIntArray const& curveIndices = topology.GetCurveIndices();
+
+    // If have topology has indices set, map the generated indices
+    // with the given indices.
+    if (curveIndices.empty()) {
+        std::copy(indices.begin(), indices.end(), finalIndices.begin());
+    } else {
+        size_t lineCount = indices.size();
+        int    maxIndex = curveIndices.size() - 1;
+
+        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
+            const GfVec2i& line = indices[lineNum];
+
+            int i0 = std::min(line[0], maxIndex);
+            int i1 = std::min(line[1], maxIndex);
+
+            int v0 = curveIndices[i0];
+            int v1 = curveIndices[i1];
+
+            finalIndices[lineNum].Set(v0, v1);
+        }
+    }
+
+    return VtValue(finalIndices);
+}
+
+//! Synthetic hair-like curve set: random vertex counts valid for the given basis.
+HdBasisCurvesTopology _MakeTopology(
+    size_t         numCurves,
+    const TfToken& type,
+    const TfToken& basis,
+    const TfToken& wrap,
+    bool           withIndices)
+{
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> segments(1, 8);
+
+    const bool isBezier = (type == HdTokens->cubic && basis == HdTokens->bezier);
+
+    VtIntArray vertexCounts(numCurves);
+    int        numVerts = 0;
+    for (size_t i = 0; i < numCurves; ++i) {
+        const int numSegs = segments(rng);
+        if (wrap == HdTokens->periodic) {
+            vertexCounts[i] = isBezier ? 3 * numSegs : numSegs + 3;
+        } else if (wrap == HdTokens->segmented) {
+            vertexCounts[i] = 2 * numSegs;
+        } else {
+            vertexCounts[i] = isBezier ? 3 * numSegs + 1 : numSegs + 3;
+        }
+        numVerts += vertexCounts[i];
+    }
+
+    VtIntArray curveIndices;
+    if (withIndices) {
+        curveIndices.resize(numVerts);
+        for (int i = 0; i < numVerts; ++i) {
+            curveIndices[i] = numVerts - 1 - i;
+        }
+    }
+
+    return HdBasisCurvesTopology(type, basis, wrap, vertexCounts, curveIndices);
+}
+
+const TfToken _kBases[] = { HdTokens->bezier, HdTokens->bSpline, HdTokens->catmullRom };
+
+} // namespace
+
+TEST(HdVP2BasisCurvesUtils, cubicIndices)
+{
+    for (const TfToken& basis : _kBases) {
+        for (const TfToken& wrap : { HdTokens->nonperiodic, HdTokens->periodic }) {
+            for (bool withIndices : { false, true }) {
+                const HdBasisCurvesTopology topology
+                    = _MakeTopology(5000, HdTokens->cubic, basis, wrap, withIndices);
+
+                const VtValue expected = _ReferenceCubicIndexArray(topology);
+                const VtValue actual(HdVP2BasisCurvesUtils::BuildCubicIndexArray(topology));
+                EXPECT_EQ(expected, actual) << basis << " " << wrap << " " << withIndices;
+            }
+        }
+    }
+}
+
+TEST(HdVP2BasisCurvesUtils, lineIndices)
+{
+    for (const TfToken& basis : _kBases) {
+        for (const TfToken& wrap :
+             { HdTokens->nonperiodic, HdTokens->periodic, HdTokens->segmented }) {
+            for (bool withIndices : { false, true }) {
+                const HdBasisCurvesTopology topology
+                    = _MakeTopology(5000, HdTokens->cubic, basis, wrap, withIndices);
+
+                if (wrap == HdTokens->segmented) {
+                    const VtValue expected = _ReferenceLinesIndexArray(topology);
+                    const VtValue actual(HdVP2BasisCurvesUtils::BuildLinesIndexArray(topology));
+                    EXPECT_EQ(expected, actual) << basis << " " << withIndices;
+                } else {
+                    const VtValue expected = _ReferenceLineSegmentIndexArray(topology);
+                    const VtValue actual(
+                        HdVP2BasisCurvesUtils::BuildLineSegmentIndexArray(topology));
+                    EXPECT_EQ(expected, actual) << basis << " " << wrap << " " << withIndices;
+                }
+            }
+        }
+    }
+}
+
+TEST(HdVP2BasisCurvesUtils, interpolateVarying)
+{
+    for (const TfToken& basis : _kBases) {
+        const HdBasisCurvesTopology topology
+            = _MakeTopology(5000, HdTokens->cubic, basis, HdTokens->nonperiodic, false);
+
+        const size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
+        const size_t numVarying = topology.CalculateNeededNumberOfVaryingControlPoints();
+
+        VtVec3fArray colors(numVarying);
+        VtFloatArray widths(numVarying);
+        for (size_t i = 0; i < numVarying; ++i) {
+            colors[i] = GfVec3f(float(i), float(i) * 0.5f, 1.0f);
+            widths[i] = float(i);
+        }
+
+        EXPECT_EQ(
+            _ReferenceInterpolateVarying(
+                numVerts,
+                topology.GetCurveVertexCounts(),
+                topology.GetCurveWrap(),
+                basis,
+                colors),
+            HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, colors, GfVec3f(0.0f)))
+            << basis;
+        EXPECT_EQ(
+            _ReferenceInterpolateVarying(
+                numVerts,
+                topology.GetCurveVertexCounts(),
+                topology.GetCurveWrap(),
+                basis,
+                widths),
+            HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, widths, 1.0f))
+            << basis;
+
+        // Uniform data is expanded to every control vertex.
+        const VtFloatArray uniform
+            = HdVP2BasisCurvesUtils::BuildInterpolatedArray(topology, VtFloatArray(1, 2.0f), 1.0f);
+        ASSERT_EQ(uniform.size(), numVerts);
+        EXPECT_EQ(uniform, VtFloatArray(numVerts, 2.0f));
+    }
+}
@@ -0,0 +1,242 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/vp2RenderDelegate/meshViewportComputeCPU.h>
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/smoothNormals.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
+#include <pxr/imaging/pxOsd/tokens.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+struct _SampleMesh
+{
+    std::string    name;
+    HdMeshTopology topology;
+    VtVec3fArray   points;
+};
+
+//! Reads every mesh of the sample files used by the VP2 render delegate tests.
+std::vector<_SampleMesh> _ReadSampleMeshes()
+{
+    const std::string files[] = { "cubeRef/cube.usda",
+                                  "cylinder/cylinder.usda",
+                                  "groupCmd/sphere.usda",
+                                  "groupCmd/torus.usda",
+                                  "twoMeshSpheres/two_mesh_spheres.usda" };
+
+    std::vector<_SampleMesh> meshes;
+    for (const std::string& file : files) {
+        UsdStageRefPtr stage = UsdStage::Open(std::string(TEST_SAMPLES_DIR) + "/" + file);
+        if (!stage) {
+            ADD_FAILURE() << "Could not open " << file;
+            continue;
+        }
+
+        for (const UsdPrim& prim : stage->Traverse()) {
+            UsdGeomMesh mesh(prim);
+            if (!mesh) {
+                continue;
+            }
+
+            VtIntArray   faceVertexCounts;
+            VtIntArray   faceVertexIndices;
+            VtIntArray   holeIndices;
+            TfToken      scheme = PxOsdOpenSubdivTokens->catmullClark;
+            TfToken      orientation = PxOsdOpenSubdivTokens->rightHanded;
+            VtVec3fArray points;
+            mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+            mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+            mesh.GetHoleIndicesAttr().Get(&holeIndices);
+            mesh.GetSubdivisionSchemeAttr().Get(&scheme);
+            mesh.GetOrientationAttr().Get(&orientation);
+            mesh.GetPointsAttr().Get(&points);
+
+            meshes.push_back(
+                { prim.GetPath().GetString(),
+                  HdMeshTopology(
+                      scheme, orientation, faceVertexCounts, faceVertexIndices, holeIndices),
+                  points });
+        }
+    }
+
+    return meshes;
+}
+
+//! Vertex type for the reference Far::StencilTable::UpdateValues() evaluation.
+struct _Vertex
+{
+    void Clear() { p = GfVec3f(0.0f); }
+    void AddWithWeight(const _Vertex& src, float weight) { p += weight * src.p; }
+
+    GfVec3f p;
+};
+
+} // namespace
+
+TEST(MeshViewportComputeCPU, smoothNormalsMatchHd)
+{
+    const std::vector<_SampleMesh> meshes = _ReadSampleMeshes();
+    ASSERT_FALSE(meshes.empty());
+
+    for (const _SampleMesh& mesh : meshes) {
+        Hd_VertexAdjacency adjacency;
+        adjacency.BuildAdjacencyTable(&mesh.topology);
+
+        const VtVec3fArray expected = Hd_SmoothNormals::ComputeSmoothNormals(
+            &adjacency, mesh.points.size(), mesh.points.cdata());
+
+        std::vector<GfVec3f> normals(mesh.points.size());
+        const VtIntArray&    table = adjacency.GetAdjacencyTable();
+        MeshViewportComputeCPU::computeSmoothNormals(
+            table.cdata(),
+            table.size(),
+            mesh.points.size(),
+            mesh.points.cdata()->data(),
+            normals.data()->data());
+
+        ASSERT_LE(expected.size(), normals.size()) << mesh.name;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_TRUE(GfIsClose(expected[i], normals[i], 1e-6))
+                << mesh.name << " vertex " << i << ": " << expected[i] << " != " << normals[i];
+        }
+    }
+}
+
+TEST(MeshViewportComputeCPU, smoothNormalsRenderingOrder)
+{
+    const std::vector<_SampleMesh> meshes = _ReadSampleMeshes();
+    ASSERT_FALSE(meshes.empty());
+
+    for (const _SampleMesh& mesh : meshes) {
+        Hd_VertexAdjacency adjacency;
+        adjacency.BuildAdjacencyTable(&mesh.topology);
+
+        const VtVec3fArray expected = Hd_SmoothNormals::ComputeSmoothNormals(
+            &adjacency, mesh.points.size(), mesh.points.cdata());
+
+        // Unshare every face vertex, like the VP2 mesh does for face-varying primvars.
+        const VtIntArray& faceVertexIndices = mesh.topology.GetFaceVertexIndices();
+        VtIntArray        renderingToScene = faceVertexIndices;
+        std::vector<int>  sceneToRendering(mesh.points.size(), -1);
+        VtVec3fArray      renderingPoints(renderingToScene.size());
+        for (size_t i = 0; i < renderingToScene.size(); ++i) {
+            renderingPoints[i] = mesh.points[renderingToScene[i]];
+            sceneToRendering[renderingToScene[i]] = static_cast<int>(i);
+        }
+
+        std::vector<GfVec3f> normals(renderingPoints.size());
+        const VtIntArray&    table = adjacency.GetAdjacencyTable();
+        MeshViewportComputeCPU::computeSmoothNormals(
+            table.cdata(),
+            table.size(),
+            renderingPoints.size(),
+            renderingPoints.cdata()->data(),
+            normals.data()->data(),
+            renderingToScene.cdata(),
+            sceneToRendering.data());
+
+        for (size_t i = 0; i < renderingToScene.size(); ++i) {
+            const GfVec3f& sceneNormal = expected[renderingToScene[i]];
+            EXPECT_TRUE(GfIsClose(sceneNormal, normals[i], 1e-6))
+                << mesh.name << " vertex " << i << ": " << sceneNormal << " != " << normals[i];
+        }
+    }
+}
+
+TEST(MeshViewportComputeCPU, osdTables)
+{
+    const std::vector<_SampleMesh> meshes = _ReadSampleMeshes();
+    ASSERT_FALSE(meshes.empty());
+
+    for (const _SampleMesh& mesh : meshes) {
+        const int               level = 2;
+        HdVP2OsdTablesSharedPtr tables = MeshViewportComputeCPU::createOsdTables(
+            mesh.topology, TfToken("default"), level, false);
+        ASSERT_TRUE(tables) << mesh.name;
+        ASSERT_TRUE(tables->vertexStencils) << mesh.name;
+        ASSERT_TRUE(tables->patchTable) << mesh.name;
+        EXPECT_TRUE(tables->matches(mesh.topology.ComputeHash(), level, false));
+        EXPECT_FALSE(tables->matches(mesh.topology.ComputeHash(), level + 1, false));
+
+        const OpenSubdiv::Far::StencilTable& stencils = *tables->vertexStencils;
+        const size_t                         numBase = mesh.points.size();
+        const size_t                         numRefined = stencils.GetNumStencils();
+
+        // Reference: serial evaluation by OpenSubdiv.
+        std::vector<_Vertex> expected(numRefined);
+        stencils.UpdateValues(
+            reinterpret_cast<const _Vertex*>(mesh.points.cdata()), expected.data());
+
+        std::vector<GfVec3f> buffer(numBase + numRefined);
+        std::copy(mesh.points.begin(), mesh.points.end(), buffer.begin());
+        MeshViewportComputeCPU::evalStencils(stencils, buffer.data()->data(), 3, numBase);
+
+        for (size_t i = 0; i < numRefined; ++i) {
+            EXPECT_TRUE(GfIsClose(expected[i].p, buffer[numBase + i], 1e-5))
+                << mesh.name << " refined vertex " << i;
+        }
+    }
+}
+
+TEST(MeshViewportComputeCPU, osdTablesCache)
+{
+    const std::vector<_SampleMesh> meshes = _ReadSampleMeshes();
+    ASSERT_FALSE(meshes.empty());
+
+    const int level = 2;
+    for (const _SampleMesh& mesh : meshes) {
+        HdVP2OsdTablesSharedPtr tables = MeshViewportComputeCPU::findOrCreateOsdTables(
+            mesh.topology, TfToken("default"), level, false);
+        ASSERT_TRUE(tables) << mesh.name;
+        EXPECT_TRUE(tables->matches(mesh.topology.ComputeHash(), level, false));
+
+        // Same topology and settings: shared tables.
+        EXPECT_EQ(
+            tables,
+            MeshViewportComputeCPU::findOrCreateOsdTables(
+                mesh.topology, TfToken("other"), level, false))
+            << mesh.name;
+
+        // Other settings: other tables.
+        HdVP2OsdTablesSharedPtr otherLevel = MeshViewportComputeCPU::findOrCreateOsdTables(
+            mesh.topology, TfToken("default"), level + 1, false);
+        ASSERT_TRUE(otherLevel) << mesh.name;
+        EXPECT_NE(tables, otherLevel) << mesh.name;
+        EXPECT_TRUE(otherLevel->matches(mesh.topology.ComputeHash(), level + 1, false));
+
+        // The cache doesn't keep the tables alive.
+        std::weak_ptr<const HdVP2OsdTables> released = tables;
+        tables.reset();
+        EXPECT_TRUE(released.expired()) << mesh.name;
+        tables = MeshViewportComputeCPU::findOrCreateOsdTables(
+            mesh.topology, TfToken("default"), level, false);
+        EXPECT_TRUE(tables) << mesh.name;
+    }
+}
@@ -0,0 +1,182 @@
+#include <mayaUsd/utils/converter.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/types.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using MayaUsd::TypedConverter;
+
+namespace {
+
+VtArray<GfVec3f> makeVec3fArray(size_t count)
+{
+    VtArray<GfVec3f> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = GfVec3f(float(i), float(i) * 0.5f, -float(i));
+    }
+    return values;
+}
+
+VtArray<GfVec3d> makeVec3dArray(size_t count)
+{
+    VtArray<GfVec3d> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = GfVec3d(double(i), double(i) * 0.25, -double(i));
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(Converter, intArrayRoundTrip)
+{
+    VtArray<int> src(1000);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<int>(i) - 500;
+    }
+
+    MIntArray mayaArray;
+    TypedConverter<MIntArray, VtArray<int>>::convert(src, mayaArray);
+    ASSERT_EQ(mayaArray.length(), src.size());
+    for (unsigned int i = 0; i < mayaArray.length(); ++i) {
+        EXPECT_EQ(mayaArray[i], src[i]);
+    }
+
+    VtArray<int> dst;
+    TypedConverter<MIntArray, VtArray<int>>::convert(mayaArray, dst);
+    EXPECT_EQ(dst, src);
+}
+
+TEST(Converter, scalarArraysRoundTrip)
+{
+    VtArray<float>  floats = { 0.0f, 1.5f, -2.25f, 1e6f };
+    VtArray<double> doubles = { 0.0, 1.5, -2.25, 1e12 };
+
+    MFloatArray mayaFloats;
+    TypedConverter<MFloatArray, VtArray<float>>::convert(floats, mayaFloats);
+    VtArray<float> floatsBack;
+    TypedConverter<MFloatArray, VtArray<float>>::convert(mayaFloats, floatsBack);
+    EXPECT_EQ(floatsBack, floats);
+
+    MDoubleArray mayaDoubles;
+    TypedConverter<MDoubleArray, VtArray<double>>::convert(doubles, mayaDoubles);
+    VtArray<double> doublesBack;
+    TypedConverter<MDoubleArray, VtArray<double>>::convert(mayaDoubles, doublesBack);
+    EXPECT_EQ(doublesBack, doubles);
+}
+
+TEST(Converter, pointArraysRoundTrip)
+{
+    const VtArray<GfVec3f> points = makeVec3fArray(1000);
+
+    // Widening to homogeneous double points.
+    MPointArray mayaPoints;
+    TypedConverter<MPointArray, VtArray<GfVec3f>>::convert(points, mayaPoints);
+    ASSERT_EQ(mayaPoints.length(), points.size());
+    for (unsigned int i = 0; i < mayaPoints.length(); ++i) {
+        EXPECT_EQ(mayaPoints[i], MPoint(points[i][0], points[i][1], points[i][2]));
+        EXPECT_EQ(mayaPoints[i].w, 1.0);
+    }
+    VtArray<GfVec3f> pointsBack;
+    TypedConverter<MPointArray, VtArray<GfVec3f>>::convert(mayaPoints, pointsBack);
+    EXPECT_EQ(pointsBack, points);
+
+    // Same precision, only the w component is added and dropped.
+    MFloatPointArray mayaFloatPoints;
+    TypedConverter<MFloatPointArray, VtArray<GfVec3f>>::convert(points, mayaFloatPoints);
+    ASSERT_EQ(mayaFloatPoints.length(), points.size());
+    for (unsigned int i = 0; i < mayaFloatPoints.length(); ++i) {
+        EXPECT_EQ(mayaFloatPoints[i], MFloatPoint(points[i][0], points[i][1], points[i][2]));
+        EXPECT_EQ(mayaFloatPoints[i].w, 1.0f);
+    }
+    pointsBack.clear();
+    TypedConverter<MFloatPointArray, VtArray<GfVec3f>>::convert(mayaFloatPoints, pointsBack);
+    EXPECT_EQ(pointsBack, points);
+
+    const VtArray<GfVec3d> doublePoints = makeVec3dArray(1000);
+    TypedConverter<MPointArray, VtArray<GfVec3d>>::convert(doublePoints, mayaPoints);
+    VtArray<GfVec3d> doublePointsBack;
+    TypedConverter<MPointArray, VtArray<GfVec3d>>::convert(mayaPoints, doublePointsBack);
+    EXPECT_EQ(doublePointsBack, doublePoints);
+}
+
+TEST(Converter, vectorArraysRoundTrip)
+{
+    const VtArray<GfVec3d> vectors = makeVec3dArray(1000);
+
+    MVectorArray mayaVectors;
+    TypedConverter<MVectorArray, VtArray<GfVec3d>>::convert(vectors, mayaVectors);
+    ASSERT_EQ(mayaVectors.length(), vectors.size());
+    for (unsigned int i = 0; i < mayaVectors.length(); ++i) {
+        EXPECT_EQ(mayaVectors[i], MVector(vectors[i][0], vectors[i][1], vectors[i][2]));
+    }
+    VtArray<GfVec3d> vectorsBack;
+    TypedConverter<MVectorArray, VtArray<GfVec3d>>::convert(mayaVectors, vectorsBack);
+    EXPECT_EQ(vectorsBack, vectors);
+
+    // Narrowing to float vectors.
+    VtArray<GfVec3f> floatVectors;
+    TypedConverter<MVectorArray, VtArray<GfVec3f>>::convert(mayaVectors, floatVectors);
+    ASSERT_EQ(floatVectors.size(), vectors.size());
+    for (size_t i = 0; i < floatVectors.size(); ++i) {
+        EXPECT_EQ(floatVectors[i], GfVec3f(vectors[i]));
+    }
+
+    MFloatVectorArray mayaFloatVectors;
+    TypedConverter<MFloatVectorArray, VtArray<GfVec3f>>::convert(floatVectors, mayaFloatVectors);
+    VtArray<GfVec3f> floatVectorsBack;
+    TypedConverter<MFloatVectorArray, VtArray<GfVec3f>>::convert(
+        mayaFloatVectors, floatVectorsBack);
+    EXPECT_EQ(floatVectorsBack, floatVectors);
+}
+
+TEST(Converter, matrixArrayRoundTrip)
+{
+    VtArray<GfMatrix4d> matrices(100);
+    for (size_t i = 0; i < matrices.size(); ++i) {
+        matrices[i].SetTranslate(GfVec3d(double(i), 2.0, 3.0));
+    }
+
+    MMatrixArray mayaMatrices;
+    TypedConverter<MMatrixArray, VtArray<GfMatrix4d>>::convert(matrices, mayaMatrices);
+    ASSERT_EQ(mayaMatrices.length(), matrices.size());
+    for (unsigned int i = 0; i < mayaMatrices.length(); ++i) {
+        GfMatrix4d matrix;
+        TypedConverter<MMatrix, GfMatrix4d>::convert(mayaMatrices[i], matrix);
+        EXPECT_EQ(matrix, matrices[i]);
+    }
+
+    VtArray<GfMatrix4d> matricesBack;
+    TypedConverter<MMatrixArray, VtArray<GfMatrix4d>>::convert(mayaMatrices, matricesBack);
+    EXPECT_EQ(matricesBack, matrices);
+}
+
+TEST(Converter, emptyArrays)
+{
+    MPointArray mayaPoints(10);
+    TypedConverter<MPointArray, VtArray<GfVec3f>>::convert(VtArray<GfVec3f>(), mayaPoints);
+    EXPECT_EQ(mayaPoints.length(), 0u);
+
+    VtArray<GfVec3f> points = makeVec3fArray(10);
+    TypedConverter<MPointArray, VtArray<GfVec3f>>::convert(mayaPoints, points);
+    EXPECT_TRUE(points.empty());
+}
+
+TEST(Converter, findArrayConverters)
+{
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->IntArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->FloatArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->DoubleArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->Point3fArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->Point3dArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->Vector3fArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->Vector3dArray, false), nullptr);
+    EXPECT_NE(MayaUsd::Converter::find(SdfValueTypeNames->Matrix4dArray, false), nullptr);
+}
+
@@ -0,0 +1,121 @@
+#include <mayaUsd/utils/copyLayerPrims.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/relationship.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const int numGroups = 10;
+const int numItems = 20;
+
+const SdfPath rootPath("/Root");
+const TfToken linkName("link");
+const TfToken inputName("inputs:value");
+const TfToken outputName("outputs:value");
+
+SdfPath groupPath(int group)
+{
+    return rootPath.AppendChild(TfToken(TfStringPrintf("Group_%d", group)));
+}
+
+SdfPath itemPath(int group, int item)
+{
+    return groupPath(group).AppendChild(TfToken(TfStringPrintf("Item_%d", item)));
+}
+
+// Each item has a relationship to an item of a later group and a connection
+// to an item of the previous group. The group offset lets the destination
+// paths be built with the renamed group.
+SdfPath linkedItemPath(int group, int item, int groupOffset = 0)
+{
+    return itemPath((group + 7) % numGroups + groupOffset, (item + 13) % numItems);
+}
+
+SdfPath connectedAttrPath(int group, int item, int groupOffset = 0)
+{
+    return itemPath((group + numGroups - 1) % numGroups + groupOffset, (item * 31) % numItems)
+        .AppendProperty(outputName);
+}
+
+UsdStageRefPtr createSourceStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+
+    SdfChangeBlock changeBlock;
+    stage->DefinePrim(rootPath, TfToken("Scope"));
+    for (int group = 0; group < numGroups; ++group) {
+        stage->DefinePrim(groupPath(group), TfToken("Xform"));
+        for (int item = 0; item < numItems; ++item) {
+            UsdPrim prim = stage->DefinePrim(itemPath(group, item), TfToken("Xform"));
+            prim.CreateRelationship(linkName).SetTargets({ linkedItemPath(group, item) });
+            prim.CreateAttribute(outputName, SdfValueTypeNames->Float);
+            prim.CreateAttribute(inputName, SdfValueTypeNames->Float)
+                .SetConnections({ connectedAttrPath(group, item) });
+        }
+    }
+    return stage;
+}
+
+} // namespace
+
+TEST(CopyLayerPrims, copyWithRenamedTargets)
+{
+    UsdStageRefPtr srcStage = createSourceStage();
+
+    // The first group already exists in the destination, so every copied group
+    // gets renamed to the name of the next one. Targets must only be renamed once,
+    // not follow the chain of renamed groups.
+    UsdStageRefPtr dstStage = UsdStage::CreateInMemory();
+    dstStage->DefinePrim(rootPath, TfToken("Scope"));
+    dstStage->DefinePrim(groupPath(0), TfToken("Xform"));
+
+    std::vector<SdfPath> primsToCopy;
+    for (int group = 0; group < numGroups; ++group)
+        primsToCopy.emplace_back(groupPath(group));
+
+    MayaUsd::CopyLayerPrimsOptions options;
+    options.followRelationships = true;
+
+    MayaUsd::CopyLayerPrimsResult result = MayaUsd::copyLayerPrims(
+        srcStage,
+        srcStage->GetRootLayer(),
+        rootPath,
+        dstStage,
+        dstStage->GetRootLayer(),
+        rootPath,
+        primsToCopy,
+        options);
+
+    // Targeted items are all inside copied groups, so they are recorded as copied
+    // but never renamed individually.
+    EXPECT_EQ(result.renamedPaths.size(), size_t(numGroups));
+    for (int group = 0; group < numGroups; ++group) {
+        EXPECT_EQ(result.copiedPaths[groupPath(group)], groupPath(group + 1));
+        EXPECT_EQ(result.renamedPaths[groupPath(group)], groupPath(group + 1));
+    }
+
+    for (int group = 0; group < numGroups; ++group) {
+        for (int item = 0; item < numItems; ++item) {
+            const SdfPath dstPath = itemPath(group + 1, item);
+            UsdPrim       dstPrim = dstStage->GetPrimAtPath(dstPath);
+            ASSERT_TRUE(dstPrim) << dstPath;
+
+            SdfPathVector targets;
+            dstPrim.GetRelationship(linkName).GetTargets(&targets);
+            ASSERT_EQ(targets.size(), 1u) << dstPath;
+            EXPECT_EQ(targets[0], linkedItemPath(group, item, 1)) << dstPath;
+
+            SdfPathVector connections;
+            dstPrim.GetAttribute(inputName).GetConnections(&connections);
+            ASSERT_EQ(connections.size(), 1u) << dstPath;
+            EXPECT_EQ(connections[0], connectedAttrPath(group, item, 1)) << dstPath;
+        }
+    }
+}
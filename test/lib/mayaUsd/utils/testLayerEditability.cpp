@@ -0,0 +1,94 @@
+#include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/layers.h>
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// The sublayer hierarchies used by the editability checks are cached, and must
+// follow the sublayer edits made after they were first queried.
+
+TEST(LayerEditability, sublayersFollowEdits)
+{
+    auto root = SdfLayer::CreateAnonymous();
+    auto layerA = SdfLayer::CreateAnonymous();
+    auto layerB = SdfLayer::CreateAnonymous();
+    root->InsertSubLayerPath(layerA->GetIdentifier());
+
+    EXPECT_EQ(UsdUfe::getAllSublayers(root), std::set<std::string>({ layerA->GetIdentifier() }));
+
+    // A nested sublayer is found after its parent layer has been queried.
+    layerA->InsertSubLayerPath(layerB->GetIdentifier());
+    EXPECT_EQ(
+        UsdUfe::getAllSublayers(root),
+        std::set<std::string>({ layerA->GetIdentifier(), layerB->GetIdentifier() }));
+    EXPECT_EQ(UsdUfe::getAllSublayers(layerA), std::set<std::string>({ layerB->GetIdentifier() }));
+
+    layerA->RemoveSubLayerPath(0);
+    EXPECT_EQ(UsdUfe::getAllSublayers(root), std::set<std::string>({ layerA->GetIdentifier() }));
+    EXPECT_TRUE(UsdUfe::getAllSublayers(layerA).empty());
+}
+
+TEST(LayerEditability, strongerLayerFollowsEdits)
+{
+    auto root = SdfLayer::CreateAnonymous();
+    auto layerA = SdfLayer::CreateAnonymous();
+    auto layerB = SdfLayer::CreateAnonymous();
+    auto layerC = SdfLayer::CreateAnonymous();
+    root->SetSubLayerPaths({ layerA->GetIdentifier(), layerB->GetIdentifier() });
+
+    EXPECT_EQ(UsdUfe::getStrongerLayer(root, layerA, layerB), SdfLayerHandle(layerA));
+    EXPECT_EQ(UsdUfe::getStrongerLayer(root, layerC, layerB), SdfLayerHandle(layerB));
+
+    root->SetSubLayerPaths({ layerB->GetIdentifier(), layerA->GetIdentifier() });
+    EXPECT_EQ(UsdUfe::getStrongerLayer(root, layerA, layerB), SdfLayerHandle(layerB));
+
+    root->InsertSubLayerPath(layerC->GetIdentifier(), 0);
+    EXPECT_EQ(UsdUfe::getStrongerLayer(root, layerC, layerB), SdfLayerHandle(layerC));
+}
+
+TEST(LayerEditability, commandRestrictionFollowsEdits)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto root = stage->GetRootLayer();
+    auto layerA = SdfLayer::CreateAnonymous();
+    auto layerB = SdfLayer::CreateAnonymous();
+    root->SetSubLayerPaths({ layerA->GetIdentifier(), layerB->GetIdentifier() });
+
+    // The prim is defined in the weaker layer, so it can be deleted from the
+    // stronger one.
+    SdfCreatePrimInLayer(layerB, SdfPath("/Prim"))->SetSpecifier(SdfSpecifierDef);
+    stage->SetEditTarget(layerA);
+    const UsdPrim prim = stage->GetPrimAtPath(SdfPath("/Prim"));
+    ASSERT_TRUE(prim);
+    EXPECT_TRUE(UsdUfe::applyCommandRestrictionNoThrow(prim, "delete", true));
+
+    // Once the layer of the prim is the stronger one, it no longer can.
+    root->SetSubLayerPaths({ layerB->GetIdentifier(), layerA->GetIdentifier() });
+    EXPECT_FALSE(UsdUfe::applyCommandRestrictionNoThrow(prim, "delete", true));
+}
+
+TEST(LayerEditability, mutedLayerFollowsEdits)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto root = stage->GetRootLayer();
+    auto layerA = SdfLayer::CreateAnonymous();
+    auto layerB = SdfLayer::CreateAnonymous();
+    root->SetSubLayerPaths({ layerA->GetIdentifier(), layerB->GetIdentifier() });
+
+    SdfCreatePrimInLayer(layerA, SdfPath("/Prim"))->SetSpecifier(SdfSpecifierDef);
+    const UsdPrim prim = stage->GetPrimAtPath(SdfPath("/Prim"));
+    ASSERT_TRUE(prim);
+    EXPECT_FALSE(UsdUfe::hasMutedLayer(prim));
+
+    stage->MuteLayer(layerB->GetIdentifier());
+    EXPECT_TRUE(UsdUfe::hasMutedLayer(prim));
+    EXPECT_THROW(UsdUfe::enforceMutedLayer(prim, "delete"), std::runtime_error);
+
+    stage->UnmuteLayer(layerB->GetIdentifier());
+    EXPECT_FALSE(UsdUfe::hasMutedLayer(prim));
+}
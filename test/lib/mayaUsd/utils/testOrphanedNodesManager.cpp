@@ -0,0 +1,124 @@
+#include <mayaUsd/fileio/orphanedNodesManager.h>
+
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <maya/MDagPath.h>
+#include <ufe/path.h>
+#include <ufe/pathSegment.h>
+#include <ufe/trie.imp.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using MayaUsd::OrphanedNodesManager;
+
+namespace {
+
+const int numGroups = 10;
+const int numItems = 10;
+
+// The pulled path of an item. The trie is keyed by path components only, so
+// any run-time id and separator will do.
+Ufe::Path pulledPath(int group, int item)
+{
+    Ufe::PathSegment::Components components { Ufe::PathComponent("world"),
+                                              Ufe::PathComponent("stage"),
+                                              Ufe::PathComponent(TfStringPrintf("Group_%d", group)),
+                                              Ufe::PathComponent(TfStringPrintf("Item_%d", item)) };
+    return Ufe::Path(Ufe::PathSegment(components, 1, '|'));
+}
+
+// JSON state of the orphaned nodes manager with numGroups * numItems pulled
+// paths. The edited-as-Maya roots are left empty so that no Maya node needs to
+// be looked up.
+std::string makePulledPrimsJson()
+{
+    std::string json = "{\"/world\":{\"/stage\":{";
+    for (int group = 0; group < numGroups; ++group) {
+        if (group > 0)
+            json += ',';
+        json += TfStringPrintf("\"/Group_%d\":{", group);
+        for (int item = 0; item < numItems; ++item) {
+            if (item > 0)
+                json += ',';
+            json += TfStringPrintf(
+                "\"/Item_%d\":{\"pull info\":{\"editedAsMayaRoot\":\"\","
+                "\"variantSetDescriptors\":[]}}",
+                item);
+        }
+        json += '}';
+    }
+    json += "}}}";
+    return json;
+}
+
+} // namespace
+
+TEST(OrphanedNodesManager, jsonRoundTrip)
+{
+    const std::string json = makePulledPrimsJson();
+
+    OrphanedNodesManager manager;
+    manager.restore(OrphanedNodesManager::Memento::convertFromJson(json));
+    ASSERT_FALSE(manager.empty());
+    EXPECT_TRUE(manager.getPulledPrims().find(pulledPath(numGroups - 1, numItems - 1)));
+
+    const std::string written
+        = OrphanedNodesManager::Memento::convertToJson(manager.getPulledPrims());
+
+    // Compare the parsed JSON, the order of object members is not preserved.
+    EXPECT_EQ(JsParseString(written), JsParseString(json));
+}
+
+TEST(OrphanedNodesManager, removeMemento)
+{
+    const std::string json = makePulledPrimsJson();
+
+    OrphanedNodesManager manager;
+    manager.restore(OrphanedNodesManager::Memento::convertFromJson(json));
+
+    // Removing a path only records the pull information of that path, and
+    // restoring it brings back the exact previous state.
+    for (int i = 0; i < numGroups * numItems; ++i) {
+        const Ufe::Path path = pulledPath(i % numGroups, i / numGroups);
+        OrphanedNodesManager::Memento memento = manager.remove(path, MDagPath());
+        EXPECT_FALSE(manager.getPulledPrims().find(path));
+        manager.restore(std::move(memento));
+        EXPECT_TRUE(manager.getPulledPrims().find(path));
+    }
+
+    EXPECT_EQ(
+        JsParseString(OrphanedNodesManager::Memento::convertToJson(manager.getPulledPrims())),
+        JsParseString(json));
+
+    // Undoing several removals in reverse order.
+    std::vector<OrphanedNodesManager::Memento> mementos;
+    for (int item = 0; item < numItems; ++item) {
+        mementos.emplace_back(manager.remove(pulledPath(0, item), MDagPath()));
+    }
+    EXPECT_FALSE(manager.getPulledPrims().containsDescendant(pulledPath(0, 0).pop()));
+    while (!mementos.empty()) {
+        manager.restore(std::move(mementos.back()));
+        mementos.pop_back();
+    }
+    EXPECT_EQ(
+        JsParseString(OrphanedNodesManager::Memento::convertToJson(manager.getPulledPrims())),
+        JsParseString(json));
+
+    // Restoring a removal does not undo the removals made after it, as a memento
+    // of the entire state would.
+    const Ufe::Path               firstPath = pulledPath(1, 2);
+    const Ufe::Path               secondPath = pulledPath(3, 4);
+    OrphanedNodesManager::Memento firstMemento = manager.remove(firstPath, MDagPath());
+    OrphanedNodesManager::Memento secondMemento = manager.remove(secondPath, MDagPath());
+    manager.restore(std::move(firstMemento));
+    EXPECT_TRUE(manager.getPulledPrims().find(firstPath));
+    EXPECT_FALSE(manager.getPulledPrims().find(secondPath));
+    manager.restore(std::move(secondMemento));
+    EXPECT_TRUE(manager.getPulledPrims().find(secondPath));
+}
@@ -0,0 +1,328 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/stageRayIntersector.h>
+#include <mayaUsd/utils/triangleBVH.h>
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/sphere.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/xformCommonAPI.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using MayaUsd::StageRayIntersector;
+using MayaUsd::TriangleBVH;
+
+namespace {
+
+const GfVec3d kDown(0.0, 0.0, -1.0);
+
+//! Points of a unit quad in the XY plane, facing +Z.
+VtVec3fArray _QuadPoints(float scale = 1.0f)
+{
+    return { GfVec3f(-scale, -scale, 0.0f),
+             GfVec3f(scale, -scale, 0.0f),
+             GfVec3f(scale, scale, 0.0f),
+             GfVec3f(-scale, scale, 0.0f) };
+}
+
+UsdGeomMesh _DefineQuad(const UsdStageRefPtr& stage, const SdfPath& path)
+{
+    UsdGeomMesh mesh = UsdGeomMesh::Define(stage, path);
+    mesh.CreatePointsAttr().Set(_QuadPoints());
+    mesh.CreateFaceVertexCountsAttr().Set(VtIntArray { 4 });
+    mesh.CreateFaceVertexIndicesAttr().Set(VtIntArray { 0, 1, 2, 3 });
+    return mesh;
+}
+
+UsdStageRefPtr _OpenSample(const std::string& file)
+{
+    return UsdStage::Open(std::string(TEST_SAMPLES_DIR) + "/" + file);
+}
+
+bool _IsClose(const GfVec3d& a, const GfVec3d& b, double tolerance = 1e-5)
+{
+    return GfIsClose(a[0], b[0], tolerance) && GfIsClose(a[1], b[1], tolerance)
+        && GfIsClose(a[2], b[2], tolerance);
+}
+
+//! Compares the hits of random rays through the mesh with a brute force intersection of the
+//! triangles of its faces.
+void _ExpectMatchesBruteForce(
+    const TriangleBVH&  bvh,
+    const VtIntArray&   faceVertexCounts,
+    const VtIntArray&   faceVertexIndices,
+    const VtVec3fArray& points)
+{
+    const GfRange3d bounds = bvh.getBounds();
+    const GfVec3d   center = bounds.GetMidpoint();
+    const double    radius = bounds.GetSize().GetLength();
+
+    // Random rays from around the mesh towards points near its center.
+    std::mt19937                           generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    const auto random = [&]() {
+        return GfVec3d(distribution(generator), distribution(generator), distribution(generator));
+    };
+
+    size_t numHits = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const GfVec3d origin = center + random().GetNormalized() * radius;
+        const GfRay   ray(origin, center + random() * 0.45 * radius - origin);
+
+        double closest = std::numeric_limits<double>::infinity();
+        size_t offset = 0;
+        for (const int count : faceVertexCounts) {
+            for (int v = 1; v + 1 < count; ++v) {
+                double distance = 0.0;
+                if (ray.Intersect(
+                        GfVec3d(points[faceVertexIndices[offset]]),
+                        GfVec3d(points[faceVertexIndices[offset + v]]),
+                        GfVec3d(points[faceVertexIndices[offset + v + 1]]),
+                        &distance)) {
+                    closest = std::min(closest, distance);
+                }
+            }
+            offset += count;
+        }
+
+        TriangleBVH::Hit hit;
+        const bool       found = bvh.intersect(ray, &hit);
+        ASSERT_EQ(found, closest < std::numeric_limits<double>::infinity()) << "ray " << i;
+        if (found) {
+            EXPECT_NEAR(hit.distance, closest, 1e-9) << "ray " << i;
+            ++numHits;
+        }
+    }
+    EXPECT_GT(numHits, 0u);
+}
+
+} // namespace
+
+TEST(TriangleBVH, quad)
+{
+    std::unique_ptr<TriangleBVH> bvh
+        = TriangleBVH::fromMesh({ 4 }, { 0, 1, 2, 3 }, {}, _QuadPoints());
+    ASSERT_TRUE(bvh);
+    EXPECT_EQ(bvh->getTriangleCount(), 2u);
+    EXPECT_EQ(bvh->getBounds(), GfRange3d(GfVec3d(-1, -1, 0), GfVec3d(1, 1, 0)));
+
+    TriangleBVH::Hit hit;
+    ASSERT_TRUE(bvh->intersect(GfRay(GfVec3d(0.5, 0.25, 2.0), kDown), &hit));
+    EXPECT_TRUE(_IsClose(hit.point, GfVec3d(0.5, 0.25, 0.0)));
+    EXPECT_TRUE(_IsClose(hit.normal, GfVec3d(0.0, 0.0, 1.0)));
+    EXPECT_DOUBLE_EQ(hit.distance, 2.0);
+
+    // Misses: outside of the quad, and behind the origin of the ray.
+    EXPECT_FALSE(bvh->intersect(GfRay(GfVec3d(1.5, 0.0, 2.0), kDown), &hit));
+    EXPECT_FALSE(bvh->intersect(GfRay(GfVec3d(0.0, 0.0, -2.0), kDown), &hit));
+
+    // Refit on moved points, but not on a different point count.
+    EXPECT_TRUE(bvh->refit(_QuadPoints(2.0f)));
+    EXPECT_TRUE(bvh->intersect(GfRay(GfVec3d(1.5, 0.0, 2.0), kDown), &hit));
+    EXPECT_EQ(bvh->getBounds(), GfRange3d(GfVec3d(-2, -2, 0), GfVec3d(2, 2, 0)));
+    EXPECT_FALSE(bvh->refit(VtVec3fArray(3)));
+
+    // Left handed winding flips the normal.
+    bvh = TriangleBVH::fromMesh({ 4 }, { 0, 1, 2, 3 }, {}, _QuadPoints(), true);
+    ASSERT_TRUE(bvh->intersect(GfRay(GfVec3d(0.3, 0.1, 2.0), kDown), &hit));
+    EXPECT_TRUE(_IsClose(hit.normal, GfVec3d(0.0, 0.0, -1.0)));
+
+    // Holes are skipped, invalid topologies are refused.
+    bvh = TriangleBVH::fromMesh({ 4 }, { 0, 1, 2, 3 }, { 0 }, _QuadPoints());
+    ASSERT_TRUE(bvh);
+    EXPECT_FALSE(bvh->intersect(GfRay(GfVec3d(0.3, 0.1, 2.0), kDown), &hit));
+    EXPECT_FALSE(TriangleBVH::fromMesh({ 4 }, { 0, 1, 2, 4 }, {}, _QuadPoints()));
+    EXPECT_FALSE(TriangleBVH::fromMesh({ 5 }, { 0, 1, 2, 3 }, {}, _QuadPoints()));
+}
+
+TEST(TriangleBVH, matchesBruteForce)
+{
+    UsdStageRefPtr stage = _OpenSample("groupCmd/sphere.usda");
+    ASSERT_TRUE(stage);
+    UsdGeomMesh mesh(stage->GetPrimAtPath(SdfPath("/pSphere1")));
+    ASSERT_TRUE(mesh);
+
+    VtIntArray   faceVertexCounts;
+    VtIntArray   faceVertexIndices;
+    VtVec3fArray points;
+    mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+    mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+    mesh.GetPointsAttr().Get(&points);
+
+    std::unique_ptr<TriangleBVH> bvh
+        = TriangleBVH::fromMesh(faceVertexCounts, faceVertexIndices, {}, points);
+    ASSERT_TRUE(bvh);
+    _ExpectMatchesBruteForce(*bvh, faceVertexCounts, faceVertexIndices, points);
+
+    // Stretch and move the sphere: the refit keeps the nodes and the triangle
+    // order of the build, and still finds the same hits as the brute force.
+    const size_t                nodeCount = bvh->getNodeCount();
+    const std::vector<uint32_t> triangleOrder = bvh->getTriangleOrder();
+    VtVec3fArray                movedPoints(points.size());
+    std::transform(points.begin(), points.end(), movedPoints.begin(), [](const GfVec3f& point) {
+        return GfVec3f(point[0] * 2.0f + 0.5f, point[1] * 0.5f, point[2] - 0.25f);
+    });
+    ASSERT_TRUE(bvh->refit(movedPoints));
+    EXPECT_EQ(bvh->getNodeCount(), nodeCount);
+    EXPECT_EQ(bvh->getTriangleOrder(), triangleOrder);
+    _ExpectMatchesBruteForce(*bvh, faceVertexCounts, faceVertexIndices, movedPoints);
+}
+
+TEST(StageRayIntersector, sampleAssets)
+{
+    UsdStageRefPtr cubeStage = _OpenSample("cubeRef/cube.usda");
+    ASSERT_TRUE(cubeStage);
+    StageRayIntersector          cubeIntersector(cubeStage);
+    StageRayIntersector::Options options;
+    StageRayIntersector::Hit     hit;
+
+    // The unit cube mesh is translated to (2, 0, -2). Rays avoid the edges of
+    // the triangulated faces, which either triangle may report.
+    ASSERT_TRUE(cubeIntersector.intersect(GfRay(GfVec3d(2.1, 0.2, 10.0), kDown), options, &hit));
+    EXPECT_TRUE(_IsClose(hit.point, GfVec3d(2.1, 0.2, -1.5)));
+    EXPECT_TRUE(_IsClose(hit.normal, GfVec3d(0.0, 0.0, 1.0)));
+    EXPECT_EQ(hit.primPath, SdfPath("/CubePrim/CubeMesh"));
+    EXPECT_FALSE(cubeIntersector.intersect(GfRay(GfVec3d(0.0, 0.0, 10.0), kDown), options, &hit));
+    EXPECT_EQ(cubeIntersector.getCachedMeshCount(), 1u);
+
+    // The unit sphere is translated along X, hit it next to its top pole.
+    UsdStageRefPtr sphereStage = _OpenSample("groupCmd/sphere.usda");
+    ASSERT_TRUE(sphereStage);
+    StageRayIntersector sphereIntersector(sphereStage);
+    const double        x = -3.032077068636826 + 0.03;
+    ASSERT_TRUE(sphereIntersector.intersect(
+        GfRay(GfVec3d(x, 10.0, 0.05), GfVec3d(0.0, -1.0, 0.0)), options, &hit));
+    EXPECT_TRUE(_IsClose(hit.point, GfVec3d(x, 1.0, 0.05), 0.01));
+    EXPECT_GT(GfDot(hit.normal, GfVec3d(0.0, 1.0, 0.0)), 0.95);
+}
+
+TEST(StageRayIntersector, stageChanges)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomXform   parent = UsdGeomXform::Define(stage, SdfPath("/Parent"));
+    UsdGeomMesh    mesh = _DefineQuad(stage, SdfPath("/Parent/Quad"));
+
+    StageRayIntersector          intersector(stage);
+    StageRayIntersector::Options options;
+    StageRayIntersector::Hit     hit;
+    const GfRay                  ray(GfVec3d(1.5, 0.0, 2.0), kDown);
+
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+    EXPECT_EQ(intersector.getCachedMeshCount(), 1u);
+
+    // Point changes refit the cached hierarchy.
+    mesh.GetPointsAttr().Set(_QuadPoints(2.0f));
+    ASSERT_TRUE(intersector.intersect(ray, options, &hit));
+    EXPECT_TRUE(_IsClose(hit.point, GfVec3d(1.5, 0.0, 0.0)));
+    EXPECT_EQ(intersector.getCachedMeshCount(), 1u);
+
+    // Transforms are not cached.
+    UsdGeomXformCommonAPI(parent).SetTranslate(GfVec3d(0.0, 0.0, 1.0));
+    ASSERT_TRUE(intersector.intersect(ray, options, &hit));
+    EXPECT_TRUE(_IsClose(hit.point, GfVec3d(1.5, 0.0, 1.0)));
+
+    // Topology changes drop the hierarchy.
+    mesh.GetFaceVertexIndicesAttr().Set(VtIntArray { 1, 2, 3, 0 });
+    EXPECT_EQ(intersector.getCachedMeshCount(), 0u);
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit));
+
+    // Visibility, purpose, exclusion and root path.
+    parent.GetVisibilityAttr().Set(UsdGeomTokens->invisible);
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+    parent.GetVisibilityAttr().Set(UsdGeomTokens->inherited);
+    mesh.GetPurposeAttr().Set(UsdGeomTokens->guide);
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+    options.guidePurpose = true;
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit));
+    options.excludedPaths = { SdfPath("/Parent") };
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+    options.excludedPaths.clear();
+    options.rootPath = SdfPath("/Other");
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+    options.rootPath = SdfPath("/Parent");
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit));
+
+    // Resyncs drop the subtree.
+    EXPECT_EQ(intersector.getCachedMeshCount(), 1u);
+    stage->RemovePrim(SdfPath("/Parent"));
+    EXPECT_EQ(intersector.getCachedMeshCount(), 0u);
+    EXPECT_FALSE(intersector.intersect(ray, options, &hit));
+}
+
+TEST(StageRayIntersector, instances)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->CreateClassPrim(SdfPath("/Prototype"));
+    _DefineQuad(stage, SdfPath("/Prototype/Quad"));
+    for (int i = 0; i < 3; ++i) {
+        UsdGeomXform instance
+            = UsdGeomXform::Define(stage, SdfPath("/Instance" + std::to_string(i)));
+        instance.GetPrim().GetReferences().AddInternalReference(SdfPath("/Prototype"));
+        instance.GetPrim().SetInstanceable(true);
+        UsdGeomXformCommonAPI(instance).SetTranslate(GfVec3d(10.0 * i, 0.0, 0.0));
+    }
+
+    StageRayIntersector          intersector(stage);
+    StageRayIntersector::Options options;
+    StageRayIntersector::Hit     hit;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(intersector.intersect(
+            GfRay(GfVec3d(10.0 * i + 0.3, 0.1, 2.0), kDown), options, &hit));
+        EXPECT_TRUE(_IsClose(hit.point, GfVec3d(10.0 * i + 0.3, 0.1, 0.0)));
+        EXPECT_EQ(hit.primPath, SdfPath("/Instance" + std::to_string(i) + "/Quad"));
+    }
+    EXPECT_FALSE(intersector.intersect(GfRay(GfVec3d(5.0, 0.0, 2.0), kDown), options, &hit));
+
+    // The instances share the hierarchy of their prototype.
+    EXPECT_EQ(intersector.getCachedMeshCount(), 1u);
+}
+
+TEST(StageRayIntersector, otherGprims)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    _DefineQuad(stage, SdfPath("/Quad"));
+
+    StageRayIntersector          intersector(stage);
+    StageRayIntersector::Options options;
+    StageRayIntersector::Hit     hit;
+    const GfRay                  ray(GfVec3d(0.3, 0.1, 2.0), kDown);
+    bool                         skippedGprims = true;
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit, &skippedGprims));
+    EXPECT_FALSE(skippedGprims);
+
+    // Other gprims are reported, so that the caller can intersect them another
+    // way, unless they are excluded from the query.
+    UsdGeomSphere::Define(stage, SdfPath("/Sphere"));
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit, &skippedGprims));
+    EXPECT_TRUE(skippedGprims);
+    options.excludedPaths = { SdfPath("/Sphere") };
+    EXPECT_TRUE(intersector.intersect(ray, options, &hit, &skippedGprims));
+    EXPECT_FALSE(skippedGprims);
+}
@@ -24,7 +24,7 @@ import testUtils
 
 import mayaUsd.lib as mayaUsdLib
 
-from pxr import UsdGeom
+from pxr import Sdf, UsdGeom
 
 from maya import cmds
 from maya import standalone
@@ -503,5 +503,85 @@ class AttributesTestCase(unittest.TestCase):
         # Clear the metadata for the attribute.
         self.assertTrue(attr.clearMetadata('TestMetadata'))
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Test requires remove attribute and its connections feature only available on Ufe v4 or later')
+    def testRenameAndRemoveInLargeNodeGraph(self):
+        '''Test renaming and removing boundary attributes of a node graph with many nodes.'''
+
+        cmds.file(new=True, force=True)
+        shapeNode, shapeStage = mayaUtils.createProxyAndStage()
+
+        # Author a material with a node graph of a chain of nodes. Only a few
+        # of the nodes are connected to the input of the node graph.
+        numNodes = 1000
+        boundaryStep = 100
+        materialPath = Sdf.Path('/Material')
+        nodeGraphPath = materialPath.AppendChild('NodeGraph')
+        floatType = Sdf.ValueTypeNames.Float
+        layer = shapeStage.GetRootLayer()
+        with Sdf.ChangeBlock():
+            materialSpec = Sdf.CreatePrimInLayer(layer, materialPath)
+            materialSpec.specifier = Sdf.SpecifierDef
+            materialSpec.typeName = 'Material'
+            nodeGraphSpec = Sdf.PrimSpec(materialSpec, 'NodeGraph', Sdf.SpecifierDef, 'NodeGraph')
+            Sdf.AttributeSpec(nodeGraphSpec, 'inputs:scale', floatType)
+            ngOutput = Sdf.AttributeSpec(nodeGraphSpec, 'outputs:out', floatType)
+            for i in range(numNodes):
+                nodeSpec = Sdf.PrimSpec(nodeGraphSpec, 'node%d' % i, Sdf.SpecifierDef, 'Shader')
+                nodeInput = Sdf.AttributeSpec(nodeSpec, 'inputs:in', floatType)
+                if i > 0:
+                    nodeInput.connectionPathList.explicitItems.append(
+                        nodeGraphPath.AppendPath(Sdf.Path('node%d.outputs:out' % (i - 1))))
+                Sdf.AttributeSpec(nodeSpec, 'outputs:out', floatType)
+                if i % boundaryStep == 0:
+                    nodeScale = Sdf.AttributeSpec(nodeSpec, 'inputs:scale', floatType)
+                    nodeScale.connectionPathList.explicitItems.append(
+                        nodeGraphPath.AppendProperty('inputs:scale'))
+            ngOutput.connectionPathList.explicitItems.append(
+                nodeGraphPath.AppendPath(Sdf.Path('node%d.outputs:out' % (numNodes - 1))))
+            surfaceSpec = Sdf.PrimSpec(materialSpec, 'surface', Sdf.SpecifierDef, 'Shader')
+            surfaceInput = Sdf.AttributeSpec(surfaceSpec, 'inputs:in', floatType)
+            surfaceInput.connectionPathList.explicitItems.append(
+                nodeGraphPath.AppendProperty('outputs:out'))
+
+        nodeGraphItem = ufeUtils.createUfeSceneItem(shapeNode, str(nodeGraphPath))
+        self.assertIsNotNone(nodeGraphItem)
+        nodeGraphAttrs = ufe.Attributes.attributes(nodeGraphItem)
+        self.assertIsNotNone(nodeGraphAttrs)
+
+        boundaryNodes = [shapeStage.GetPrimAtPath(nodeGraphPath.AppendChild('node%d' % i))
+                         for i in range(0, numNodes, boundaryStep)]
+
+        # 1. Rename the input of the node graph.
+        ufeCmd.execute(nodeGraphAttrs.renameAttributeCmd('inputs:scale', 'inputs:gain'))
+
+        gainPath = nodeGraphPath.AppendProperty('inputs:gain')
+        for node in boundaryNodes:
+            self.assertEqual(node.GetAttribute('inputs:scale').GetConnections(), [gainPath])
+
+        # 2. Rename the output of the node graph.
+        ufeCmd.execute(nodeGraphAttrs.renameAttributeCmd('outputs:out', 'outputs:result'))
+
+        surfaceInput = shapeStage.GetAttributeAtPath('/Material/surface.inputs:in')
+        self.assertEqual(surfaceInput.GetConnections(),
+            [nodeGraphPath.AppendProperty('outputs:result')])
+
+        # 3. Remove the input of the node graph: the node inputs that only held
+        #    the connections are removed too.
+        ufeCmd.execute(nodeGraphAttrs.removeAttributeCmd('inputs:gain'))
+
+        self.assertNotIn('inputs:gain', nodeGraphAttrs.attributeNames)
+        for node in boundaryNodes:
+            self.assertFalse(node.HasProperty('inputs:scale'))
+
+        # The connections between the nodes are untouched.
+        lastNode = shapeStage.GetPrimAtPath(nodeGraphPath.AppendChild('node%d' % (numNodes - 1)))
+        self.assertEqual(lastNode.GetAttribute('inputs:in').GetConnections(),
+            [nodeGraphPath.AppendPath(Sdf.Path('node%d.outputs:out' % (numNodes - 2)))])
+
+        # 4. Undo restores the connections to the input of the node graph.
+        cmds.undo()
+        for node in boundaryNodes:
+            self.assertEqual(node.GetAttribute('inputs:scale').GetConnections(), [gainPath])
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -710,6 +710,47 @@ class DeleteCmdTestCase(unittest.TestCase):
         # Restore EditRouter callbacks to default.
         mayaUsdLib.restoreAllDefaultEditRouters()
 
+    def testDeleteManyPrimsWithDeepSublayers(self):
+        '''Delete many prims on a stage with deep sublayer stacks.'''
+
+        cmds.file(new=True, force=True)
+        import mayaUsd_createStageWithNewLayer
+
+        proxyShapePathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(proxyShapePathStr).GetStage()
+        self.assertTrue(stage)
+
+        # Chain many empty sublayers under both the root and the session layers.
+        # The editability checks of each deleted prim look through all of them.
+        depth = 50
+        sublayers = []
+        for topLayer in [stage.GetRootLayer(), stage.GetSessionLayer()]:
+            parentLayer = topLayer
+            for _ in range(depth):
+                sublayer = Sdf.Layer.CreateAnonymous()
+                sublayers.append(sublayer)
+                parentLayer.subLayerPaths.append(sublayer.identifier)
+                parentLayer = sublayer
+
+        count = 200
+        stage.SetEditTarget(stage.GetRootLayer())
+        with Sdf.ChangeBlock():
+            for i in range(count):
+                Sdf.CreatePrimInLayer(stage.GetRootLayer(), '/Prim%d' % i).specifier = Sdf.SpecifierDef
+
+        primPaths = ['%s,/Prim%d' % (proxyShapePathStr, i) for i in range(count)]
+        for i in range(count):
+            self.assertTrue(stage.GetPrimAtPath('/Prim%d' % i))
+
+        cmds.delete(primPaths)
+
+        for i in range(count):
+            self.assertFalse(stage.GetPrimAtPath('/Prim%d' % i))
+
+        cmds.undo()
+        for i in range(count):
+            self.assertTrue(stage.GetPrimAtPath('/Prim%d' % i))
+
 
 
 if __name__ == '__main__':
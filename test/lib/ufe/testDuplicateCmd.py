@@ -26,7 +26,7 @@ from maya import cmds
 from maya import standalone
 from maya.internal.ufeSupport import ufeCmdWrapper as ufeCmd
 
-from pxr import Sdf
+from pxr import Sdf, Tf, Usd
 
 import mayaUsd.ufe
 
@@ -777,5 +777,107 @@ class DuplicateCmdTestCase(unittest.TestCase):
             self.assertEqual(len(propConnections), 1)
             self.assertTrue(str(propConnections[0]).startswith('/rock10/mtl'))
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Test only available in UFE v4 or greater')
+    def testDuplicateManyItems(self):
+        '''Duplicate many items at once and compare with duplicating them one at a time.'''
+        numItems = 200
+
+        cmds.file(new=True, force=True)
+        import mayaUsd_createStageWithNewLayer
+
+        def createStage():
+            psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+            stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+            stage.DefinePrim('/Looks/Mat', 'Material')
+            for i in range(numItems):
+                item = stage.DefinePrim('/Item%d' % i, 'Xform')
+                child = stage.DefinePrim('/Item%d/Child' % i, 'Xform')
+                stage.DefinePrim('/Item%d/Other' % i, 'Xform')
+                item.CreateAttribute('value', Sdf.ValueTypeNames.Int).Set(i)
+                item.CreateRelationship('buddy').SetTargets(
+                    [Sdf.Path('/Item%d' % ((i + 1) % numItems))])
+                child.CreateRelationship('sibling').SetTargets([Sdf.Path('/Item%d/Other' % i)])
+                child.CreateRelationship('material').SetTargets([Sdf.Path('/Looks/Mat')])
+
+            psPathSegment = ufe.PathString.path(psPathStr).segments[0]
+            items = [ufe.Hierarchy.createItem(ufe.Path(
+                [psPathSegment, usdUtils.createUfePathSegment('/Item%d' % i)]))
+                for i in range(numItems)]
+            return stage, items
+
+        def countObjectsChanged(stage, function):
+            notices = []
+            listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged,
+                lambda notice, sender: notices.append(notice), stage)
+            try:
+                function()
+            finally:
+                listener.Revoke()
+            return len(notices)
+
+        # Duplicate the items one at a time in a first stage.
+        stageA, itemsA = createStage()
+        duplicatePaths = []
+        def duplicateOneAtATime():
+            for item in itemsA:
+                duplicateCmd = ufe.SceneItemOps.sceneItemOps(item).duplicateItemCmdNoExecute()
+                duplicateCmd.execute()
+                duplicatePaths.append(
+                    usdUtils.getPrimFromSceneItem(duplicateCmd.sceneItem).GetPath())
+        self.assertGreaterEqual(countObjectsChanged(stageA, duplicateOneAtATime), numItems)
+
+        # Duplicate all the items at once in a second stage. The specs of all the
+        # duplicates are copied in one change block and their relationships fixed
+        # in another one, so the stage is only recomposed twice.
+        stageB, itemsB = createStage()
+        sn = ufe.Selection()
+        for item in itemsB:
+            sn.append(item)
+        ufe.GlobalSelection.get().replaceWith(sn)
+        self.assertEqual(countObjectsChanged(stageB, cmds.duplicate), 2)
+
+        # The duplicates are siblings of their source, with new unique names, and
+        # are selected.
+        self.assertEqual(len(set(duplicatePaths)), numItems)
+        for i, duplicatePath in enumerate(duplicatePaths):
+            self.assertEqual(duplicatePath.GetParentPath(), Sdf.Path.absoluteRootPath)
+            self.assertNotEqual(duplicatePath, Sdf.Path('/Item%d' % i))
+        self.assertEqual(
+            sorted(usdUtils.getPrimFromSceneItem(item).GetPath()
+                   for item in ufe.GlobalSelection.get()),
+            sorted(duplicatePaths))
+
+        # The duplicates get the same names. Relationships between the duplicated items
+        # are remapped to the duplicates when duplicating them at once.
+        for i in range(numItems):
+            duplicateA = stageA.GetPrimAtPath(duplicatePaths[i])
+            duplicateB = stageB.GetPrimAtPath(duplicatePaths[i])
+            self.assertTrue(duplicateA)
+            self.assertTrue(duplicateB)
+            buddy = (i + 1) % numItems
+            self.assertEqual(duplicateA.GetRelationship('buddy').GetTargets(),
+                [Sdf.Path('/Item%d' % buddy)])
+            self.assertEqual(duplicateB.GetRelationship('buddy').GetTargets(),
+                [duplicatePaths[buddy]])
+
+            # Relationships inside a duplicate follow it, the others are kept.
+            for stage in (stageA, stageB):
+                child = stage.GetPrimAtPath(duplicatePaths[i].AppendChild('Child'))
+                self.assertEqual(child.GetRelationship('sibling').GetTargets(),
+                    [duplicatePaths[i].AppendChild('Other')])
+                self.assertEqual(child.GetRelationship('material').GetTargets(),
+                    [Sdf.Path('/Looks/Mat')])
+
+        # Everything else is identical.
+        def exportWithoutBuddies(stage):
+            return [line for line in stage.GetRootLayer().ExportToString().splitlines()
+                if 'buddy' not in line]
+        self.assertEqual(exportWithoutBuddies(stageA), exportWithoutBuddies(stageB))
+
+        cmds.undo()
+        for duplicatePath in duplicatePaths:
+            self.assertFalse(stageB.GetPrimAtPath(duplicatePath))
+        self.assertTrue(stageB.GetPrimAtPath('/Item%d' % (numItems - 1)))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -23,6 +23,7 @@ from mayaUsd import ufe as mayaUsdUfe
 
 from pxr import Gf
 from pxr import UsdGeom
+from pxr import Vt
 
 from maya import cmds
 from maya import standalone
@@ -32,6 +33,23 @@ import ufe
 import unittest
 
 
+class PointInstanceObserver(ufe.Observer):
+    '''
+    Records the Transform3d notifications of point instances, with the position
+    of the notified point instance when notified.
+    '''
+    def __init__(self, positionsAttr):
+        super(PointInstanceObserver, self).__init__()
+        self._positionsAttr = positionsAttr
+        self.notifications = []
+
+    def __call__(self, notification):
+        if isinstance(notification, ufe.Transform3dChanged):
+            instanceIndex = int(str(notification.item().path().back()))
+            position = self._positionsAttr.Get()[instanceIndex]
+            self.notifications.append((instanceIndex, position))
+
+
 class PointInstancesTestCase(unittest.TestCase):
     '''
     Tests that the UFE path and scene item interfaces work as expected when
@@ -355,6 +373,71 @@ class PointInstancesTestCase(unittest.TestCase):
         self.assertTrue(
             Gf.IsClose(scale, Gf.Vec3f(1.0, 1.0, 1.0), self.EPSILON))
 
+    def testManipulateManyPointInstances(self):
+        '''
+        Moves a large selection of point instances. The commands of the move
+        share a single read of the positions and write them once, then notify
+        once on each point instance, after the write.
+        '''
+        numInstances = 10000
+        numSelected = 500
+
+        cmds.file(new=True, force=True)
+        shapeNode, stage = mayaUtils.createProxyAndStage()
+        pointInstancer = UsdGeom.PointInstancer.Define(stage, '/PointInstancer')
+        UsdGeom.Cube.Define(stage, '/PointInstancer/Prototypes/Cube')
+        pointInstancer.CreatePrototypesRel().AddTarget('/PointInstancer/Prototypes/Cube')
+        pointInstancer.CreateProtoIndicesAttr().Set(Vt.IntArray(numInstances))
+        positionsAttr = pointInstancer.CreatePositionsAttr()
+        positionsAttr.Set(Vt.Vec3fArray(numInstances))
+
+        # Select every other instance of the first part of the instancer, and
+        # observe them.
+        observer = PointInstanceObserver(positionsAttr)
+        selectedIndices = list(range(0, 2 * numSelected, 2))
+        selection = ufe.Selection()
+        for instanceIndex in selectedIndices:
+            ufePath = ufe.Path([
+                mayaUtils.createUfePathSegment(shapeNode),
+                usdUtils.createUfePathSegment('/PointInstancer/%d' % instanceIndex)])
+            ufeItem = ufe.Hierarchy.createItem(ufePath)
+            ufe.Transform3d.addObserver(ufeItem, observer)
+            selection.append(ufeItem)
+        ufe.GlobalSelection.get().replaceWith(selection)
+
+        def assertNotifiedOnce(expectedPosition):
+            # Each point instance is notified once, with its position already
+            # written.
+            self.assertEqual(sorted(index for index, _ in observer.notifications),
+                             selectedIndices)
+            for instanceIndex, position in observer.notifications:
+                self.assertTrue(Gf.IsClose(position, expectedPosition, self.EPSILON),
+                                'instance %d: %s' % (instanceIndex, position))
+            observer.notifications = []
+
+        def assertPositions(expectedPosition):
+            positions = positionsAttr.Get()
+            self.assertEqual(len(positions), numInstances)
+            for instanceIndex in selectedIndices:
+                self.assertTrue(
+                    Gf.IsClose(positions[instanceIndex], expectedPosition, self.EPSILON))
+            self.assertTrue(Gf.IsClose(positions[1], Gf.Vec3f(0.0, 0.0, 0.0), self.EPSILON))
+            self.assertTrue(
+                Gf.IsClose(positions[2 * numSelected], Gf.Vec3f(0.0, 0.0, 0.0), self.EPSILON))
+
+        moved = Gf.Vec3f(1.0, 2.0, 3.0)
+        cmds.move(1.0, 2.0, 3.0, objectSpace=True, relative=True)
+        assertNotifiedOnce(moved)
+        assertPositions(moved)
+
+        cmds.undo()
+        assertNotifiedOnce(Gf.Vec3f(0.0, 0.0, 0.0))
+        assertPositions(Gf.Vec3f(0.0, 0.0, 0.0))
+
+        cmds.redo()
+        assertNotifiedOnce(moved)
+        assertPositions(moved)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
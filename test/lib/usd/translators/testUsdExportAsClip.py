@@ -22,8 +22,27 @@ from maya import standalone
 
 from pxr import Sdf, Usd, UsdGeom, Gf, Vt, UsdUtils
 
+import mayaUsd.lib as mayaUsdLib
+
 import fixturesUtils
 
+class valueClipChaser(mayaUsdLib.ExportChaser):
+    """Authors more than time samples while the value clips are edited."""
+    def __init__(self, factoryContext, *args, **kwargs):
+        super(valueClipChaser, self).__init__(factoryContext, *args, **kwargs)
+        self.stage = factoryContext.GetStage()
+
+    def ExportFrame(self, frame):
+        if frame == Usd.TimeCode(12):
+            prim = self.stage.DefinePrim('/world/chaserPrim', 'Scope')
+            attr = prim.CreateAttribute('chaser:value', Sdf.ValueTypeNames.Int)
+            attr.Set(7)
+            attr.Set(12, frame)
+        return True
+
+    def PostExport(self):
+        return True
+
 class testUsdExportAsClip(unittest.TestCase):
 
     @classmethod
@@ -134,6 +153,115 @@ class testUsdExportAsClip(unittest.TestCase):
         # animated points:
         self._ValidateSamples(canonicalStage, clipsStage, '/world/pCube1', 'points', (0, 21))
 
+    def testExportWithValueClipChunks(self):
+        """
+        Test that a maya scene exports to usd the same way if it is exported
+        all at once, or streamed into 5 frame value clips by the export itself.
+        """
+        # A value held over the whole second clip, which changes in the third one.
+        heldCube = cmds.polyCube(name='heldCube')[0]
+        heldCube = cmds.parent(heldCube, 'world')[0]
+        self.addCleanup(cmds.delete, heldCube)
+        for frame, value in [(1, 0.0), (10, 0.0), (11, 5.0), (20, 5.0)]:
+            cmds.setKeyframe(heldCube, attribute='translateX', time=frame, value=value,
+                inTangentType='linear', outTangentType='linear')
+
+        chunkedUsdFile = os.path.abspath('UsdExportValueClipChunks.usda')
+        cmds.usdExport(mergeTransformAndShape=True, file=chunkedUsdFile, frameRange=(1, 20),
+            sss=False, valueClipChunkSize=5)
+
+        clipFiles = [os.path.abspath('UsdExportValueClipChunks.clip%d.usdc' % i)
+                     for i in range(1, 5)]
+        manifestFile = os.path.abspath('UsdExportValueClipChunks.manifest.usda')
+        for clipFile in clipFiles:
+            self.assertTrue(os.path.isfile(clipFile), clipFile)
+        self.assertTrue(os.path.isfile(manifestFile))
+
+        # The exported layer holds no samples, they all are in the clips.
+        chunkedLayer = Sdf.Layer.FindOrOpen(chunkedUsdFile)
+        self.assertEqual(chunkedLayer.subLayerPaths, [])
+        self.assertEqual(chunkedLayer.ListAllTimeSamples(), [])
+
+        chunkedStage = Usd.Stage.Open(chunkedUsdFile)
+        clips = Usd.ClipsAPI(chunkedStage.GetPrimAtPath('/world'))
+        self.assertEqual(clips.GetClipPrimPath(), '/world')
+        self.assertEqual([path.path for path in clips.GetClipAssetPaths()],
+                         ['./' + os.path.basename(clipFile) for clipFile in clipFiles])
+        self.assertEqual(list(clips.GetClipActive()),
+                         [Gf.Vec2d(1, 0), Gf.Vec2d(6, 1), Gf.Vec2d(11, 2), Gf.Vec2d(16, 3)])
+
+        manifest = Sdf.Layer.FindOrOpen(manifestFile)
+        self.assertTrue(manifest.GetAttributeAtPath('/world/pCube1.points'))
+
+        canonicalUsdFile = os.path.abspath('canonicalForValueClipChunks.usda')
+        cmds.usdExport(mergeTransformAndShape=True, file=canonicalUsdFile, frameRange=(1, 20), sss=False)
+        canonicalStage = Usd.Stage.Open(canonicalUsdFile)
+
+        for primPath in ['/world/pCube1', '/world/pCube2', '/world/pCube3', '/world/pCube4']:
+            for attrName in ['visibility', 'points']:
+                self._ValidateSamples(canonicalStage, chunkedStage, primPath, attrName, (0, 21))
+
+        self._ValidateSamples(canonicalStage, chunkedStage, '/world/heldCube',
+            'xformOp:translate', (1, 21))
+        heldTranslate = chunkedStage.GetPrimAtPath('/world/heldCube').GetAttribute(
+            'xformOp:translate')
+        for frame in range(6, 11):
+            self.assertTrue(Gf.IsClose(heldTranslate.Get(frame), Gf.Vec3d(0, 0, 0), 1e-6),
+                'frame %d: %s' % (frame, heldTranslate.Get(frame)))
+        self.assertTrue(Gf.IsClose(heldTranslate.Get(11), Gf.Vec3d(5, 0, 0), 1e-6))
+
+    def testExportWithValueClipChunksAgain(self):
+        """
+        Test that exporting into value clips over a previous export reuses its
+        open clip layers and removes its clips that are no longer used, and
+        that the opinions that are not time samples are kept.
+        """
+        mayaUsdLib.ExportChaser.Register(valueClipChaser, 'valueClipChaser')
+
+        usdFile = os.path.abspath('UsdExportValueClipChunksAgain.usda')
+        clipFiles = [os.path.abspath('UsdExportValueClipChunksAgain.clip%d.usdc' % i)
+                     for i in range(1, 5)]
+        cmds.usdExport(mergeTransformAndShape=True, file=usdFile, frameRange=(1, 20),
+            sss=False, valueClipChunkSize=5)
+        for clipFile in clipFiles:
+            self.assertTrue(os.path.isfile(clipFile), clipFile)
+
+        # Keep the first clip open over the next export.
+        firstClip = Sdf.Layer.FindOrOpen(clipFiles[0])
+        self.assertEqual(firstClip.ListAllTimeSamples(), [1, 2, 3, 4, 5])
+
+        cmds.usdExport(mergeTransformAndShape=True, file=usdFile, frameRange=(1, 20),
+            sss=False, valueClipChunkSize=10, chaser=['valueClipChaser'])
+        self.assertTrue(os.path.isfile(clipFiles[0]))
+        self.assertTrue(os.path.isfile(clipFiles[1]))
+        self.assertFalse(os.path.isfile(clipFiles[2]))
+        self.assertFalse(os.path.isfile(clipFiles[3]))
+        self.assertEqual(firstClip.ListAllTimeSamples(), list(range(1, 11)))
+
+        stage = Usd.Stage.Open(usdFile)
+        clips = Usd.ClipsAPI(stage.GetPrimAtPath('/world'))
+        self.assertEqual([path.path for path in clips.GetClipAssetPaths()],
+                         ['./' + os.path.basename(clipFile) for clipFile in clipFiles[:2]])
+
+        # The prim definition and default value the chaser authored in the
+        # second clip are in the exported layer, the time sample in the clip.
+        layer = Sdf.Layer.FindOrOpen(usdFile)
+        primSpec = layer.GetPrimAtPath('/world/chaserPrim')
+        self.assertTrue(primSpec)
+        self.assertEqual(primSpec.specifier, Sdf.SpecifierDef)
+        self.assertEqual(primSpec.typeName, 'Scope')
+        self.assertEqual(layer.GetAttributeAtPath('/world/chaserPrim.chaser:value').default, 7)
+
+        secondClip = Sdf.Layer.FindOrOpen(clipFiles[1])
+        clipAttr = secondClip.GetAttributeAtPath('/world/chaserPrim.chaser:value')
+        self.assertFalse(clipAttr.HasDefaultValue())
+        self.assertEqual(secondClip.ListTimeSamplesForPath(clipAttr.path), [12])
+
+        attr = stage.GetPrimAtPath('/world/chaserPrim').GetAttribute('chaser:value')
+        self.assertEqual(stage.GetPrimAtPath('/world/chaserPrim').GetTypeName(), 'Scope')
+        self.assertEqual(attr.Get(), 7)
+        self.assertEqual(attr.Get(12), 12)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -573,6 +573,77 @@ class testUsdExportColorSets(unittest.TestCase):
         self._VerifyColorSetsAsDisplayColorExportForCube(cubeName, colorSetName,
             expectedColors, expectedAlphas, expectedIndices)
 
+    def testExportLargeMeshColorSetValues(self):
+        """
+        Tests that the color set values exported for a large mesh with a
+        partially assigned color set match the ones returned face vertex by
+        face vertex by MItMeshFaceVertex.
+        """
+        meshName = cmds.polyPlane(name='LargeColorPlane', w=1, h=1, sx=100, sy=100)[0]
+        meshShapeName = cmds.listRelatives(meshName, shapes=True)[0]
+        colorSetName = 'partialSet'
+        cmds.polyColorSet(meshName, create=True, colorSet=colorSetName, representation='RGBA')
+        cmds.polyColorSet(meshName, currentColorSet=True, colorSet=colorSetName)
+
+        # Every other face gets a distinct color on each of its face vertices,
+        # so that the color set is exported face varying. The other faces are
+        # left unassigned.
+        mayaMesh = self._GetCubeMayaMesh(meshShapeName)
+        numFaces = mayaMesh.numPolygons()
+        colors = OpenMaya.MColorArray()
+        faceList = OpenMaya.MIntArray()
+        vertexList = OpenMaya.MIntArray()
+        for face in range(0, numFaces, 2):
+            faceVertices = OpenMaya.MIntArray()
+            mayaMesh.getPolygonVertices(face, faceVertices)
+            for i in range(faceVertices.length()):
+                colors.append(OpenMaya.MColor(
+                    float(face) / numFaces, 0.25 * i, 0.5, 1.0))
+                faceList.append(face)
+                vertexList.append(faceVertices[i])
+        mayaMesh.setFaceVertexColors(colors, faceList, vertexList)
+
+        usdFilePath = os.path.abspath('UsdExportLargeMeshColorSetsTest.usda')
+        cmds.select(meshName, replace=True)
+        cmds.usdExport(mergeTransformAndShape=True,
+            file=usdFilePath,
+            selection=True,
+            shadingMode='none',
+            exportColorSets=True,
+            exportDisplayColor=False,
+            exportUVs=False)
+
+        stage = Usd.Stage.Open(usdFilePath)
+        usdMesh = UsdGeom.Mesh(stage.GetPrimAtPath('/' + meshName))
+        self.assertTrue(usdMesh)
+
+        primvar = UsdGeom.PrimvarsAPI(usdMesh).GetPrimvar(colorSetName)
+        self.assertTrue(primvar)
+        self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.faceVarying)
+        values = primvar.Get()
+        indices = primvar.GetIndices()
+        unauthoredIndex = primvar.GetUnauthoredValuesIndex()
+        self.assertGreaterEqual(unauthoredIndex, 0)
+        self.assertEqual(len(indices), mayaMesh.numFaceVertices())
+
+        fvi = 0
+        itFV = OpenMaya.MItMeshFaceVertex(mayaMesh.object())
+        while not itFV.isDone():
+            if itFV.hasColor():
+                color = OpenMaya.MColor()
+                itFV.getColor(color)
+                expected = Gf.Vec4f(color.r, color.g, color.b, color.a)
+                self.assertNotEqual(indices[fvi], unauthoredIndex)
+                self.assertTrue(Gf.IsClose(values[indices[fvi]], expected, 1e-6),
+                    'face vertex %d' % fvi)
+            else:
+                self.assertEqual(indices[fvi], unauthoredIndex)
+            itFV.next()
+            fvi += 1
+        self.assertEqual(fvi, len(indices))
+
+        cmds.delete(meshName)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -23,6 +23,7 @@ from maya import cmds
 from maya import standalone
 
 from pxr import Kind
+from pxr import Sdf
 from pxr import Usd
 from pxr import UsdGeom
 
@@ -34,8 +35,8 @@ class testUsdExportInstances(unittest.TestCase):
     def setUpClass(cls):
         inputPath = fixturesUtils.setUpClass(__file__)
 
-        filePath = os.path.join(inputPath, "UsdExportInstancesTest", "UsdExportInstancesTest.ma")
-        cmds.file(filePath, force=True, open=True)
+        cls.filePath = os.path.join(inputPath, "UsdExportInstancesTest", "UsdExportInstancesTest.ma")
+        cmds.file(cls.filePath, force=True, open=True)
 
     @classmethod
     def tearDownClass(cls):
@@ -125,5 +126,57 @@ class testUsdExportInstances(unittest.TestCase):
         pCube1 = Usd.ModelAPI.Get(stage, '/pCube1')
         self.assertEqual(pCube1.GetKind(), Kind.Tokens.component)
 
+    def testExportInstances_ManyMasters(self):
+        """Tests exporting many instance masters with many instances each."""
+        numMasters = 200
+        numInstances = 5
+
+        cmds.file(new=True, force=True)
+        try:
+            for i in range(numMasters):
+                proto = cmds.polyCube(name='proto%d' % i)[0]
+                child = cmds.polySphere(name='child%d' % i)[0]
+                cmds.parent(child, proto)
+                for j in range(1, numInstances):
+                    cmds.instance(proto, name='instance%d_%d' % (i, j))
+
+            layers = []
+            for i in range(2):
+                usdFile = os.path.abspath('UsdExportInstances_manyMasters%d.usda' % i)
+                cmds.usdExport(mergeTransformAndShape=True, exportInstances=True,
+                    shadingMode='none', file=usdFile)
+                layers.append(Sdf.Layer.FindOrOpen(usdFile))
+
+            # The export is deterministic.
+            self.assertEqual(layers[0].ExportToString(), layers[1].ExportToString())
+
+            # One master for the cube shape and one for the sphere transform
+            # of each prototype.
+            stage = Usd.Stage.Open(layers[0])
+            masters = stage.GetPrimAtPath('/MayaExportedInstanceSources').GetChildren()
+            self.assertEqual(len(masters), numMasters * 2)
+
+            for i in range(numMasters):
+                paths = cmds.ls('child%d' % i, allPaths=True, long=True)
+                self.assertEqual(len(paths), numInstances)
+
+                masterPaths = set()
+                for path in paths:
+                    instance = stage.GetPrimAtPath(path.replace('|', '/'))
+                    self.assertTrue(instance.IsValid(), path)
+                    self.assertTrue(instance.IsInstance(), path)
+                    refs = layers[0].GetPrimAtPath(instance.GetPath()) \
+                        .referenceList.GetAddedOrExplicitItems()
+                    masterPaths.add(refs[0].primPath)
+
+                    # The master descendants are found under every instance.
+                    self.assertTrue(stage.GetPrimAtPath(
+                        instance.GetPath().AppendChild('child%dShape' % i)).IsValid(), path)
+
+                self.assertEqual(len(masterPaths), 1)
+                self.assertTrue(stage.GetPrimAtPath(masterPaths.pop()).IsValid())
+        finally:
+            cmds.file(self.filePath, force=True, open=True)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -15,6 +15,7 @@
 # limitations under the License.
 #
 
+from pxr import Sdf
 from pxr import Usd
 from pxr import UsdShade
 from pxr import Sdr
@@ -306,6 +307,84 @@ class testUsdExportMultiMaterial(unittest.TestCase):
         src_input = src_shade.GetInput("uvCoord")
         self.assertEqual(str(src_input.GetAttr().GetTypeName()), "float2")
 
+    def testMergeIdenticalMaterials(self):
+        """
+        Test that shading networks differing only by their node names are
+        exported once when merging identical materials, and that the other
+        materials reference the shared one.
+        """
+        cmds.file(new=True, force=True)
+
+        def makeNetwork(name, roughness):
+            shader = cmds.shadingNode("usdPreviewSurface", asShader=True, name=name)
+            cmds.setAttr(shader + ".roughness", roughness)
+            file_node = cmds.shadingNode("file", asTexture=True, isColorManaged=True)
+            cmds.setAttr(file_node + ".fileTextureName", "diffuse.png", type="string")
+            uv_node = cmds.shadingNode("place2dTexture", asUtility=True)
+            connectUVNode(uv_node, file_node)
+            cmds.connectAttr(file_node + ".outColor", shader + ".diffuseColor", f=True)
+            sg = cmds.sets(renderable=True, noSurfaceShader=True, empty=True, name=name + "SG")
+            cmds.connectAttr(shader + ".outColor", sg + ".surfaceShader", force=True)
+            sphere = cmds.polySphere(name=name + "Sphere")[0]
+            cmds.sets(sphere, e=True, forceElement=sg)
+            return sg
+
+        # Two groups of identical networks, and one that differs by a value.
+        shared_rough = [makeNetwork("rough%d" % i, 0.75) for i in range(3)]
+        shared_smooth = [makeNetwork("smooth%d" % i, 0.25) for i in range(3)]
+        unique = makeNetwork("unique", 0.5)
+
+        def export(merge):
+            usd_path = os.path.abspath(
+                'MergeIdenticalMaterials%s.usdc' % ('On' if merge else 'Off'))
+            cmds.mayaUSDExport(mergeTransformAndShape=True,
+                file=usd_path,
+                shadingMode='useRegistry',
+                convertMaterialsTo=['UsdPreviewSurface'],
+                materialsScopeName='Looks',
+                legacyMaterialScope=False,
+                mergeIdenticalMaterials=merge,
+                defaultPrim='None')
+            return usd_path
+
+        def countShaderSpecs(usd_path):
+            layer = Sdf.Layer.FindOrOpen(usd_path)
+            shaders = []
+            def visit(path):
+                if path.IsPrimPath() and layer.GetPrimAtPath(path).typeName == 'Shader':
+                    shaders.append(path)
+            layer.Traverse(Sdf.Path.absoluteRootPath, visit)
+            return len(shaders)
+
+        off_path = export(False)
+        on_path = export(True)
+
+        on_stage = Usd.Stage.Open(on_path)
+
+        off_shaders = countShaderSpecs(off_path)
+        on_shaders = countShaderSpecs(on_path)
+        self.assertGreater(off_shaders, 0)
+        # One network authored per group instead of one per material.
+        self.assertEqual(on_shaders * 7, off_shaders * 3)
+
+        for group in (shared_rough, shared_smooth, [unique]):
+            # Exactly one material per group holds the network, the others
+            # reference it.
+            mat_prims = [on_stage.GetPrimAtPath("/Looks/" + sg) for sg in group]
+            owners = [prim for prim in mat_prims if not prim.HasAuthoredReferences()]
+            self.assertEqual(len(owners), 1)
+            for sg, mat_prim in zip(group, mat_prims):
+                self.assertTrue(mat_prim, sg)
+                if mat_prim != owners[0]:
+                    refs = mat_prim.GetMetadata("references").GetAddedOrExplicitItems()
+                    self.assertEqual(refs[0].primPath, owners[0].GetPath())
+
+                # The material still resolves the shared surface and is bound.
+                mat = UsdShade.Material(mat_prim)
+                self.assertTrue(mat.GetSurfaceOutput().HasConnectedSource())
+                sphere = on_stage.GetPrimAtPath("/" + sg[:-2] + "Sphere")
+                bound, _ = UsdShade.MaterialBindingAPI(sphere).ComputeBoundMaterial()
+                self.assertEqual(bound.GetPath(), mat_prim.GetPath())
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
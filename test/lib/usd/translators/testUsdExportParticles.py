@@ -35,8 +35,8 @@ class testUsdExportParticles(unittest.TestCase):
     def setUpClass(cls):
         inputPath = fixturesUtils.setUpClass(__file__)
 
-        filePath = os.path.join(inputPath, "UsdExportParticlesTest", "UsdExportParticlesTest.ma")
-        cmds.file(filePath, force=True, open=True)
+        cls.filePath = os.path.join(inputPath, "UsdExportParticlesTest", "UsdExportParticlesTest.ma")
+        cmds.file(cls.filePath, force=True, open=True)
 
     @classmethod
     def tearDownClass(cls):
@@ -56,5 +56,46 @@ class testUsdExportParticles(unittest.TestCase):
         self.assertEqual(p.GetWidthsAttr().Get(1), Vt.FloatArray(5, (2.0, 2.0, 2.0, 2.0, 2.0)))
         self.assertEqual(p.GetIdsAttr().Get(1), Vt.Int64Array(5, (0, 1, 2, 3, 4)))
 
+    def testExportManyParticles(self):
+        """Exports a synthetic cache of a few thousand particles over a few frames."""
+        numParticles = 5000
+
+        cmds.file(new=True, force=True)
+        try:
+            particle, particleShape = cmds.particle(
+                jitterBasePoint=(0, 0, 0), numJitters=numParticles, jitterRadius=100)
+            cmds.addAttr(particleShape, longName='userScalarPP', dataType='doubleArray')
+            cmds.addAttr(particleShape, longName='userVectorPP', dataType='vectorArray')
+            cmds.dynExpression(particleShape, runtimeBeforeDynamics=True, string=
+                'userScalarPP = particleId * 0.5;\n'
+                'userVectorPP = <<particleId, 1, 2>>;')
+            cmds.dynExpression(particleShape, creation=True, string=
+                'userScalarPP = particleId * 0.5;\n'
+                'userVectorPP = <<particleId, 1, 2>>;')
+
+            usdFile = os.path.abspath('UsdExportParticles_manyParticles.usda')
+            cmds.usdExport(mergeTransformAndShape=False, shadingMode='none',
+                file=usdFile, frameRange=(1, 3))
+
+            stage = Usd.Stage.Open(usdFile)
+            p = UsdGeom.Points.Get(stage, '/%s/%s' % (particle, particleShape))
+            self.assertTrue(p.GetPrim().IsValid())
+            for frame in (1, 2, 3):
+                ids = p.GetIdsAttr().Get(frame)
+                self.assertEqual(len(ids), numParticles)
+                self.assertEqual(len(p.GetPointsAttr().Get(frame)), numParticles)
+                self.assertEqual(len(p.GetVelocitiesAttr().Get(frame)), numParticles)
+                self.assertEqual(len(p.GetWidthsAttr().Get(frame)), numParticles)
+
+                scalars = p.GetPrim().GetAttribute('userScalarPP').Get(frame)
+                vectors = p.GetPrim().GetAttribute('userVectorPP').Get(frame)
+                self.assertEqual(len(scalars), numParticles)
+                self.assertEqual(len(vectors), numParticles)
+                for i in (0, numParticles // 2, numParticles - 1):
+                    self.assertEqual(scalars[i], ids[i] * 0.5)
+                    self.assertEqual(vectors[i], Gf.Vec3f(ids[i], 1, 2))
+        finally:
+            cmds.file(self.filePath, force=True, open=True)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -363,6 +363,54 @@ class testUsdExportUVSets(unittest.TestCase):
 
         self.assertEqual(stPrimvar[0], Gf.Vec2f(1.0, 2.0))
 
+    def testExportLargeMeshUVSetIndices(self):
+        """
+        Tests that the UV indices exported for a large mesh with a partially
+        mapped UV set match the ones returned face vertex by face vertex by
+        MItMeshFaceVertex.
+        """
+        meshName = cmds.polyPlane(name='LargeUVPlane', w=1, h=1, sx=200, sy=200)[0]
+        meshShapeName = cmds.listRelatives(meshName, shapes=True)[0]
+        cmds.polyUVSet(meshName, create=True, uvSet='partialSet')
+        cmds.polyProjection(meshName + '.f[0:19999]', type='Planar', uvSetName='partialSet', md='z')
+
+        usdFilePath = os.path.abspath('UsdExportLargeMeshUVSetsTest.usda')
+        cmds.select(meshName, replace=True)
+        cmds.usdExport(mergeTransformAndShape=True,
+            file=usdFilePath,
+            selection=True,
+            shadingMode='none',
+            exportColorSets=False,
+            exportDisplayColor=False,
+            exportUVs=True,
+            preserveUVSetNames=True)
+
+        stage = Usd.Stage.Open(usdFilePath)
+        mesh = UsdGeom.Mesh(stage.GetPrimAtPath('/' + meshName))
+        self.assertTrue(mesh)
+
+        meshFn = testUsdExportUVSets._GetMayaMesh(meshShapeName)
+        for uvSetName in ['map1', 'partialSet']:
+            expectedIndices = []
+            itFV = OM.MItMeshFaceVertex(meshFn.object())
+            while not itFV.isDone():
+                expectedIndices.append(
+                    itFV.getUVIndex(uvSetName) if itFV.hasUVs(uvSetName) else -1)
+                itFV.next()
+            self.assertEqual(len(expectedIndices), meshFn.numFaceVertices)
+
+            # Unassigned face vertices use the unauthored value, padded at the
+            # front of the values.
+            if -1 in expectedIndices:
+                expectedIndices = [index + 1 for index in expectedIndices]
+
+            primvar = UsdGeom.PrimvarsAPI(mesh).GetPrimvar(uvSetName)
+            self.assertTrue(primvar)
+            self.assertEqual(primvar.GetInterpolation(), UsdGeom.Tokens.faceVarying)
+            self.assertEqual(list(primvar.GetIndices()), expectedIndices)
+
+        cmds.delete(meshName)
+
     def testExportMultipleUVSetsPreserveNames(self):
         """
         Tests that a cube mesh with multiple UV sets renames them appropriately,
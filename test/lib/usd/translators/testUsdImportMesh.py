@@ -15,6 +15,8 @@
 # limitations under the License.
 #
 
+from pxr import Gf
+from pxr import Usd
 from pxr import UsdGeom
 
 import mayaUsd.lib as mayaUsdLib
@@ -23,6 +25,8 @@ from maya import cmds
 from maya import standalone
 
 import os
+import shutil
+import tempfile
 import unittest
 
 import fixturesUtils
@@ -33,8 +37,8 @@ class testUsdImportMesh(unittest.TestCase):
     def setUpClass(cls):
         inputPath = fixturesUtils.readOnlySetUpClass(__file__)
 
-        usdFile = os.path.join(inputPath, "UsdImportMeshTest", "Mesh.usda")
-        cmds.usdImport(file=usdFile, shadingMode=[['none', 'default'], ])
+        cls.usdFile = os.path.join(inputPath, "UsdImportMeshTest", "Mesh.usda")
+        cmds.usdImport(file=cls.usdFile, shadingMode=[['none', 'default'], ])
 
     @classmethod
     def tearDownClass(cls):
@@ -93,5 +97,79 @@ class testUsdImportMesh(unittest.TestCase):
     def testImportLeftHandedSubdiv(self):
         self.verifySubdivCommonAttributes('LeftHandedSubdivMeshShape')
 
+    def testImportScatteredMeshes(self):
+        """
+        Imports many copies of the same meshes, which are read ahead in
+        parallel and share their converted topology, and checks that each
+        copy gets the topology of its source mesh.
+        """
+        tempDir = tempfile.mkdtemp()
+        self.addCleanup(shutil.rmtree, tempDir, True)
+
+        sources = ['PolyMesh', 'LeftHandedPolyMesh']
+        numCopies = 500
+
+        scatterFile = os.path.join(tempDir, 'scatteredMeshes.usda')
+        stage = Usd.Stage.CreateNew(scatterFile)
+        UsdGeom.Xform.Define(stage, '/Scatter')
+        for i in range(numCopies):
+            prim = stage.DefinePrim('/Scatter/Rock_%d' % i)
+            prim.GetReferences().AddReference(
+                self.usdFile, '/World/%s' % sources[i % len(sources)])
+            UsdGeom.Xformable(prim).AddTranslateOp().Set(Gf.Vec3d(i, 0, 0))
+        stage.GetRootLayer().Save()
+
+        cmds.usdImport(file=scatterFile, primPath='/Scatter',
+            shadingMode=[['none', 'default'], ])
+
+        expectedFaces = [cmds.polyInfo('%sShape' % source, faceToVertex=True)
+            for source in sources]
+        for i in range(numCopies):
+            shape = 'Rock_%dShape' % i
+            self.assertTrue(cmds.objExists(shape))
+            self.assertEqual(cmds.polyInfo(shape, faceToVertex=True),
+                expectedFaces[i % len(sources)])
+    def testPrefetchMeshData(self):
+        """
+        Checks that prefetched meshes with identical topologies share their
+        converted topology, and that left-handed faces are reversed.
+        """
+        stage = Usd.Stage.CreateInMemory()
+        points = [Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0), Gf.Vec3f(1, 1, 0),
+                  Gf.Vec3f(0, 1, 0), Gf.Vec3f(2, 0, 0)]
+        faceVertexCounts = [4, 3]
+        faceVertexIndices = [0, 1, 2, 3, 1, 4, 2]
+
+        def defineMesh(path, orientation=UsdGeom.Tokens.rightHanded,
+                       counts=faceVertexCounts):
+            mesh = UsdGeom.Mesh.Define(stage, path)
+            mesh.CreatePointsAttr(points)
+            mesh.CreateFaceVertexCountsAttr(counts)
+            mesh.CreateFaceVertexIndicesAttr(faceVertexIndices)
+            mesh.CreateOrientationAttr(orientation)
+            return mesh
+
+        meshes = [
+            defineMesh('/Right_0'),
+            defineMesh('/Left_0', orientation=UsdGeom.Tokens.leftHanded),
+            defineMesh('/Right_1'),
+            defineMesh('/Left_1', orientation=UsdGeom.Tokens.leftHanded),
+            defineMesh('/Invalid', counts=[4, 4]),
+        ]
+        data = mayaUsdLib.MeshReadUtils.TakePrefetchedMeshData(meshes, Gf.Interval())
+        self.assertEqual(len(data), len(meshes))
+
+        # The right-handed meshes share the first topology, the left-handed
+        # ones share the second one.
+        self.assertEqual([d[0] for d in data[:4]], [0, 1, 0, 1])
+        for d in data[:4]:
+            self.assertEqual(list(d[1]), faceVertexCounts)
+
+        self.assertEqual(list(data[0][2]), faceVertexIndices)
+        self.assertEqual(list(data[1][2]), [3, 2, 1, 0, 2, 4, 1])
+
+        # Meshes with an invalid topology are skipped.
+        self.assertIsNone(data[4])
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -14,8 +14,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 #
-import unittest, os
-from pxr import Gf, Usd, UsdSkel
+import unittest, os, math
+from pxr import Gf, Usd, UsdGeom, UsdSkel, Vt
 
 from maya import cmds
 from maya import standalone
@@ -322,5 +322,101 @@ class testUsdImportSkeleton(unittest.TestCase):
         self.assertFalse(blendshapes, "Single sample wasn't treated as a static item")
 
 
+    def test_SkelImportLongAnimation(self):
+        """
+        Tests importing a joint animation over more joints than are decomposed
+        in a single batch: the imported joints match the animation, and
+        channels that do not change get no redundant keys.
+        """
+        cmds.file(new=True, force=True)
+
+        numJoints = 70
+        numFrames = 100
+        # The joints are animated up to this frame, then held.
+        lastAnimatedFrame = 50
+
+        path = os.path.join(os.environ.get('MAYA_APP_DIR'), "UsdImportSkeleton",
+                            "longSkelAnimation.usda")
+        stage = Usd.Stage.CreateNew(path)
+        stage.SetStartTimeCode(1)
+        stage.SetEndTimeCode(numFrames)
+        UsdSkel.Root.Define(stage, "/Root")
+        skel = UsdSkel.Skeleton.Define(stage, "/Root/Skel")
+
+        jointPaths = []
+        for i in range(numJoints):
+            jointPaths.append("/".join("j%d" % j for j in range(i + 1)))
+        restXforms = [Gf.Matrix4d().SetTranslate(Gf.Vec3d(0, 1, 0))] * numJoints
+        bindXforms = [Gf.Matrix4d().SetTranslate(Gf.Vec3d(0, i + 1, 0))
+                      for i in range(numJoints)]
+        skel.CreateJointsAttr(jointPaths)
+        skel.CreateRestTransformsAttr(Vt.Matrix4dArray(restXforms))
+        skel.CreateBindTransformsAttr(Vt.Matrix4dArray(bindXforms))
+
+        anim = UsdSkel.Animation.Define(stage, "/Root/Skel/Anim")
+        anim.CreateJointsAttr(jointPaths)
+        anim.CreateTranslationsAttr(Vt.Vec3fArray([Gf.Vec3f(0, 1, 0)] * numJoints))
+        anim.CreateScalesAttr(Vt.Vec3hArray([Gf.Vec3h(1, 1, 1)] * numJoints))
+        rotationsAttr = anim.CreateRotationsAttr()
+        for frame in range(1, numFrames + 1):
+            animFrame = min(frame, lastAnimatedFrame)
+            rotationsAttr.Set(Vt.QuatfArray(
+                [Gf.Quatf(Gf.Rotation(Gf.Vec3d(1, 0, 0),
+                                      10.0 * math.sin(animFrame * 0.05 + j)).GetQuat())
+                 for j in range(numJoints)]), frame)
+        UsdSkel.BindingAPI.Apply(skel.GetPrim()).CreateAnimationSourceRel().SetTargets(
+            [anim.GetPath()])
+        stage.GetRootLayer().Save()
+
+        # Spline tangents overshoot between the keys around the skipped ones
+        # unless these are given their own tangents.
+        globalTangents = (cmds.keyTangent(q=True, g=True, inTangentType=True)[0],
+                          cmds.keyTangent(q=True, g=True, outTangentType=True)[0])
+        cmds.keyTangent(g=True, inTangentType="spline", outTangentType="spline")
+        try:
+            cmds.mayaUSDImport(file=path, readAnimData=True, primPath="/Root")
+        finally:
+            cmds.keyTangent(g=True, inTangentType=globalTangents[0],
+                            outTangentType=globalTangents[1])
+
+        skelCache = UsdSkel.Cache()
+        skelCache.Populate(UsdSkel.Root(stage.GetPrimAtPath("/Root")),
+                           Usd.PrimDefaultPredicate)
+        skelQuery = skelCache.GetSkelQuery(skel)
+        self.assertTrue(skelQuery)
+
+        joints = [_GetDepNode(n.split("/")[-1]) for n in skelQuery.GetJointOrder()]
+        self.assertTrue(all(joints))
+
+        for frame in (1, 2, 37, lastAnimatedFrame, lastAnimatedFrame + 1, 75, numFrames):
+            cmds.currentTime(frame)
+            usdXforms = skelQuery.ComputeJointLocalTransforms(frame)
+            for i, joint in enumerate(joints):
+                jointXf = cmds.getAttr("%s.matrix" % joint.name())
+                self.assertTrue(_ArraysAreClose(_GfMatrixToList(usdXforms[i]), jointXf))
+
+        # Animated channels keep a key per animated frame and the last key of
+        # the hold, constant ones only their end keys. Check a joint of each
+        # batch.
+        for joint in (joints[5].name(), joints[numJoints - 1].name()):
+            self.assertEqual(cmds.keyframe(joint + ".rotateX", q=True, keyframeCount=True),
+                             lastAnimatedFrame + 1)
+            for attr in ("rotateY", "rotateZ", "translateY", "scaleX"):
+                self.assertEqual(cmds.keyframe("%s.%s" % (joint, attr), q=True,
+                                               keyframeCount=True), 2)
+
+            # The curves hold their value over the skipped keys, in between
+            # frames included.
+            heldValue = cmds.getAttr(joint + ".rotateX", time=lastAnimatedFrame)
+            for frame in range(lastAnimatedFrame + 1, numFrames):
+                for time in (frame - 0.5, frame):
+                    self.assertAlmostEqual(
+                        cmds.getAttr(joint + ".rotateX", time=time), heldValue, places=5)
+            translateY = cmds.getAttr(joint + ".translateY", time=1)
+            for time in (1.5, 37, numFrames - 0.5):
+                self.assertAlmostEqual(
+                    cmds.getAttr(joint + ".translateY", time=time), translateY, places=5)
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)